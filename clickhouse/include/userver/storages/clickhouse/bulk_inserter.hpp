@@ -0,0 +1,184 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/bulk_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BulkInserter
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/bulk_inserter_base.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// @ingroup userver_clients
+///
+/// @brief Accumulates the rows appended by many coroutines into big batches
+/// and inserts them into a ClickHouse table in background.
+///
+/// Inserting a few rows at a time creates a lot of tiny parts in ClickHouse,
+/// use the inserter for frequent small inserts instead of Cluster::InsertRows.
+/// A batch is flushed when any of the BulkInserterSettings thresholds is
+/// reached. A failed insert is retried at the next available host of the
+/// cluster, the rows of a batch that failed all the retries are dropped.
+///
+/// Append() only moves the row into a bounded queue. If the inserter falls
+/// behind, Append() blocks until there is room in the queue or the deadline
+/// is reached.
+///
+/// The remaining rows are flushed in the destructor.
+///
+/// `Row` is expected to be a default constructible clickhouse-mapped type,
+/// see @ref clickhouse_io. Per-host insert timings and batch sizes are
+/// reported in the `clickhouse` metrics, write the inserter-specific metrics
+/// with WriteStatistics().
+template <typename Row>
+class BulkInserter final {
+ public:
+  /// @param cluster cluster to insert into
+  /// @param table_name table to insert into
+  /// @param column_names names of columns of the table
+  /// @param settings flush thresholds and limits
+  BulkInserter(ClusterPtr cluster, std::string table_name,
+               std::vector<std::string> column_names,
+               BulkInserterSettings settings = {});
+
+  /// Flushes the appended rows and waits for the insert
+  ~BulkInserter();
+
+  BulkInserter(const BulkInserter&) = delete;
+  BulkInserter& operator=(const BulkInserter&) = delete;
+
+  /// @brief Appends a row to the next batch, waiting for a room in the queue
+  /// @returns false if the deadline was reached and the row was not appended
+  [[nodiscard]] bool Append(Row row, engine::Deadline deadline = {});
+
+  /// @brief Appends a row to the next batch without waiting
+  /// @returns false if the queue is full and the row was not appended
+  [[nodiscard]] bool TryAppend(Row row);
+
+  /// Write the inserter statistics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ private:
+  using Queue = concurrent::NonFifoMpscQueue<Row>;
+
+  void Run(typename Queue::Consumer consumer);
+  void FlushBatch(std::vector<Row>& batch);
+
+  impl::BulkInserterBase base_;
+  std::shared_ptr<Queue> queue_;
+  std::optional<typename Queue::MultiProducer> producer_;
+  engine::TaskWithResult<void> flush_task_;
+};
+
+template <typename Row>
+BulkInserter<Row>::BulkInserter(ClusterPtr cluster, std::string table_name,
+                                std::vector<std::string> column_names,
+                                BulkInserterSettings settings)
+    : base_(std::move(cluster), std::move(table_name), std::move(column_names),
+            settings),
+      queue_(Queue::Create(settings.max_queued_rows)),
+      producer_(queue_->GetMultiProducer()) {
+  io::impl::CommonValidateMapping<Row>();
+  io::impl::ValidateColumnsCount<Row>(base_.GetColumnNames().size());
+
+  flush_task_ = USERVER_NAMESPACE::utils::CriticalAsync(
+      "clickhouse_bulk_insert",
+      [this, consumer = queue_->GetConsumer()]() mutable {
+        Run(std::move(consumer));
+      });
+}
+
+template <typename Row>
+BulkInserter<Row>::~BulkInserter() {
+  // The consumer stops when the queue is empty and there are no producers
+  producer_.reset();
+  flush_task_.BlockingWait();
+}
+
+template <typename Row>
+bool BulkInserter<Row>::Append(Row row, engine::Deadline deadline) {
+  if (!producer_->Push(std::move(row), deadline)) {
+    base_.AccountRejected();
+    return false;
+  }
+  base_.AccountAppended();
+  return true;
+}
+
+template <typename Row>
+bool BulkInserter<Row>::TryAppend(Row row) {
+  if (!producer_->PushNoblock(std::move(row))) {
+    base_.AccountRejected();
+    return false;
+  }
+  base_.AccountAppended();
+  return true;
+}
+
+template <typename Row>
+void BulkInserter<Row>::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  base_.WriteStatistics(writer, queue_->GetSizeApproximate());
+}
+
+template <typename Row>
+void BulkInserter<Row>::Run(typename Queue::Consumer consumer) {
+  const auto& settings = base_.GetSettings();
+
+  std::vector<Row> batch;
+  std::size_t batch_bytes = 0;
+  engine::Deadline flush_deadline;
+
+  while (true) {
+    Row row{};
+    if (!consumer.Pop(row, flush_deadline)) {
+      // Either the flush interval has passed or the inserter is destroyed
+      if (batch.empty()) break;
+      FlushBatch(batch);
+      batch_bytes = 0;
+      flush_deadline = {};
+      continue;
+    }
+
+    if (batch.empty()) {
+      flush_deadline = engine::Deadline::FromDuration(settings.flush_interval);
+    }
+    batch_bytes += impl::EstimateRowBytes(row);
+    batch.push_back(std::move(row));
+
+    if (batch.size() >= settings.max_batch_rows ||
+        batch_bytes >= settings.max_batch_bytes) {
+      FlushBatch(batch);
+      batch_bytes = 0;
+      flush_deadline = {};
+    }
+  }
+}
+
+template <typename Row>
+void BulkInserter<Row>::FlushBatch(std::vector<Row>& batch) {
+  const auto request = impl::InsertionRequest::CreateFromRows(
+      base_.GetTableName(), base_.GetColumnNames(), batch);
+  base_.Flush(request, batch.size());
+  batch.clear();
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
 
+#include <userver/storages/clickhouse/cursor.hpp>
 #include <userver/storages/clickhouse/fwd.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/impl/pool.hpp>
@@ -26,7 +27,8 @@ class ExecutionResult;
 
 namespace impl {
 struct ClickhouseSettings;
-}
+class BulkInserterBase;
+}  // namespace impl
 
 /// @ingroup userver_clients
 ///
@@ -60,6 +62,21 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters and read the result block by block.
+  ///
+  /// The connection is held until the cursor is read till the end or
+  /// destroyed. Command control execute timeout applies to the whole stream.
+  template <typename... Args>
+  Cursor ExecuteStreaming(const Query& query, const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters and read the
+  /// result block by block.
+  template <typename... Args>
+  Cursor ExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -126,11 +143,15 @@ class Cluster final {
   };
 
  private:
+  friend class impl::BulkInserterBase;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  Cursor DoExecuteStreaming(OptionalCommandControl, const Query& query) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +210,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+Cursor Cluster::ExecuteStreaming(const Query& query,
+                                 const Args&... args) const {
+  return ExecuteStreaming(OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+Cursor Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                 const Query& query,
+                                 const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  return DoExecuteStreaming(optional_cc, formatted_query);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
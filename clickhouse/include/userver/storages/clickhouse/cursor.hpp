@@ -0,0 +1,84 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/cursor.hpp
+/// @brief @copybrief storages::clickhouse::Cursor
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <userver/storages/clickhouse/execution_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+namespace impl {
+class CursorImpl;
+}
+
+// clang-format off
+
+/// @brief Streaming result of a query, returned by
+/// storages::clickhouse::Cluster ExecuteStreaming methods
+///
+/// The result is read block by block as ClickHouse sends them, so it does not
+/// have to fit in memory. The query is executed in background and at most a
+/// few blocks are buffered: if the cursor is not read, the query waits.
+///
+/// Destroying the cursor before the last block is read cancels the query.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/cursor_chtest.cpp  Sample Cursor usage
+
+// clang-format on
+class Cursor final {
+ public:
+  /// @cond
+  // For internal use only
+  explicit Cursor(std::unique_ptr<impl::CursorImpl>&&);
+  /// @endcond
+
+  Cursor(Cursor&&) noexcept;
+  Cursor& operator=(Cursor&&) noexcept;
+  ~Cursor();
+
+  /// @brief Waits for the next block of the result
+  /// @returns std::nullopt if there are no more blocks
+  /// @throws the query execution error
+  std::optional<ExecutionResult> NextBlock();
+
+  /// @brief Calls `callback(T&&)` for every row of the result
+  /// See @ref clickhouse_io for better understanding of `T`'s requirements.
+  template <typename T, typename Callback>
+  void ForEachRow(Callback&& callback);
+
+  /// @brief Calls `callback(T&&)` for every block of the result converted to
+  /// a struct of vectors
+  /// See @ref clickhouse_io for better understanding of `T`'s requirements.
+  template <typename T, typename Callback>
+  void ForEachBlock(Callback&& callback);
+
+ private:
+  std::unique_ptr<impl::CursorImpl> impl_;
+};
+
+template <typename T, typename Callback>
+void Cursor::ForEachRow(Callback&& callback) {
+  while (auto block = NextBlock()) {
+    auto rows = std::move(*block).AsRows<T>();
+    for (auto&& row : rows) callback(std::move(row));
+  }
+}
+
+template <typename T, typename Callback>
+void Cursor::ForEachBlock(Callback&& callback) {
+  while (auto block = NextBlock()) {
+    callback(std::move(*block).As<T>());
+  }
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
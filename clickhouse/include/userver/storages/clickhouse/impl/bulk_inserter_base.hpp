@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+class InsertionRequest;
+
+// Type-independent part of the BulkInserter: inserts with retries and
+// statistics
+class BulkInserterBase final {
+ public:
+  BulkInserterBase(ClusterPtr cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   BulkInserterSettings settings);
+  ~BulkInserterBase();
+
+  const BulkInserterSettings& GetSettings() const noexcept;
+
+  const std::string& GetTableName() const noexcept;
+
+  const std::vector<std::string_view>& GetColumnNames() const noexcept;
+
+  // Inserts the request at some host of the cluster, retrying at the other
+  // hosts on failures. Failed rows are dropped and accounted in statistics.
+  void Flush(const InsertionRequest& request, std::size_t rows_count) noexcept;
+
+  void AccountAppended() noexcept;
+  void AccountRejected() noexcept;
+
+  void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                       std::size_t queued_rows) const;
+
+ private:
+  struct Statistics;
+
+  const ClusterPtr cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_names_views_;
+  const BulkInserterSettings settings_;
+  std::unique_ptr<Statistics> stats_;
+};
+
+template <typename Field>
+std::size_t EstimateFieldBytes(const Field& field) noexcept {
+  if constexpr (std::is_same_v<Field, std::string>) {
+    return field.size();
+  } else if constexpr (std::is_same_v<Field, std::optional<std::string>>) {
+    return field ? field->size() : 1;
+  } else {
+    return sizeof(Field);
+  }
+}
+
+// Approximate size of the row in a native block
+template <typename Row>
+std::size_t EstimateRowBytes(const Row& row) noexcept {
+  std::size_t bytes = 0;
+  boost::pfr::for_each_field(
+      row, [&bytes](const auto& field) { bytes += EstimateFieldBytes(field); });
+  return bytes;
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -11,7 +11,9 @@
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
 #include <userver/storages/clickhouse/io/columns/common_columns.hpp>
+#include <userver/storages/clickhouse/io/columns/map_column.hpp>
 #include <userver/storages/clickhouse/io/columns/nullable_column.hpp>
 
 USERVER_NAMESPACE_BEGIN
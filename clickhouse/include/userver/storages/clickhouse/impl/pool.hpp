@@ -13,6 +13,7 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::clickhouse {
 
 class Query;
+class Cursor;
 
 namespace impl {
 class PoolImpl;
@@ -29,6 +30,8 @@ class Pool final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+  Cursor ExecuteStreaming(OptionalCommandControl, const Query& query) const;
+
   void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
   void WriteStatistics(
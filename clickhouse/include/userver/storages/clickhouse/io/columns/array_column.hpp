@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/array_column.hpp
+/// @brief Array column support
+/// @ingroup userver_clickhouse_types
+
+#include <utility>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+struct ArrayColumnMeta final {
+  ColumnRef data;
+  // end offset of every array in data
+  std::vector<uint64_t> offsets;
+};
+
+ColumnRef GetArrayColumn(ColumnRef column);
+
+ColumnRef GetArrayItemAt(const ColumnRef& column, size_t ind);
+
+ColumnRef ConvertMetaToColumn(ArrayColumnMeta&& meta);
+
+/// @brief Represents ClickHouse Array(T) column,
+/// where T is a ClickhouseColumn as well
+template <typename T>
+class ArrayColumn final : public ClickhouseColumn<ArrayColumn<T>> {
+ public:
+  using cpp_type = std::vector<typename T::cpp_type>;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = impl::IndexedDataHolder<ArrayColumn>;
+
+  ArrayColumn(ColumnRef column);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+template <typename T>
+ArrayColumn<T>::ArrayColumn(ColumnRef column)
+    : ClickhouseColumn<ArrayColumn>{GetArrayColumn(std::move(column))} {}
+
+template <typename T>
+typename ArrayColumn<T>::cpp_type ArrayColumn<T>::GetAt(const ColumnRef& column,
+                                                        size_t ind) {
+  const T item{GetArrayItemAt(column, ind)};
+
+  cpp_type result;
+  result.reserve(item.Size());
+  for (auto it = item.begin(); it != item.end(); ++it) {
+    result.push_back(std::move(*it));
+  }
+  return result;
+}
+
+template <typename T>
+ColumnRef ArrayColumn<T>::Serialize(const container_type& from) {
+  std::size_t total_size = 0;
+  for (const auto& array : from) total_size += array.size();
+
+  typename T::container_type data;
+  data.reserve(total_size);
+  std::vector<uint64_t> offsets;
+  offsets.reserve(from.size());
+
+  for (const auto& array : from) {
+    data.insert(data.end(), array.begin(), array.end());
+    offsets.push_back(data.size());
+  }
+
+  ArrayColumnMeta array_meta;
+  array_meta.data = T::Serialize(data);
+  array_meta.offsets = std::move(offsets);
+  return ConvertMetaToColumn(std::move(array_meta));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -188,6 +188,62 @@ bool ColumnIterator<ColumnType>::DataHolder::operator==(
   return ind_ == other.ind_ && column_.get() == other.column_.get();
 }
 
+namespace impl {
+
+// Iterator data for column templates that can't specialize
+// ColumnIterator<ColumnType>::DataHolder::Get() for every instantiation:
+// the value is obtained with `static cpp_type ColumnType::GetAt(column, ind)`
+template <typename ColumnType>
+class IndexedDataHolder final {
+ public:
+  using value_type = typename ColumnType::cpp_type;
+  using IteratorPosition =
+      typename ColumnIterator<ColumnType>::IteratorPosition;
+
+  IndexedDataHolder() = default;
+  IndexedDataHolder(IteratorPosition iter_position, ColumnRef&& column)
+      : column_{std::move(column)},
+        ind_{iter_position == IteratorPosition::kEnd ? GetColumnSize(column_)
+                                                     : 0} {}
+
+  IndexedDataHolder operator++(int) {
+    IndexedDataHolder old{};
+    old.column_ = column_;
+    old.ind_ = ind_++;
+    old.current_value_ = std::move_if_noexcept(current_value_);
+    current_value_.reset();
+
+    return old;
+  }
+
+  IndexedDataHolder& operator++() {
+    ++ind_;
+    current_value_.reset();
+
+    return *this;
+  }
+
+  value_type& UpdateValue() {
+    UASSERT(ind_ < GetColumnSize(column_));
+    if (!current_value_.has_value()) {
+      current_value_.emplace(ColumnType::GetAt(column_, ind_));
+    }
+    return *current_value_;
+  }
+
+  bool operator==(const IndexedDataHolder& other) const {
+    return ind_ == other.ind_ && column_.get() == other.column_.get();
+  }
+
+ private:
+  ColumnRef column_;
+  size_t ind_{0};
+
+  std::optional<value_type> current_value_ = std::nullopt;
+};
+
+}  // namespace impl
+
 }  // namespace columns
 
 }  // namespace storages::clickhouse::io
@@ -0,0 +1,30 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/date32_column.hpp
+/// @brief Date32 column support
+/// @ingroup userver_clickhouse_types
+
+#include <chrono>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse Date32 column.
+///
+/// Time of the day is truncated on insert.
+class Date32Column final : public ClickhouseColumn<Date32Column> {
+ public:
+  using cpp_type = std::chrono::system_clock::time_point;
+  using container_type = std::vector<cpp_type>;
+
+  Date32Column(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/decimal_column.hpp
+/// @brief Decimal columns support
+/// @ingroup userver_clickhouse_types
+
+#include <cstdint>
+
+#include <userver/decimal64/decimal64.hpp>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+ColumnRef GetDecimalColumn(ColumnRef column, size_t scale);
+
+int64_t GetDecimalUnbiasedAt(const ColumnRef& column, size_t ind);
+
+ColumnRef SerializeDecimal(size_t precision, size_t scale,
+                           const std::vector<int64_t>& unbiased_values);
+
+/// @brief Helper class for instantiating Decimal columns, `Precision` is the
+/// ClickHouse storage precision and `Scale` is the number of fractional
+/// digits.
+///
+/// Values are mapped to decimal64::Decimal<Scale>, reading a Decimal128 value
+/// that does not fit in 64 bits throws.
+///
+/// see
+///  - storages::clickhouse::io::columns::Decimal32Column
+///  - storages::clickhouse::io::columns::Decimal64Column
+///  - storages::clickhouse::io::columns::Decimal128Column
+template <size_t Precision, int Scale>
+class DecimalColumn final
+    : public ClickhouseColumn<DecimalColumn<Precision, Scale>> {
+ public:
+  static_assert(Scale >= 0 && static_cast<size_t>(Scale) <= Precision);
+
+  using cpp_type = decimal64::Decimal<Scale>;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = impl::IndexedDataHolder<DecimalColumn>;
+
+  DecimalColumn(ColumnRef column);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+/// @brief Represents ClickHouse Decimal32(S) column
+template <int Scale>
+using Decimal32Column = DecimalColumn<9, Scale>;
+
+/// @brief Represents ClickHouse Decimal64(S) column
+template <int Scale>
+using Decimal64Column = DecimalColumn<18, Scale>;
+
+/// @brief Represents ClickHouse Decimal128(S) column
+template <int Scale>
+using Decimal128Column = DecimalColumn<38, Scale>;
+
+template <size_t Precision, int Scale>
+DecimalColumn<Precision, Scale>::DecimalColumn(ColumnRef column)
+    : ClickhouseColumn<DecimalColumn>{
+          GetDecimalColumn(std::move(column), Scale)} {}
+
+template <size_t Precision, int Scale>
+typename DecimalColumn<Precision, Scale>::cpp_type
+DecimalColumn<Precision, Scale>::GetAt(const ColumnRef& column, size_t ind) {
+  return cpp_type::FromUnbiased(GetDecimalUnbiasedAt(column, ind));
+}
+
+template <size_t Precision, int Scale>
+ColumnRef DecimalColumn<Precision, Scale>::Serialize(
+    const container_type& from) {
+  std::vector<int64_t> unbiased_values;
+  unbiased_values.reserve(from.size());
+  for (const auto& value : from) {
+    unbiased_values.push_back(value.AsUnbiased());
+  }
+
+  return SerializeDecimal(Precision, Scale, unbiased_values);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
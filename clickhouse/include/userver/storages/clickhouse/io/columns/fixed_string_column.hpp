@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/fixed_string_column.hpp
+/// @brief FixedString(N) column support
+/// @ingroup userver_clickhouse_types
+
+#include <string>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+ColumnRef GetFixedStringColumn(ColumnRef column, size_t size);
+
+std::string GetFixedStringAt(const ColumnRef& column, size_t ind);
+
+ColumnRef SerializeFixedString(size_t size,
+                               const std::vector<std::string>& from);
+
+/// @brief Represents ClickHouse FixedString(N) column.
+///
+/// Shorter strings are padded with zero bytes by ClickHouse, so the read
+/// values are always `N` bytes long. Inserting a longer string throws.
+template <size_t N>
+class FixedStringColumn final : public ClickhouseColumn<FixedStringColumn<N>> {
+ public:
+  using cpp_type = std::string;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = impl::IndexedDataHolder<FixedStringColumn>;
+
+  FixedStringColumn(ColumnRef column);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+template <size_t N>
+FixedStringColumn<N>::FixedStringColumn(ColumnRef column)
+    : ClickhouseColumn<FixedStringColumn>{
+          GetFixedStringColumn(std::move(column), N)} {}
+
+template <size_t N>
+typename FixedStringColumn<N>::cpp_type FixedStringColumn<N>::GetAt(
+    const ColumnRef& column, size_t ind) {
+  return GetFixedStringAt(column, ind);
+}
+
+template <size_t N>
+ColumnRef FixedStringColumn<N>::Serialize(const container_type& from) {
+  return SerializeFixedString(N, from);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/low_cardinality_column.hpp
+/// @brief LowCardinality(String) column support
+/// @ingroup userver_clickhouse_types
+
+#include <string>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse LowCardinality(String) column
+///
+/// Values are dictionary-encoded while serializing, so every distinct string
+/// is sent to ClickHouse once per insert.
+class LowCardinalityStringColumn final
+    : public ClickhouseColumn<LowCardinalityStringColumn> {
+ public:
+  using cpp_type = std::string;
+  using container_type = std::vector<cpp_type>;
+
+  LowCardinalityStringColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
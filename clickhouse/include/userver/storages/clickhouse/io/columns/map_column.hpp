@@ -0,0 +1,97 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/map_column.hpp
+/// @brief Map column support
+/// @ingroup userver_clickhouse_types
+
+#include <utility>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+struct MapColumnMeta final {
+  ColumnRef keys;
+  ColumnRef values;
+};
+
+ColumnRef GetMapColumn(ColumnRef column);
+
+MapColumnMeta GetMapItemAt(const ColumnRef& column, size_t ind);
+
+// offsets are the end offsets of every map in keys and values
+ColumnRef ConvertMetaToColumn(MapColumnMeta&& meta,
+                              std::vector<uint64_t>&& offsets);
+
+/// @brief Represents ClickHouse Map(K, V) column,
+/// where K and V are ClickhouseColumn as well
+///
+/// A map is represented as a vector of key-value pairs in the order they are
+/// stored in ClickHouse.
+template <typename K, typename V>
+class MapColumn final : public ClickhouseColumn<MapColumn<K, V>> {
+ public:
+  using cpp_type =
+      std::vector<std::pair<typename K::cpp_type, typename V::cpp_type>>;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = impl::IndexedDataHolder<MapColumn>;
+
+  MapColumn(ColumnRef column);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+template <typename K, typename V>
+MapColumn<K, V>::MapColumn(ColumnRef column)
+    : ClickhouseColumn<MapColumn>{GetMapColumn(std::move(column))} {}
+
+template <typename K, typename V>
+typename MapColumn<K, V>::cpp_type MapColumn<K, V>::GetAt(
+    const ColumnRef& column, size_t ind) {
+  auto item = GetMapItemAt(column, ind);
+  const K keys{std::move(item.keys)};
+  const V values{std::move(item.values)};
+  UASSERT(keys.Size() == values.Size());
+
+  cpp_type result;
+  result.reserve(keys.Size());
+  auto value_it = values.begin();
+  for (auto key_it = keys.begin(); key_it != keys.end(); ++key_it, ++value_it) {
+    result.emplace_back(std::move(*key_it), std::move(*value_it));
+  }
+  return result;
+}
+
+template <typename K, typename V>
+ColumnRef MapColumn<K, V>::Serialize(const container_type& from) {
+  std::size_t total_size = 0;
+  for (const auto& map : from) total_size += map.size();
+
+  typename K::container_type keys;
+  keys.reserve(total_size);
+  typename V::container_type values;
+  values.reserve(total_size);
+  std::vector<uint64_t> offsets;
+  offsets.reserve(from.size());
+
+  for (const auto& map : from) {
+    for (const auto& [key, value] : map) {
+      keys.push_back(key);
+      values.push_back(value);
+    }
+    offsets.push_back(keys.size());
+  }
+
+  MapColumnMeta map_meta;
+  map_meta.keys = K::Serialize(keys);
+  map_meta.values = V::Serialize(values);
+  return ConvertMetaToColumn(std::move(map_meta), std::move(offsets));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -9,7 +9,9 @@
 #include <userver/utils/meta_light.hpp>
 
 #include <userver/storages/clickhouse/io/columns/base_column.hpp>
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
 #include <userver/storages/clickhouse/io/columns/common_columns.hpp>
+#include <userver/storages/clickhouse/io/columns/map_column.hpp>
 #include <userver/storages/clickhouse/io/columns/nullable_column.hpp>
 #include <userver/storages/clickhouse/io/io_fwd.hpp>
 #include <userver/storages/clickhouse/io/type_traits.hpp>
@@ -19,8 +19,10 @@ namespace storages::clickhouse::io {
 /// `CppToClickhouse` template.
 ///
 /// @section types Supported Clickhouse types:
+/// - Date32 @ref storages::clickhouse::io::columns::Date32Column
 /// - DateTime @ref storages::clickhouse::io::columns::DateTimeColumn
 /// - DateTime64([3, 6, 9]) @ref storages::clickhouse::io::columns::DateTime64Column
+/// - Decimal32/64/128(S) @ref storages::clickhouse::io::columns::DecimalColumn
 /// - Int8 @ref storages::clickhouse::io::columns::Int8Column
 /// - Int32 @ref storages::clickhouse::io::columns::Int32Column
 /// - Int64 @ref storages::clickhouse::io::columns::Int64Column
@@ -29,8 +31,12 @@ namespace storages::clickhouse::io {
 /// - UInt32 @ref storages::clickhouse::io::columns::UInt32Column
 /// - UInt64 @ref storages::clickhouse::io::columns::UInt64Column
 /// - String @ref storages::clickhouse::io::columns::StringColumn
+/// - FixedString(N) @ref storages::clickhouse::io::columns::FixedStringColumn
+/// - LowCardinality(String) @ref storages::clickhouse::io::columns::LowCardinalityStringColumn
 /// - UUID @ref storages::clickhouse::io::columns::UuidColumn
 /// - Nullable @ref storages::clickhouse::io::columns::NullableColumn
+/// - Array @ref storages::clickhouse::io::columns::ArrayColumn
+/// - Map @ref storages::clickhouse::io::columns::MapColumn
 /// - Float32 @ref storages::clickhouse::io::columns::Float32Column
 /// - Float64 @ref storages::clickhouse::io::columns::Float64Column
 ///
@@ -4,6 +4,7 @@
 /// @brief Options
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,6 +36,28 @@ struct CommandControl final {
 /// @brief storages::clickhouse::CommandControl that may not be set.
 using OptionalCommandControl = std::optional<CommandControl>;
 
+/// Settings of the storages::clickhouse::BulkInserter
+struct BulkInserterSettings final {
+  /// A batch is flushed when it has this many rows...
+  std::size_t max_batch_rows{100'000};
+
+  /// ...or when its estimated size reaches this many bytes...
+  std::size_t max_batch_bytes{16 * 1024 * 1024};
+
+  /// ...or when its first row waits for this long.
+  std::chrono::milliseconds flush_interval{1000};
+
+  /// Max count of appended rows that are not in a batch yet. Append() blocks
+  /// when the queue is full.
+  std::size_t max_queued_rows{1'000'000};
+
+  /// Count of insert retries, every retry goes to the next available host
+  std::size_t max_retries{2};
+
+  /// Command control of a single insert attempt
+  OptionalCommandControl command_control{};
+};
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -55,6 +55,11 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc,
   return GetPool().Execute(optional_cc, query);
 }
 
+Cursor Cluster::DoExecuteStreaming(OptionalCommandControl optional_cc,
+                                   const Query& query) const {
+  return GetPool().ExecuteStreaming(optional_cc, query);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc,
                        const impl::InsertionRequest& request) const {
   GetPool().Insert(optional_cc, request);
@@ -0,0 +1,130 @@
+#include <userver/storages/clickhouse/impl/bulk_inserter_base.hpp>
+
+#include <chrono>
+#include <exception>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+using Counter = USERVER_NAMESPACE::utils::statistics::RelaxedCounter<uint64_t>;
+using Histogram = USERVER_NAMESPACE::utils::statistics::Histogram<2, 24>;
+using RecentHistogram =
+    USERVER_NAMESPACE::utils::statistics::RecentPeriod<Histogram, Histogram>;
+
+std::vector<std::string_view> MakeViews(const std::vector<std::string>& names) {
+  return {names.begin(), names.end()};
+}
+
+}  // namespace
+
+struct BulkInserterBase::Statistics final {
+  Counter appended{};
+  Counter rejected{};
+  Counter inserted{};
+  Counter dropped{};
+  Counter flushes{};
+  Counter retries{};
+  // rows count of a flushed batch
+  RecentHistogram batch_size{};
+  // milliseconds of a flush, including the retries
+  RecentHistogram flush_timings{};
+};
+
+BulkInserterBase::BulkInserterBase(ClusterPtr cluster, std::string table_name,
+                                   std::vector<std::string> column_names,
+                                   BulkInserterSettings settings)
+    : cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_names_views_(MakeViews(column_names_)),
+      settings_(settings),
+      stats_(std::make_unique<Statistics>()) {
+  UINVARIANT(cluster_, "No cluster for the bulk inserter");
+  UINVARIANT(settings_.max_batch_rows > 0, "Empty batches are not allowed");
+}
+
+BulkInserterBase::~BulkInserterBase() = default;
+
+const BulkInserterSettings& BulkInserterBase::GetSettings() const noexcept {
+  return settings_;
+}
+
+const std::string& BulkInserterBase::GetTableName() const noexcept {
+  return table_name_;
+}
+
+const std::vector<std::string_view>& BulkInserterBase::GetColumnNames()
+    const noexcept {
+  return column_names_views_;
+}
+
+void BulkInserterBase::Flush(const InsertionRequest& request,
+                             std::size_t rows_count) noexcept {
+  const auto start = std::chrono::steady_clock::now();
+  ++stats_->flushes;
+  stats_->batch_size.GetCurrentCounter().Account(rows_count);
+
+  bool inserted = false;
+  for (std::size_t attempt = 0; attempt <= settings_.max_retries; ++attempt) {
+    if (attempt != 0) ++stats_->retries;
+    try {
+      // Cluster picks the next available host on every call
+      cluster_->DoInsert(settings_.command_control, request);
+      inserted = true;
+      break;
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to insert " << rows_count << " rows into '"
+                    << table_name_ << "', attempt " << attempt + 1 << ": "
+                    << ex;
+    }
+    if (engine::current_task::ShouldCancel()) break;
+  }
+
+  if (inserted) {
+    stats_->inserted += rows_count;
+  } else {
+    LOG_ERROR() << "Dropping " << rows_count << " rows for '" << table_name_
+                << "' after all the insert attempts failed";
+    stats_->dropped += rows_count;
+  }
+
+  stats_->flush_timings.GetCurrentCounter().Account(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+}
+
+void BulkInserterBase::AccountAppended() noexcept { ++stats_->appended; }
+
+void BulkInserterBase::AccountRejected() noexcept { ++stats_->rejected; }
+
+void BulkInserterBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer,
+    std::size_t queued_rows) const {
+  writer["queued"] = queued_rows;
+  if (auto rows = writer["rows"]) {
+    rows["appended"] = stats_->appended;
+    rows["rejected"] = stats_->rejected;
+    rows["inserted"] = stats_->inserted;
+    rows["dropped"] = stats_->dropped;
+  }
+  writer["flushes"] = stats_->flushes;
+  writer["retries"] = stats_->retries;
+  writer["batch_size"] = stats_->batch_size;
+  writer["flush_timings"] = stats_->flush_timings;
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -104,6 +104,27 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const Query& query, BlockCallback on_block) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  native_query.OnDataCancelable(
+      [&on_block, &scope](const NativeBlock& data) {
+        if (engine::current_task::ShouldCancel()) return false;
+        scope.Reset(scopes::kExec);
+        // the server sends an empty block with the header first
+        if (data.GetRowCount() == 0) return true;
+
+        // we must return 'true' if we don't want to cancel query
+        return on_block(BlockWrapperPtr{new BlockWrapper{NativeBlock{data}}});
+      });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
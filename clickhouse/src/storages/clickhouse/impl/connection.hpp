@@ -2,6 +2,8 @@
 
 #include <storages/clickhouse/impl/wrap_clickhouse_cpp.hpp>
 
+#include <functional>
+
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
 #include <userver/storages/clickhouse/options.hpp>
@@ -28,6 +30,11 @@ class Connection final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  // Returning false from the callback cancels the query
+  using BlockCallback = std::function<bool(BlockWrapperPtr&&)>;
+  void ExecuteStreaming(OptionalCommandControl, const Query&,
+                        BlockCallback on_block);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
   void Ping();
@@ -0,0 +1,29 @@
+#include <storages/clickhouse/impl/cursor_impl.hpp>
+
+#include <storages/clickhouse/impl/block_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+CursorImpl::CursorImpl(Queue::Consumer&& consumer,
+                       engine::TaskWithResult<void>&& execute_task)
+    : consumer_{std::move(consumer)}, execute_task_{std::move(execute_task)} {}
+
+CursorImpl::~CursorImpl() {
+  // Cancels the query if the result is not read till the end
+  if (execute_task_.IsValid()) execute_task_.SyncCancel();
+}
+
+BlockWrapperPtr CursorImpl::Next() {
+  BlockWrapperPtr block;
+  if (consumer_.Pop(block)) return block;
+
+  // The query has finished, rethrow its error if any
+  if (execute_task_.IsValid()) execute_task_.Get();
+  return nullptr;
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
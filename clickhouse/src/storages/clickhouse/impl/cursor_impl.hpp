@@ -0,0 +1,29 @@
+#pragma once
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+class CursorImpl final {
+ public:
+  using Queue = concurrent::SpscQueue<BlockWrapperPtr>;
+
+  CursorImpl(Queue::Consumer&& consumer,
+             engine::TaskWithResult<void>&& execute_task);
+  ~CursorImpl();
+
+  // Returns nullptr if there are no more blocks
+  BlockWrapperPtr Next();
+
+ private:
+  Queue::Consumer consumer_;
+  engine::TaskWithResult<void> execute_task_;
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,18 @@
 #include <userver/storages/clickhouse/impl/pool.hpp>
 
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+
+#include <userver/storages/clickhouse/cursor.hpp>
 #include <userver/storages/clickhouse/query.hpp>
 
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
+#include <userver/utils/async.hpp>
 
+#include <storages/clickhouse/impl/block_wrapper.hpp>
 #include <storages/clickhouse/impl/connection.hpp>
 #include <storages/clickhouse/impl/connection_ptr.hpp>
+#include <storages/clickhouse/impl/cursor_impl.hpp>
 #include <storages/clickhouse/impl/pool_impl.hpp>
 #include <storages/clickhouse/impl/tracing_tags.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -17,6 +23,9 @@ namespace storages::clickhouse::impl {
 
 namespace {
 
+// Blocks read ahead of the cursor consumer
+constexpr std::size_t kMaxBufferedBlocks = 2;
+
 tracing::Span PrepareExecutionSpan(const std::string& scope,
                                    const std::string& db_instance) {
   tracing::Span span{scope};
@@ -45,14 +54,46 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc,
   return conn_ptr->Execute(optional_cc, query);
 }
 
+Cursor Pool::ExecuteStreaming(OptionalCommandControl optional_cc,
+                              const Query& query) const {
+  auto conn_ptr = impl_->Acquire();
+
+  auto queue = CursorImpl::Queue::Create(kMaxBufferedBlocks);
+  auto task = utils::Async(
+      "clickhouse_streaming_query",
+      [pool_impl = impl_, conn_ptr = std::move(conn_ptr),
+       producer = queue->GetProducer(), optional_cc, query]() mutable {
+        auto span =
+            PrepareExecutionSpan(scopes::kQuery, pool_impl->GetHostName());
+        query.FillSpanTags(span);
+
+        const auto timer = pool_impl->GetExecuteTimer();
+        conn_ptr->ExecuteStreaming(
+            optional_cc, query, [&producer](BlockWrapperPtr&& block) {
+              // fails only if the cursor is destroyed or the task is cancelled
+              return producer.Push(std::move(block));
+            });
+      });
+
+  return Cursor{
+      std::make_unique<CursorImpl>(queue->GetConsumer(), std::move(task))};
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc,
                   const InsertionRequest& request) const {
   auto conn_ptr = impl_->Acquire();
 
   auto span = PrepareExecutionSpan(impl::scopes::kInsert, impl_->GetHostName());
 
-  const auto timer = impl_->GetInsertTimer();
-  conn_ptr->Insert(optional_cc, request);
+  {
+    const auto timer = impl_->GetInsertTimer();
+    conn_ptr->Insert(optional_cc, request);
+  }
+
+  const auto rows_count = request.GetBlock().GetRowsCount();
+  auto& rows_stats = impl_->GetStatistics().inserted_rows;
+  rows_stats.total += rows_count;
+  rows_stats.batch_size.GetCurrentCounter().Account(rows_count);
 }
 
 void Pool::WriteStatistics(
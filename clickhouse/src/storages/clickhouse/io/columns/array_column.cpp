@@ -0,0 +1,43 @@
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/array.h>
+#include <clickhouse/columns/numeric.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnArray;
+}
+
+ColumnRef GetArrayColumn(ColumnRef column) {
+  if (!column->As<NativeType>()) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Array",
+                    column->Type()->GetName())};
+  }
+
+  return column;
+}
+
+ColumnRef GetArrayItemAt(const ColumnRef& column, size_t ind) {
+  UASSERT(column->As<NativeType>() != nullptr);
+  return static_cast<NativeType*>(column.get())->GetAsColumn(ind);
+}
+
+ColumnRef ConvertMetaToColumn(ArrayColumnMeta&& meta) {
+  auto offsets =
+      std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnUInt64>(
+          std::move(meta.offsets));
+  return std::make_shared<NativeType>(std::move(meta.data),
+                                      std::move(offsets));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <userver/storages/clickhouse/io/columns/date32_column.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/date.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnDate32;
+using Days = std::chrono::duration<std::int64_t, std::ratio<86400>>;
+}  // namespace
+
+Date32Column::Date32Column(ColumnRef column)
+    : ClickhouseColumn{impl::GetTypedColumn<Date32Column, NativeType>(column)} {
+}
+
+template <>
+Date32Column::cpp_type ColumnIterator<Date32Column>::DataHolder::Get() const {
+  const auto time = impl::NativeGetAt<NativeType>(column_, ind_);
+  return std::chrono::system_clock::from_time_t(time);
+}
+
+ColumnRef Date32Column::Serialize(const container_type& from) {
+  auto column = clickhouse::impl::clickhouse_cpp::ColumnDate32{};
+
+  for (const auto tp : from) {
+    // The column truncates the time towards zero, pre-epoch times have to be
+    // rounded down to the start of their day beforehand
+    column.Append(
+        std::chrono::system_clock::to_time_t(std::chrono::floor<Days>(tp)));
+  }
+
+  return std::make_shared<decltype(column)>(std::move(column));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <userver/storages/clickhouse/io/columns/decimal_column.hpp>
+
+#include <limits>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/decimal.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnDecimal;
+using NativeValueType = clickhouse::impl::clickhouse_cpp::Int128;
+
+// The column silently truncates the values that have more digits than the
+// precision allows
+void ValidateDecimalPrecision(size_t precision, size_t scale, int64_t value) {
+  // Every int64_t value fits
+  if (precision > static_cast<size_t>(std::numeric_limits<int64_t>::digits10)) {
+    return;
+  }
+
+  int64_t limit = 1;
+  for (size_t i = 0; i < precision; ++i) limit *= 10;
+  if (value >= limit || value <= -limit) {
+    throw std::runtime_error{
+        fmt::format("unbiased value {} does not fit in Decimal({}, {})", value,
+                    precision, scale)};
+  }
+}
+
+}  // namespace
+
+ColumnRef GetDecimalColumn(ColumnRef column, size_t scale) {
+  const auto typed_column = column->As<NativeType>();
+  if (!typed_column || typed_column->GetScale() != scale) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Decimal with "
+                    "scale {}",
+                    column->Type()->GetName(), scale)};
+  }
+
+  return column;
+}
+
+int64_t GetDecimalUnbiasedAt(const ColumnRef& column, size_t ind) {
+  const NativeValueType value = impl::NativeGetAt<NativeType>(column, ind);
+  if (value > NativeValueType{std::numeric_limits<int64_t>::max()} ||
+      value < NativeValueType{std::numeric_limits<int64_t>::min()}) {
+    throw std::runtime_error{
+        fmt::format("value of column of type '{}' does not fit in decimal64",
+                    column->Type()->GetName())};
+  }
+
+  return static_cast<int64_t>(value);
+}
+
+ColumnRef SerializeDecimal(size_t precision, size_t scale,
+                           const std::vector<int64_t>& unbiased_values) {
+  auto column = std::make_shared<NativeType>(precision, scale);
+  for (const auto value : unbiased_values) {
+    ValidateDecimalPrecision(precision, scale, value);
+    column->Append(NativeValueType{value});
+  }
+
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
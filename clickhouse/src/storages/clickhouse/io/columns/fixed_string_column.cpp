@@ -0,0 +1,46 @@
+#include <userver/storages/clickhouse/io/columns/fixed_string_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/string.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnFixedString;
+}
+
+ColumnRef GetFixedStringColumn(ColumnRef column, size_t size) {
+  const auto expected_type = fmt::format("FixedString({})", size);
+  if (!column->As<NativeType>() ||
+      column->Type()->GetName() != expected_type) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to {}",
+                    column->Type()->GetName(), expected_type)};
+  }
+
+  return column;
+}
+
+std::string GetFixedStringAt(const ColumnRef& column, size_t ind) {
+  return std::string{impl::NativeGetAt<NativeType>(column, ind)};
+}
+
+ColumnRef SerializeFixedString(size_t size,
+                               const std::vector<std::string>& from) {
+  auto column = std::make_shared<NativeType>(size);
+  for (const auto& value : from) {
+    // throws if the value is longer than the column size
+    column->Append(std::string_view{value});
+  }
+
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#include <userver/storages/clickhouse/io/columns/low_cardinality_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/lowcardinality.h>
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnLowCardinalityT<
+    clickhouse::impl::clickhouse_cpp::ColumnString>;
+// clickhouse-cpp unwraps LowCardinality columns of the results by default
+using UnwrappedNativeType = clickhouse::impl::clickhouse_cpp::ColumnString;
+
+ColumnRef GetLowCardinalityColumn(const ColumnRef& column) {
+  if (column->As<UnwrappedNativeType>()) return column;
+  return impl::GetTypedColumn<LowCardinalityStringColumn, NativeType>(column);
+}
+
+}  // namespace
+
+LowCardinalityStringColumn::LowCardinalityStringColumn(ColumnRef column)
+    : ClickhouseColumn{GetLowCardinalityColumn(column)} {}
+
+template <>
+LowCardinalityStringColumn::cpp_type
+ColumnIterator<LowCardinalityStringColumn>::DataHolder::Get() const {
+  if (column_->Type()->GetCode() ==
+      clickhouse::impl::clickhouse_cpp::Type::String) {
+    return std::string{impl::NativeGetAt<UnwrappedNativeType>(column_, ind_)};
+  }
+  return std::string{impl::NativeGetAt<NativeType>(column_, ind_)};
+}
+
+ColumnRef LowCardinalityStringColumn::Serialize(const container_type& from) {
+  auto column = std::make_shared<NativeType>();
+  for (const auto& value : from) {
+    column->Append(std::string_view{value});
+  }
+
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
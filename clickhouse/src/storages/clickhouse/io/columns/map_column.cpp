@@ -0,0 +1,57 @@
+#include <userver/storages/clickhouse/io/columns/map_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/array.h>
+#include <clickhouse/columns/map.h>
+#include <clickhouse/columns/numeric.h>
+#include <clickhouse/columns/tuple.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnMap;
+using NativeTupleType = clickhouse::impl::clickhouse_cpp::ColumnTuple;
+}  // namespace
+
+ColumnRef GetMapColumn(ColumnRef column) {
+  if (!column->As<NativeType>()) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Map",
+                    column->Type()->GetName())};
+  }
+
+  return column;
+}
+
+MapColumnMeta GetMapItemAt(const ColumnRef& column, size_t ind) {
+  UASSERT(column->As<NativeType>() != nullptr);
+  // Map(K, V) is stored as Array(Tuple(K, V))
+  const auto item = static_cast<NativeType*>(column.get())->GetAsColumn(ind);
+  const auto tuple = item->As<NativeTupleType>();
+  UINVARIANT(tuple && tuple->TupleSize() == 2, "Shouldn't happen");
+
+  MapColumnMeta result;
+  result.keys = (*tuple)[0];
+  result.values = (*tuple)[1];
+  return result;
+}
+
+ColumnRef ConvertMetaToColumn(MapColumnMeta&& meta,
+                              std::vector<uint64_t>&& offsets) {
+  auto tuple = std::make_shared<NativeTupleType>(
+      std::vector<ColumnRef>{std::move(meta.keys), std::move(meta.values)});
+  auto array = std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnArray>(
+      std::move(tuple),
+      std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnUInt64>(
+          std::move(offsets)));
+  return std::make_shared<NativeType>(std::move(array));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,7 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   writer["connections"] = stats.connections;
   writer["queries"] = stats.queries;
   writer["inserts"] = stats.inserts;
+  writer["inserted_rows"] = stats.inserted_rows;
 }
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -31,6 +32,12 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   writer["busy"] = stats.busy;
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PoolInsertedRowsStatistics& stats) {
+  writer["total"] = stats.total;
+  writer["batch_size"] = stats.batch_size;
+}
+
 }  // namespace storages::clickhouse::stats
 
 USERVER_NAMESPACE_END
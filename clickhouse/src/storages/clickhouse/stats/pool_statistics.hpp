@@ -1,5 +1,6 @@
 #pragma once
 
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 #include <userver/utils/statistics/relaxed_counter.hpp>
@@ -15,6 +16,9 @@ using Percentile =
     USERVER_NAMESPACE::utils::statistics::Percentile<2048, uint64_t, 16, 256>;
 using RecentPeriod =
     USERVER_NAMESPACE::utils::statistics::RecentPeriod<Percentile, Percentile>;
+using Histogram = USERVER_NAMESPACE::utils::statistics::Histogram<2, 24>;
+using RecentHistogram =
+    USERVER_NAMESPACE::utils::statistics::RecentPeriod<Histogram, Histogram>;
 
 struct PoolConnectionStatistics final {
   Counter overload{};
@@ -30,10 +34,17 @@ struct PoolQueryStatistics final {
   RecentPeriod timings{};
 };
 
+struct PoolInsertedRowsStatistics final {
+  Counter total{};
+  // rows count of the successful inserts
+  RecentHistogram batch_size{};
+};
+
 struct PoolStatistics final {
   PoolConnectionStatistics connections{};
   PoolQueryStatistics queries{};
   PoolQueryStatistics inserts{};
+  PoolInsertedRowsStatistics inserted_rows{};
 };
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -45,6 +56,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats);
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PoolInsertedRowsStatistics& stats);
+
 }  // namespace storages::clickhouse::stats
 
 USERVER_NAMESPACE_END
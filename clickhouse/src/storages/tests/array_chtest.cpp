@@ -0,0 +1,51 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithArrays final {
+  std::vector<std::vector<uint64_t>> numbers;
+  std::vector<std::vector<std::optional<std::string>>> strings;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithArrays> {
+  using mapped_type =
+      std::tuple<columns::ArrayColumn<columns::UInt64Column>,
+                 columns::ArrayColumn<
+                     columns::NullableColumn<columns::StringColumn>>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Array, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(numbers Array(UInt64), strings Array(Nullable(String)))");
+
+  const DataWithArrays insert_data{
+      {{1, 2, 3}, {}, {4}},
+      {{"a", std::nullopt}, {"b"}, {}},
+  };
+  cluster->Insert("tmp_table", {"numbers", "strings"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithArrays>();
+  EXPECT_EQ(select_data.numbers, insert_data.numbers);
+  EXPECT_EQ(select_data.strings, insert_data.strings);
+}
+
+USERVER_NAMESPACE_END
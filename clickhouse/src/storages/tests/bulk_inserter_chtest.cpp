@@ -0,0 +1,139 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/bulk_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+  uint64_t id{};
+  std::string payload;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+constexpr std::size_t kRowsCount = 25;
+
+storages::clickhouse::ClusterPtr AsClusterPtr(ClusterWrapper& cluster) {
+  // non-owning pointer, the cluster outlives the inserter
+  return {std::shared_ptr<void>{}, &*cluster};
+}
+
+std::size_t GetRowsCount(ClusterWrapper& cluster) {
+  return cluster
+      ->Execute("SELECT id, payload FROM bulk_inserter_table ORDER BY id")
+      .AsContainer<std::vector<EventRow>>()
+      .size();
+}
+
+class BulkInserterTable final {
+ public:
+  explicit BulkInserterTable(ClusterWrapper& cluster) : cluster_(cluster) {
+    cluster_->Execute(
+        "CREATE TABLE IF NOT EXISTS bulk_inserter_table "
+        "(id UInt64, payload String) ENGINE = Memory");
+    cluster_->Execute("TRUNCATE TABLE bulk_inserter_table");
+  }
+
+  ~BulkInserterTable() {
+    cluster_->Execute("DROP TABLE IF EXISTS bulk_inserter_table");
+  }
+
+ private:
+  ClusterWrapper& cluster_;
+};
+
+}  // namespace
+
+UTEST(BulkInserter, FlushesBatches) {
+  ClusterWrapper cluster{};
+  const BulkInserterTable table{cluster};
+
+  storages::clickhouse::BulkInserterSettings settings;
+  settings.max_batch_rows = 10;
+  {
+    storages::clickhouse::BulkInserter<EventRow> inserter{
+        AsClusterPtr(cluster), "bulk_inserter_table", {"id", "payload"},
+        settings};
+    for (std::size_t i = 0; i < kRowsCount; ++i) {
+      EXPECT_TRUE(inserter.Append({i, "event"}));
+    }
+  }
+
+  EXPECT_EQ(GetRowsCount(cluster), kRowsCount);
+
+  const auto stats = cluster.GetStatistics("clickhouse.inserted_rows");
+  EXPECT_EQ(stats.SingleMetric("total").AsInt(), kRowsCount);
+  // 2 full batches and the rest on destruction
+  EXPECT_EQ(stats.SingleMetric("batch_size").AsHistogram().GetTotalCount(), 3);
+}
+
+UTEST(BulkInserter, FlushInterval) {
+  ClusterWrapper cluster{};
+  const BulkInserterTable table{cluster};
+
+  storages::clickhouse::BulkInserterSettings settings;
+  settings.flush_interval = std::chrono::milliseconds{10};
+
+  storages::clickhouse::BulkInserter<EventRow> inserter{
+      AsClusterPtr(cluster), "bulk_inserter_table", {"id", "payload"},
+      settings};
+  for (std::size_t i = 0; i < kRowsCount; ++i) {
+    EXPECT_TRUE(inserter.TryAppend({i, "event"}));
+  }
+
+  while (GetRowsCount(cluster) != kRowsCount) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+}
+
+UTEST(BulkInserter, DropsFailedBatches) {
+  ClusterWrapper cluster{};
+
+  storages::clickhouse::BulkInserterSettings settings;
+  settings.max_batch_rows = 5;
+  settings.max_retries = 1;
+
+  utils::statistics::Storage storage;
+  storages::clickhouse::BulkInserter<EventRow> inserter{
+      AsClusterPtr(cluster), "nonexistent_table", {"id", "payload"}, settings};
+  const auto holder = storage.RegisterWriter(
+      "bulk_inserter", [&inserter](utils::statistics::Writer& writer) {
+        inserter.WriteStatistics(writer);
+      });
+
+  for (std::size_t i = 0; i < settings.max_batch_rows; ++i) {
+    EXPECT_TRUE(inserter.Append({i, "event"}));
+  }
+
+  while (true) {
+    const utils::statistics::Snapshot snapshot{storage, "bulk_inserter"};
+    if (snapshot.SingleMetric("rows.dropped").AsInt() != 0) {
+      EXPECT_EQ(snapshot.SingleMetric("rows.dropped").AsInt(),
+                settings.max_batch_rows);
+      EXPECT_EQ(snapshot.SingleMetric("rows.inserted").AsInt(), 0);
+      EXPECT_EQ(snapshot.SingleMetric("retries").AsInt(), 1);
+      break;
+    }
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+}
+
+USERVER_NAMESPACE_END
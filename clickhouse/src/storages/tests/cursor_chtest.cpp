@@ -0,0 +1,112 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/cursor.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct NumbersBlock final {
+  std::vector<uint64_t> numbers;
+};
+
+struct NumberRow final {
+  uint64_t number;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<NumbersBlock> final {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+template <>
+struct CppToClickhouse<NumberRow> final {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+constexpr uint64_t kRowsCount = 100'000;
+
+const storages::clickhouse::Query kNumbersQuery{
+    "SELECT number FROM system.numbers LIMIT 100000 "
+    "SETTINGS max_block_size = 1000"};
+
+}  // namespace
+
+UTEST(Cursor, ForEachRow) {
+  ClusterWrapper cluster{};
+
+  /// [Sample Cursor usage]
+  auto cursor = cluster->ExecuteStreaming(kNumbersQuery);
+
+  uint64_t sum = 0;
+  uint64_t rows_count = 0;
+  cursor.ForEachRow<NumberRow>([&sum, &rows_count](NumberRow&& row) {
+    sum += row.number;
+    ++rows_count;
+  });
+  /// [Sample Cursor usage]
+
+  EXPECT_EQ(rows_count, kRowsCount);
+  EXPECT_EQ(sum, kRowsCount * (kRowsCount - 1) / 2);
+}
+
+UTEST(Cursor, ForEachBlock) {
+  ClusterWrapper cluster{};
+
+  auto cursor = cluster->ExecuteStreaming(kNumbersQuery);
+
+  std::size_t blocks_count = 0;
+  uint64_t expected_number = 0;
+  cursor.ForEachBlock<NumbersBlock>([&](NumbersBlock&& block) {
+    ++blocks_count;
+    for (const auto number : block.numbers) {
+      EXPECT_EQ(number, expected_number++);
+    }
+  });
+
+  EXPECT_EQ(expected_number, kRowsCount);
+  EXPECT_GT(blocks_count, 1);
+  EXPECT_FALSE(cursor.NextBlock().has_value());
+}
+
+UTEST(Cursor, EmptyResult) {
+  ClusterWrapper cluster{};
+
+  auto cursor = cluster->ExecuteStreaming("SELECT number FROM numbers(0)");
+  EXPECT_FALSE(cursor.NextBlock().has_value());
+}
+
+UTEST(Cursor, QueryError) {
+  ClusterWrapper cluster{};
+
+  auto cursor = cluster->ExecuteStreaming("SELECT * FROM nonexistent_table");
+  UEXPECT_THROW(cursor.NextBlock(), std::exception);
+}
+
+UTEST(Cursor, EarlyDestruction) {
+  ClusterWrapper cluster{};
+
+  {
+    auto cursor = cluster->ExecuteStreaming(
+        "SELECT number FROM system.numbers SETTINGS max_block_size = 1000");
+    EXPECT_TRUE(cursor.NextBlock().has_value());
+  }
+
+  // the cluster is still usable after the query is cancelled
+  const auto result = cluster->Execute("SELECT 1");
+  EXPECT_EQ(result.GetRowsCount(), 1);
+}
+
+USERVER_NAMESPACE_END
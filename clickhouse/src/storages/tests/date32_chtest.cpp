@@ -0,0 +1,77 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithDates final {
+  std::vector<std::chrono::system_clock::time_point> dates;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithDates> {
+  using mapped_type = std::tuple<columns::Date32Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Date32, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Date32)");
+
+  using Days = std::chrono::duration<int64_t, std::ratio<86400>>;
+  const std::chrono::system_clock::time_point before_epoch{Days{-365}};
+  const std::chrono::system_clock::time_point after_epoch{Days{20000}};
+
+  const DataWithDates insert_data{{before_epoch, after_epoch}};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithDates>();
+  EXPECT_EQ(select_data.dates, insert_data.dates);
+}
+
+UTEST(Date32, InsertTimeOfDay) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Date32)");
+
+  using Days = std::chrono::duration<int64_t, std::ratio<86400>>;
+  using std::chrono::hours;
+  using TimePoint = std::chrono::system_clock::time_point;
+
+  // The time of day is dropped, pre-epoch times belong to the previous day
+  const DataWithDates insert_data{{
+      TimePoint{Days{-365} + hours{1}},
+      TimePoint{Days{-365} - hours{1}},
+      TimePoint{-std::chrono::seconds{1}},
+      TimePoint{Days{20000} + hours{23}},
+  }};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithDates>();
+  const std::vector<TimePoint> expected{
+      TimePoint{Days{-365}},
+      TimePoint{Days{-366}},
+      TimePoint{Days{-1}},
+      TimePoint{Days{20000}},
+  };
+  EXPECT_EQ(select_data.dates, expected);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#include <userver/utest/utest.hpp>
+
+#include <string_view>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Decimal4 = decimal64::Decimal<4>;
+
+struct DataWithDecimals final {
+  std::vector<Decimal4> decimals32;
+  std::vector<Decimal4> decimals64;
+  std::vector<Decimal4> decimals128;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithDecimals> {
+  using mapped_type =
+      std::tuple<columns::Decimal32Column<4>, columns::Decimal64Column<4>,
+                 columns::Decimal128Column<4>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Decimal, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(d32 Decimal32(4), d64 Decimal64(4), d128 Decimal128(4))");
+
+  const std::vector<Decimal4> values{Decimal4{"1.2345"}, Decimal4{"-0.0001"},
+                                     Decimal4{"12345.6789"}};
+  const DataWithDecimals insert_data{values, values, values};
+  cluster->Insert("tmp_table", {"d32", "d64", "d128"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithDecimals>();
+  EXPECT_EQ(select_data.decimals32, values);
+  EXPECT_EQ(select_data.decimals64, values);
+  EXPECT_EQ(select_data.decimals128, values);
+}
+
+UTEST(Decimal, PrecisionOverflow) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(d32 Decimal32(4), d64 Decimal64(4), d128 Decimal128(4))");
+
+  // Decimal32 keeps 9 digits and Decimal64 keeps 18 digits
+  const std::vector<Decimal4> max32{Decimal4{"99999.9999"},
+                                    Decimal4{"-99999.9999"}};
+  const std::vector<Decimal4> max64{Decimal4{"99999999999999.9999"},
+                                    Decimal4{"-99999999999999.9999"}};
+  const std::vector<Decimal4> over32{Decimal4{"100000"}, Decimal4{"1"}};
+  const std::vector<Decimal4> over64{Decimal4{"1"},
+                                     Decimal4{"-100000000000000"}};
+  const std::vector<std::string_view> columns{"d32", "d64", "d128"};
+
+  UEXPECT_THROW(cluster->Insert("tmp_table", columns,
+                                DataWithDecimals{over32, max64, max64}),
+                std::exception);
+  UEXPECT_THROW(cluster->Insert("tmp_table", columns,
+                                DataWithDecimals{max32, over64, max64}),
+                std::exception);
+
+  const DataWithDecimals insert_data{max32, max64, over64};
+  cluster->Insert("tmp_table", columns, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithDecimals>();
+  EXPECT_EQ(select_data.decimals32, max32);
+  EXPECT_EQ(select_data.decimals64, max64);
+  EXPECT_EQ(select_data.decimals128, over64);
+}
+
+UTEST(Decimal, ScaleMismatch) {
+  ClusterWrapper cluster{};
+
+  UEXPECT_THROW(cluster->Execute("SELECT toDecimal64(1, 2), "
+                                 "toDecimal64(1, 2), toDecimal128(1, 2)")
+                    .As<DataWithDecimals>(),
+                std::exception);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,57 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithFixedStrings final {
+  std::vector<std::string> strings;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithFixedStrings> {
+  using mapped_type = std::tuple<columns::FixedStringColumn<4>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(FixedString, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value FixedString(4))");
+
+  const DataWithFixedStrings insert_data{{"abcd", "ab"}};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithFixedStrings>();
+  ASSERT_EQ(select_data.strings.size(), 2);
+  EXPECT_EQ(select_data.strings[0], "abcd");
+  EXPECT_EQ(select_data.strings[1], std::string("ab\0\0", 4));
+}
+
+UTEST(FixedString, TooLong) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value FixedString(4))");
+
+  const DataWithFixedStrings insert_data{{"abcde"}};
+  UEXPECT_THROW(cluster->Insert("tmp_table", {"value"}, insert_data),
+                std::exception);
+}
+
+USERVER_NAMESPACE_END
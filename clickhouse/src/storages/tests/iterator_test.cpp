@@ -31,12 +31,22 @@ struct IteratorDefaultConstructorInstantiator final {
     columns::MismatchedEndiannessUuidColumn,  //
     columns::UuidRfc4122Column,               //
 
+    columns::Date32Column,           //
     columns::DateTimeColumn,         //
     columns::DateTime64ColumnMilli,  //
     columns::DateTime64ColumnMicro,  //
     columns::DateTime64ColumnNano,   //
 
-    columns::StringColumn,  //
+    columns::Decimal32Column<2>,     //
+    columns::Decimal64Column<6>,     //
+    columns::Decimal128Column<18>,   //
+
+    columns::StringColumn,                //
+    columns::FixedStringColumn<16>,       //
+    columns::LowCardinalityStringColumn,  //
+
+    columns::ArrayColumn<columns::UInt64Column>,                       //
+    columns::MapColumn<columns::StringColumn, columns::UInt64Column>,  //
 
     columns::Float32Column,  //
     columns::Float64Column   //
@@ -0,0 +1,51 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using StringToNumberMap = std::vector<std::pair<std::string, uint64_t>>;
+
+struct DataWithMaps final {
+  std::vector<StringToNumberMap> maps;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithMaps> {
+  using mapped_type = std::tuple<
+      columns::MapColumn<columns::StringColumn, columns::UInt64Column>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Map, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Map(String, UInt64))");
+
+  const DataWithMaps insert_data{{
+      {{"a", 1}, {"b", 2}},
+      {},
+      {{"c", 3}},
+  }};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT * FROM tmp_table").As<DataWithMaps>();
+  EXPECT_EQ(select_data.maps, insert_data.maps);
+}
+
+USERVER_NAMESPACE_END
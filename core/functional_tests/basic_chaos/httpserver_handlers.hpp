@@ -50,4 +50,25 @@ class HttpServerHandler final : public server::handlers::HttpHandlerBase {
   }
 };
 
+class RequestBodyStreamHandler final
+    : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName =
+      "handler-chaos-httpserver-request-body-stream";
+
+  RequestBodyStreamHandler(const components::ComponentConfig& config,
+                           const components::ComponentContext& context)
+      : HttpHandlerBase(config, context) {}
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest& request,
+      server::request::RequestContext&) const override {
+    // The rest of the body is discarded by the server if it is not read
+    if (request.GetArg("read") == "true") {
+      return std::to_string(request.GetBodyStream().ReadAll().size());
+    }
+    return HttpServerHandler::kDefaultAnswer;
+  }
+};
+
 }  // namespace chaos
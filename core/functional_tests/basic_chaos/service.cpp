@@ -20,6 +20,7 @@ int main(int argc, char* argv[]) {
           .Append<chaos::HttpClientHandler>()
           .Append<chaos::StreamHandler>()
           .Append<chaos::HttpServerHandler>()
+          .Append<chaos::RequestBodyStreamHandler>()
           .Append<chaos::ResolverHandler>()
           .Append<components::LoggingConfigurator>()
           .Append<components::HttpClient>()
@@ -0,0 +1,46 @@
+import asyncio
+
+# More than the server buffers for a handler that does not read the body
+BODY_SIZE = 512 * 1024
+TIMEOUT = 5.0
+PATH = '/chaos/httpserver/request-body-stream'
+
+
+def _make_request(body: bytes, read: bool) -> bytes:
+    return (
+        f'POST {PATH}?read={str(read).lower()} HTTP/1.1\r\n'
+        'Host: localhost\r\n'
+        f'Content-Length: {len(body)}\r\n'
+        '\r\n'
+    ).encode() + body
+
+
+async def _read_response(reader: asyncio.StreamReader):
+    headers = await reader.readuntil(b'\r\n\r\n')
+    status_line, *header_lines = headers.decode().split('\r\n')
+    content_length = 0
+    for line in header_lines:
+        name, _, value = line.partition(':')
+        if name.strip().lower() == 'content-length':
+            content_length = int(value)
+    body = await reader.readexactly(content_length)
+    return int(status_line.split(' ')[1]), body
+
+
+async def test_body_not_read(service_client, service_port):
+    reader, writer = await asyncio.open_connection('localhost', service_port)
+    try:
+        writer.write(_make_request(b'a' * BODY_SIZE, read=False))
+        status, body = await asyncio.wait_for(_read_response(reader), TIMEOUT)
+        assert status == 200
+        assert body == b'OK!'
+
+        # The server discards the rest of the body and reads the next request
+        # from the same connection
+        await asyncio.wait_for(writer.drain(), TIMEOUT)
+        writer.write(_make_request(b'b' * 10, read=True))
+        status, body = await asyncio.wait_for(_read_response(reader), TIMEOUT)
+        assert status == 200
+        assert body == b'10'
+    finally:
+        writer.close()
@@ -91,10 +91,34 @@ class WebsocketsFullDuplexHandler final
   }
 };
 
+class WebsocketsPreparedHandler final
+    : public server::websocket::WebsocketHandlerBase {
+ public:
+  static constexpr std::string_view kName = "websocket-prepared-handler";
+
+  using WebsocketHandlerBase::WebsocketHandlerBase;
+
+  void Handle(server::websocket::WebSocketConnection& chat,
+              server::request::RequestContext&) const override {
+    server::websocket::Message message;
+    while (!engine::current_task::ShouldCancel()) {
+      chat.Recv(message);
+      if (message.close_status) break;
+
+      // the frame is encoded once and sent twice
+      const server::websocket::PreparedMessage prepared{message.data,
+                                                        message.is_text};
+      chat.SendPrepared(prepared);
+      chat.SendPrepared(prepared);
+    }
+  }
+};
+
 int main(int argc, char* argv[]) {
   const auto component_list = components::MinimalServerComponentList()
                                   .Append<WebsocketsHandler>()
                                   .Append<WebsocketsFullDuplexHandler>()
+                                  .Append<WebsocketsPreparedHandler>()
                                   .Append<clients::dns::Component>()
                                   .Append<components::HttpClient>()
                                   .Append<components::TestsuiteSupport>()
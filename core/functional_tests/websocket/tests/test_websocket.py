@@ -86,3 +86,38 @@ async def test_two(websocket_client):
             for _ in range(10):
                 msg = await chat1.recv()
                 assert msg == b'A'
+
+
+async def test_compressed(service_client, service_port):
+    async with websockets.connect(
+            f'ws://localhost:{service_port}/chat',
+    ) as chat:
+        assert chat.extensions[0].name == 'permessage-deflate'
+        for i in range(10):
+            msg = f'hello {i}' * 1000
+            await chat.send(msg)
+            response = await chat.recv()
+            assert response == msg
+
+
+async def test_not_compressed(service_client, service_port):
+    async with websockets.connect(
+            f'ws://localhost:{service_port}/chat', compression=None,
+    ) as chat:
+        assert not chat.extensions
+        await chat.send('hello')
+        response = await chat.recv()
+        assert response == 'hello'
+
+
+async def test_prepared(service_client, service_port):
+    for compression in ('deflate', None):
+        async with websockets.connect(
+                f'ws://localhost:{service_port}/prepared',
+                compression=compression,
+        ) as chat:
+            for i in range(10):
+                msg = f'hello {i}' * 1000
+                await chat.send(msg)
+                assert await chat.recv() == msg
+                assert await chat.recv() == msg
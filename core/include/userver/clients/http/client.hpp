@@ -90,6 +90,9 @@ class Client final {
   // For internal use only.
   void SetMaxHostConnections(size_t max_host_connections);
 
+  // For internal use only.
+  void SetMaxConcurrentStreams(size_t max_concurrent_streams);
+
   // For internal use only.
   PoolStatistics GetPoolStatistics() const;
 
@@ -38,6 +38,9 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// multiplexing-enabled | whether to multiplex concurrent requests to the same host over a single HTTP/2 connection | true
+/// max-host-connections | max number of connections to a single host per IO thread, 0 for unlimited | 0
+/// http2-max-concurrent-streams | max number of concurrent streams per HTTP/2 connection, also limited by the server SETTINGS | 100
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
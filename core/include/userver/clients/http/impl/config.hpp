@@ -28,6 +28,9 @@ struct ClientSettings final {
   std::string thread_name_prefix{};
   size_t io_threads{8};
   bool defer_events{false};
+  bool multiplexing_enabled{true};
+  size_t max_host_connections{0};
+  size_t max_concurrent_streams{100};
   DeadlinePropagationConfig deadline_propagation{};
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
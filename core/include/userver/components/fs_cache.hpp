@@ -24,6 +24,7 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// zero-copy         | keep the files opened instead of reading them into memory, server::handlers::HttpHandlerStatic sends them with sendfile | false
 
 // clang-format on
 
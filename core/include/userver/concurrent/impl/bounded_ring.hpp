@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// std::hardware_destructive_interference_size is not used in the public
+// header, because its value depends on the compiler flags
+inline constexpr std::size_t kBoundedRingAlignment = 64;
+
+/// @brief Lock-free bounded multiple producers multiple consumers FIFO queue
+/// over a fixed array of slots.
+///
+/// Each slot is padded to a cache line, so neighbouring producers and
+/// consumers do not share cache lines. Based on the algorithm by Dmitry Vyukov:
+/// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+///
+/// @note TryPush may fail while a consumer is still moving out of the slot
+/// that is the next one to be written, and TryPop may fail while a producer is
+/// still writing the next slot to be read.
+template <typename T>
+class BoundedRing final {
+ public:
+  /// @param capacity the minimal capacity, rounded up to a power of two
+  explicit BoundedRing(std::size_t capacity)
+      : capacity_(RoundUpCapacity(capacity)),
+        mask_(capacity_ - 1),
+        slots_(std::make_unique<Slot[]>(capacity_)) {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedRing(BoundedRing&&) = delete;
+  BoundedRing& operator=(BoundedRing&&) = delete;
+
+  ~BoundedRing() {
+    T value;
+    while (TryPop(value)) {
+    }
+  }
+
+  std::size_t GetCapacity() const noexcept { return capacity_; }
+
+  /// Leaves the `value` unmodified if the operation does not succeed.
+  [[nodiscard]] bool TryPush(T&& value) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[pos & mask_];
+      const auto sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    ::new (static_cast<void*>(&slot->storage)) T(std::move(value));
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool TryPop(T& value) {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[pos & mask_];
+      const auto sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    auto* stored = std::launder(reinterpret_cast<T*>(&slot->storage));
+    value = std::move(*stored);
+    stored->~T();
+    slot->sequence.store(pos + capacity_, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct alignas(kBoundedRingAlignment) Slot final {
+    std::atomic<std::size_t> sequence{0};
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+  };
+
+  static std::size_t RoundUpCapacity(std::size_t capacity) {
+    // sequence numbers are compared as signed values
+    UINVARIANT(capacity <= (std::size_t{1} << 30),
+               "Too large capacity for a bounded queue");
+    std::size_t result = 2;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  const std::size_t capacity_;
+  const std::size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  alignas(kBoundedRingAlignment) std::atomic<std::size_t> enqueue_pos_{0};
+  alignas(kBoundedRingAlignment) std::atomic<std::size_t> dequeue_pos_{0};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/concurrent/impl/bounded_ring.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
@@ -30,6 +34,7 @@ struct SimpleQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsBoundedRing{false};
 };
 
 template <bool MultipleProducer, bool MultipleConsumer>
@@ -41,6 +46,18 @@ struct ContainerQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsBoundedRing{false};
+};
+
+struct BoundedRingQueuePolicy {
+  template <typename T>
+  static constexpr std::size_t GetElementSize(const T&) {
+    return 1;
+  }
+
+  static constexpr bool kIsMultipleProducer{true};
+  static constexpr bool kIsMultipleConsumer{true};
+  static constexpr bool kIsBoundedRing{true};
 };
 
 }  // namespace impl
@@ -56,11 +73,17 @@ class GenericQueue final
     explicit EmplaceEnabler() = default;
   };
 
+  using LockFreeQueue =
+      std::conditional_t<QueuePolicy::kIsBoundedRing, impl::BoundedRing<T>,
+                         moodycamel::ConcurrentQueue<T>>;
+
   using ProducerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
+      std::conditional_t<QueuePolicy::kIsMultipleProducer &&
+                             !QueuePolicy::kIsBoundedRing,
                          moodycamel::ProducerToken, impl::NoToken>;
   using ConsumerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
+      std::conditional_t<QueuePolicy::kIsMultipleProducer &&
+                             !QueuePolicy::kIsBoundedRing,
                          moodycamel::ConsumerToken, impl::NoToken>;
   using MultiProducerToken = impl::MultiToken;
   using MultiConsumerToken =
@@ -94,7 +117,7 @@ class GenericQueue final
   /// @cond
   // For internal use only
   explicit GenericQueue(std::size_t max_size, EmplaceEnabler /*unused*/)
-      : queue_(),
+      : queue_(QueuePolicy::kIsBoundedRing ? max_size * kBoundedRingSlack : 1),
         single_producer_token_(queue_),
         producer_side_(*this, std::min(max_size, kUnbounded)),
         consumer_side_(*this) {}
@@ -121,9 +144,15 @@ class GenericQueue final
   GenericQueue& operator=(const GenericQueue&) = delete;
   /// @endcond
 
+  /// Create a new unbounded queue
+  static std::shared_ptr<GenericQueue> Create() {
+    static_assert(!QueuePolicy::kIsBoundedRing,
+                  "The max_size is required for a bounded queue");
+    return Create(kUnbounded);
+  }
+
   /// Create a new queue
-  static std::shared_ptr<GenericQueue> Create(
-      std::size_t max_size = kUnbounded) {
+  static std::shared_ptr<GenericQueue> Create(std::size_t max_size) {
     return std::make_shared<GenericQueue>(max_size, EmplaceEnabler{});
   }
 
@@ -183,7 +212,12 @@ class GenericQueue final
 
   /// @brief Sets the limit on the queue size, pushes over this limit will block
   /// @note This is a soft limit and may be slightly overrun under load.
+  /// @note The limit of a bounded queue can not exceed the `max_size` passed
+  /// to `Create` rounded up to a power of two.
   void SetSoftMaxSize(std::size_t max_size) {
+    if constexpr (QueuePolicy::kIsBoundedRing) {
+      max_size = std::min(max_size, queue_.GetCapacity() / kBoundedRingSlack);
+    }
     producer_side_.SetSoftMaxSize(std::min(max_size, kUnbounded));
   }
 
@@ -223,11 +257,26 @@ class GenericQueue final
     return producer_side_.PushNoblock(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PushMany(Token& token, T* values,
+                                     std::size_t count,
+                                     engine::Deadline deadline) {
+    return producer_side_.PushMany(token, values, count, deadline);
+  }
+
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
     return consumer_side_.Pop(token, value, deadline);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopMany(token, values, max_count, deadline);
+  }
+
   template <typename Token>
   [[nodiscard]] bool PopNoblock(Token& token, T& value) {
     return consumer_side_.PopNoblock(token, value);
@@ -287,9 +336,22 @@ class GenericQueue final
   /// @endcond
 
  private:
+  // The room is reserved by the producer side, so the ring is full only while
+  // a consumer is still moving a value out of the slot to be written. That
+  // slot is an older one than the last popped, and the spare slots make it
+  // rare.
+  void PushToRing(T&& value) {
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    while (!queue_.TryPush(std::move(value))) {
+      std::this_thread::yield();
+    }
+  }
+
   template <typename Token>
   void DoPush(Token& token, T&& value) {
-    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+    if constexpr (QueuePolicy::kIsBoundedRing) {
+      PushToRing(std::move(value));
+    } else if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       queue_.enqueue(token, std::move(value));
     } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
@@ -304,11 +366,36 @@ class GenericQueue final
     consumer_side_.OnElementPushed();
   }
 
+  template <typename Token>
+  void DoPushMany(Token& token, T* values, std::size_t count) {
+    UASSERT(count > 0);
+    if constexpr (QueuePolicy::kIsBoundedRing) {
+      for (std::size_t i = 0; i < count; ++i) {
+        PushToRing(std::move(values[i]));
+      }
+    } else if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, std::make_move_iterator(values), count);
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(std::make_move_iterator(values), count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_,
+                          std::make_move_iterator(values), count);
+    }
+
+    consumer_side_.OnElementsPushed(count);
+  }
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
 
-    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+    if constexpr (QueuePolicy::kIsBoundedRing) {
+      success = queue_.TryPop(value);
+    } else if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       success = queue_.try_dequeue(token, value);
     } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
@@ -328,7 +415,49 @@ class GenericQueue final
     return false;
   }
 
-  moodycamel::ConcurrentQueue<T> queue_{1};
+  // Appends up to `max_count` elements to `values`
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const std::size_t old_size = values.size();
+    std::size_t count{};
+
+    if constexpr (QueuePolicy::kIsBoundedRing) {
+      T value;
+      while (count < max_count && queue_.TryPop(value)) {
+        values.push_back(std::move(value));
+        ++count;
+      }
+    } else if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count =
+          queue_.try_dequeue_bulk(token, std::back_inserter(values), max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(std::back_inserter(values), max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(
+          single_producer_token_, std::back_inserter(values), max_count);
+    }
+
+    if (count != 0) {
+      producer_side_.OnElementPopped(
+          GetElementsSize(values.data() + old_size, count));
+    }
+    return count;
+  }
+
+  static std::size_t GetElementsSize(const T* values, std::size_t count) {
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      size += QueuePolicy::GetElementSize(values[i]);
+    }
+    return size;
+  }
+
+  LockFreeQueue queue_;
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
 
@@ -341,6 +470,8 @@ class GenericQueue final
       std::numeric_limits<std::size_t>::max();
   static constexpr std::size_t kSemaphoreUnlockValue =
       std::numeric_limits<std::size_t>::max() / 2;
+  // Ring slots per an element of the bounded queue, see PushToRing
+  static constexpr std::size_t kBoundedRingSlack = 2;
 };
 
 // Single-producer ProducerSide implementation
@@ -368,6 +499,20 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return DoPush(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PushMany(Token& token, T* values,
+                                     std::size_t count,
+                                     engine::Deadline deadline) {
+    std::size_t pushed = DoPushMany(token, values, count);
+    while (pushed < count && non_full_event_.WaitForEventUntil(deadline)) {
+      const std::size_t chunk =
+          DoPushMany(token, values + pushed, count - pushed);
+      if (chunk == 0 && queue_.NoMoreConsumers()) break;
+      pushed += chunk;
+    }
+    return pushed;
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -406,6 +551,31 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  // Pushes the longest prefix of `values` that fits into the queue
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPushMany(Token& token, T* values,
+                                       std::size_t count) {
+    if (queue_.NoMoreConsumers()) return 0;
+
+    const std::size_t free_capacity =
+        total_capacity_.load() - std::min(used_capacity_.load(),
+                                          total_capacity_.load());
+    std::size_t fit_count = 0;
+    std::size_t fit_size = 0;
+    for (; fit_count < count; ++fit_count) {
+      const std::size_t value_size =
+          QueuePolicy::GetElementSize(values[fit_count]);
+      if (fit_size + value_size > free_capacity) break;
+      fit_size += value_size;
+    }
+    if (fit_count == 0) return 0;
+
+    used_capacity_.fetch_add(fit_size);
+    queue_.DoPushMany(token, values, fit_count);
+    non_full_event_.Reset();
+    return fit_count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -438,6 +608,40 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value));
   }
 
+  // Waits for the room for the first element only and pushes as many of the
+  // following elements as fit without waiting, with a single semaphore
+  // operation in the common case
+  template <typename Token>
+  [[nodiscard]] std::size_t PushMany(Token& token, T* values,
+                                     std::size_t count,
+                                     engine::Deadline deadline) {
+    std::size_t pushed = 0;
+    while (pushed < count) {
+      const std::size_t first_size = QueuePolicy::GetElementSize(values[pushed]);
+      if (!remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                           first_size)) {
+        break;
+      }
+
+      std::size_t extra_count = count - pushed - 1;
+      std::size_t extra_size = 0;
+      while (extra_count > 0) {
+        extra_size = GetElementsSize(values + pushed + 1, extra_count);
+        if (remaining_capacity_.try_lock_shared_count(extra_size)) break;
+        extra_count /= 2;
+      }
+
+      if (queue_.NoMoreConsumers()) {
+        remaining_capacity_.unlock_shared_count(
+            first_size + (extra_count > 0 ? extra_size : 0));
+        break;
+      }
+      queue_.DoPushMany(token, values + pushed, extra_count + 1);
+      pushed += extra_count + 1;
+    }
+    return pushed;
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -508,11 +712,30 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    std::size_t popped = 0;
+    while ((popped = DoPopMany(token, values, max_count)) == 0) {
+      if (queue_.NoMoreProducers() ||
+          !nonempty_event_.WaitForEventUntil(deadline)) {
+        return DoPopMany(token, values, max_count);
+      }
+    }
+    return popped;
+  }
+
   void OnElementPushed() {
     ++element_count_;
     nonempty_event_.Send();
   }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
+    nonempty_event_.Send();
+  }
+
   void StopBlockingOnPop() { nonempty_event_.Send(); }
 
   void ResumeBlockingOnPop() {}
@@ -530,6 +753,17 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const std::size_t count = queue_.DoPopMany(token, values, max_count);
+    if (count != 0) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -561,8 +795,28 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  // Waits for the first element only and takes as many of the elements
+  // already in the queue as possible with a single semaphore operation
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+
+    std::size_t extra_count = std::min(max_count - 1, GetElementCount());
+    while (extra_count > 0 &&
+           !element_count_.try_lock_shared_count(extra_count)) {
+      extra_count /= 2;
+    }
+    return DoPopMany(token, values, extra_count + 1);
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -598,6 +852,21 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // Pops exactly `count` elements which were accounted by the semaphore
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t count) {
+    std::size_t popped = 0;
+    while (popped < count) {
+      popped += queue_.DoPopMany(token, values, count - popped);
+      if (popped < count && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(count - popped);
+        break;
+      }
+    }
+    return popped;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
@@ -620,6 +889,20 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
 template <typename T>
 using NonFifoMpmcQueue = GenericQueue<T, impl::SimpleQueuePolicy<true, true>>;
 
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded multiple producers multiple consumers FIFO queue.
+///
+/// Elements are stored in a preallocated array of cache line padded slots,
+/// pushes and pops do not allocate. The `max_size` passed to `Create` is
+/// required and is rounded up to a power of two. The array has twice as many
+/// slots, each taking at least a cache line, so that a push rarely waits for a
+/// slow consumer to free its slot.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpmcQueue = GenericQueue<T, impl::BoundedRingQueuePolicy>;
+
 /// @ingroup userver_concurrency
 ///
 /// @brief Non FIFO multiple producers single consumer queue.
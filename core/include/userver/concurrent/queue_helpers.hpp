@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 
@@ -63,6 +64,20 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push elements into queue in order. May wait asynchronously if the queue
+  /// is full. Moves out the pushed elements and leaves the rest of `values`
+  /// unmodified, the size of `values` is not changed.
+  ///
+  /// Pushing a batch takes fewer synchronization operations and context
+  /// switches than pushing the elements one by one.
+  /// @returns the number of elements pushed before the deadline and before the
+  /// task was canceled.
+  [[nodiscard]] std::size_t PushMany(std::vector<ValueType>& values,
+                                     engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, values.data(), values.size(), deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -124,6 +139,17 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue and append them to `values`.
+  /// May wait asynchronously if the queue is empty, but the producer is alive.
+  /// Does not wait for more elements once at least one is popped.
+  /// @returns the number of popped elements, 0 if nothing was popped before
+  /// the deadline or if the producer is no longer alive.
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, max_count, deadline);
+  }
+
   /// Const access to source queue.
   [[nodiscard]] std::shared_ptr<const QueueType> Queue() const {
     return {queue_};
@@ -0,0 +1,281 @@
+#pragma once
+
+/// @file userver/concurrent/sharded_map.hpp
+/// @brief @copybrief concurrent::ShardedMap
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// Default ShardedMap traits, same as rcu::DefaultRcuMapTraits
+template <typename Key, typename Value>
+using DefaultShardedMapTraits = rcu::DefaultRcuMapTraits<Key, Value>;
+
+/// @brief Forward iterator for the concurrent::ShardedMap
+///
+/// Use member functions of concurrent::ShardedMap to retrieve the iterator.
+template <typename MapPtr, typename ShardIterator>
+class ShardedMapIterator final {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = ptrdiff_t;
+  using value_type = typename ShardIterator::value_type;
+  using reference = typename ShardIterator::reference;
+  using pointer = typename ShardIterator::pointer;
+
+  ShardedMapIterator() = default;
+
+  ShardedMapIterator operator++(int) {
+    ShardedMapIterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  ShardedMapIterator& operator++() {
+    ++it_;
+    SkipEmptyShards();
+    return *this;
+  }
+
+  reference operator*() const { return *it_; }
+  pointer operator->() const { return it_.operator->(); }
+
+  bool operator==(const ShardedMapIterator& rhs) const {
+    if (!map_ || !rhs.map_) return map_ == rhs.map_;
+    return shard_ == rhs.shard_ && it_ == rhs.it_;
+  }
+  bool operator!=(const ShardedMapIterator& rhs) const {
+    return !(*this == rhs);
+  }
+
+  /// @cond
+  /// For internal use only
+  explicit ShardedMapIterator(MapPtr map)
+      : map_(map), it_(map_->ShardBegin(0)) {
+    SkipEmptyShards();
+  }
+  /// @endcond
+
+ private:
+  void SkipEmptyShards() {
+    while (it_ == ShardIterator{}) {
+      if (++shard_ == map_->shard_count_) {
+        map_ = nullptr;
+        return;
+      }
+      it_ = map_->ShardBegin(shard_);
+    }
+  }
+
+  MapPtr map_{nullptr};
+  std::size_t shard_{0};
+  ShardIterator it_;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Concurrent hash map with the rcu::RcuMap interface that scales on
+/// frequent keyset changes.
+///
+/// The keys are distributed over a fixed number of rcu::RcuMap shards by
+/// their hash, so a keyset change copies only a single shard and changes of
+/// different shards do not block each other. Reads stay wait-free.
+///
+/// Unlike rcu::RcuMap, the keyset snapshot is taken per shard: iteration and
+/// GetSnapshot() see each shard consistently, but changes of the shards that
+/// are not iterated yet are visible. There is no StartWrite() for the same
+/// reason.
+///
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet concurrent/sharded_map_test.cpp  Sample concurrent::ShardedMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value,
+          typename Traits = DefaultShardedMapTraits<Key, Value>>
+class ShardedMap final {
+  using Shard = rcu::RcuMap<Key, Value, Traits>;
+
+ public:
+  static constexpr std::size_t kDefaultShardCount = 64;
+
+  using Hash = typename Shard::Hash;
+  using KeyEqual = typename Shard::KeyEqual;
+  using ValuePtr = typename Shard::ValuePtr;
+  using ConstValuePtr = typename Shard::ConstValuePtr;
+  using Iterator =
+      ShardedMapIterator<ShardedMap*, typename Shard::Iterator>;
+  using ConstIterator =
+      ShardedMapIterator<const ShardedMap*, typename Shard::ConstIterator>;
+  using RawMap = typename Shard::RawMap;
+  using Snapshot = typename Shard::Snapshot;
+  using InsertReturnType = typename Shard::InsertReturnType;
+
+  /// @param shard_count rounded up to a power of 2
+  explicit ShardedMap(std::size_t shard_count = kDefaultShardCount);
+
+  ShardedMap(const ShardedMap&) = delete;
+  ShardedMap(ShardedMap&&) = delete;
+  ShardedMap& operator=(const ShardedMap&) = delete;
+  ShardedMap& operator=(ShardedMap&&) = delete;
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const;
+
+  /// @name Iteration support
+  /// @details Keyset of each shard is fixed when the iteration reaches it.
+  /// @{
+  ConstIterator begin() const { return ConstIterator{this}; }
+  ConstIterator end() const { return {}; }
+  Iterator begin() { return Iterator{this}; }
+  Iterator end() { return {}; }
+  /// @}
+
+  /// @brief Returns a readonly value pointer by its key if exists
+  /// @throws rcu::MissingKeyException if the key is not present
+  const ConstValuePtr operator[](const Key& key) const {
+    return GetShard(key)[key];
+  }
+
+  /// @brief Returns a modifiable value pointer by key if exists or
+  /// default-creates one
+  /// @note Copies a single shard if the key doesn't exist.
+  const ValuePtr operator[](const Key& key) { return GetShard(key)[key]; }
+
+  /// @copydoc rcu::RcuMap::Insert
+  InsertReturnType Insert(const Key& key, ValuePtr value) {
+    return GetShard(key).Insert(key, std::move(value));
+  }
+
+  /// @copydoc rcu::RcuMap::Emplace
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args) {
+    return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @copydoc rcu::RcuMap::TryEmplace
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args) {
+    return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @copydoc rcu::RcuMap::InsertOrAssign
+  template <typename RawKey>
+  void InsertOrAssign(RawKey&& key, ValuePtr value) {
+    auto& shard = GetShard(key);
+    shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+  }
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  const ConstValuePtr Get(const Key& key) const {
+    return GetShard(key).Get(key);
+  }
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  const ValuePtr Get(const Key& key) { return GetShard(key).Get(key); }
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies a single shard.
+  bool Erase(const Key& key) { return GetShard(key).Erase(key); }
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  /// @note Copies a single shard.
+  ValuePtr Pop(const Key& key) { return GetShard(key).Pop(key); }
+
+  /// Resets the map to an empty state, shard by shard
+  void Clear();
+
+  /// Replace current data by data from `new_map`, shard by shard
+  void Assign(RawMap new_map);
+
+  /// @brief Returns a readonly copy of the map
+  Snapshot GetSnapshot() const { return {begin(), end()}; }
+
+ private:
+  template <typename MapPtr, typename ShardIterator>
+  friend class ShardedMapIterator;
+
+  std::size_t GetShardIndex(const Key& key) const;
+
+  auto ShardBegin(std::size_t index) { return shards_[index].begin(); }
+  auto ShardBegin(std::size_t index) const {
+    return std::as_const(shards_[index]).begin();
+  }
+
+  Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+  const Shard& GetShard(const Key& key) const {
+    return shards_[GetShardIndex(key)];
+  }
+
+  std::size_t shard_count_;
+  std::size_t shard_bits_;
+  std::unique_ptr<Shard[]> shards_;
+};
+
+template <typename Key, typename Value, typename Traits>
+ShardedMap<Key, Value, Traits>::ShardedMap(std::size_t shard_count)
+    : shard_count_(1), shard_bits_(0) {
+  while (shard_count_ < shard_count) {
+    shard_count_ <<= 1;
+    ++shard_bits_;
+  }
+  shards_ = std::make_unique<Shard[]>(shard_count_);
+}
+
+template <typename Key, typename Value, typename Traits>
+std::size_t ShardedMap<Key, Value, Traits>::SizeApprox() const {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    size += shards_[i].SizeApprox();
+  }
+  return size;
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Clear() {
+  for (std::size_t i = 0; i < shard_count_; ++i) shards_[i].Clear();
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Assign(RawMap new_map) {
+  auto shard_maps = std::make_unique<RawMap[]>(shard_count_);
+  while (!new_map.empty()) {
+    auto node = new_map.extract(new_map.begin());
+    shard_maps[GetShardIndex(node.key())].insert(std::move(node));
+  }
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    shards_[i].Assign(std::move(shard_maps[i]));
+  }
+}
+
+template <typename Key, typename Value, typename Traits>
+std::size_t ShardedMap<Key, Value, Traits>::GetShardIndex(
+    const Key& key) const {
+  if (shard_bits_ == 0) return 0;
+
+  // The shard maps use the low bits of the same hash for their buckets, take
+  // the high bits of the mixed hash instead
+  const auto hash = static_cast<std::uint64_t>(Hash{}(key));
+  const auto mixed = hash * std::uint64_t{0x9E3779B97F4A7C15};
+  const auto index = static_cast<std::size_t>(mixed >> (64 - shard_bits_));
+  UASSERT(index < shard_count_);
+  return index;
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
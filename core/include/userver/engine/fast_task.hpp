@@ -0,0 +1,113 @@
+#pragma once
+
+/// @file userver/engine/fast_task.hpp
+/// @brief Stackless tasks for short non-blocking callbacks
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+class FastTaskBase {
+ public:
+  FastTaskBase(Deadline deadline, bool is_critical) noexcept
+      : deadline_(deadline), is_critical_(is_critical) {}
+
+  FastTaskBase(const FastTaskBase&) = delete;
+  FastTaskBase& operator=(const FastTaskBase&) = delete;
+  virtual ~FastTaskBase() = default;
+
+  virtual void Run() = 0;
+
+  Deadline GetDeadline() const noexcept { return deadline_; }
+
+  bool IsCritical() const noexcept { return is_critical_; }
+
+ private:
+  const Deadline deadline_;
+  const bool is_critical_;
+};
+
+template <typename Function>
+class FastTaskImpl final : public FastTaskBase {
+ public:
+  template <typename F>
+  FastTaskImpl(Deadline deadline, bool is_critical, F&& f)
+      : FastTaskBase(deadline, is_critical), f_(std::forward<F>(f)) {}
+
+  void Run() override { f_(); }
+
+ private:
+  Function f_;
+};
+
+void DoSubmitFastTask(TaskProcessor& task_processor,
+                      std::unique_ptr<FastTaskBase>&& task);
+
+template <typename Function>
+void SubmitFastTask(TaskProcessor& task_processor, Deadline deadline,
+                    bool is_critical, Function&& f) {
+  static_assert(std::is_invocable_r_v<void, std::decay_t<Function>&>,
+                "A fast task must be callable without arguments");
+  DoSubmitFastTask(task_processor,
+                   std::make_unique<FastTaskImpl<std::decay_t<Function>>>(
+                       deadline, is_critical, std::forward<Function>(f)));
+}
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Runs a short non-blocking function directly on a worker thread of
+/// the task processor, without a coroutine and its stack.
+///
+/// A fast task costs a single small allocation and no context switches, so it
+/// suits fan-out callbacks that only update counters or hand data over to
+/// non-blocking primitives. Fast tasks share the queue with the ordinary
+/// tasks of the task processor and are detached: there is no way to wait for
+/// them.
+///
+/// The function must not block and must not suspend: no waiting on engine
+/// primitives, no engine::current_task functions, no blocking syscalls. Such
+/// calls are caught by assertions in debug builds, and the fast task is
+/// reported in logs if it runs longer than the task processor profiler
+/// threshold (see @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG).
+///
+/// Like a task that is cancelled before it starts, the fast task is dropped
+/// without calling the function if its deadline expires while it waits in the
+/// queue, if the task processor is overloaded and cancels the tasks, or if the
+/// task processor is shutting down.
+///
+/// Exceptions thrown by the function are logged.
+template <typename Function>
+void SubmitFastTask(TaskProcessor& task_processor, Function&& f) {
+  impl::SubmitFastTask(task_processor, {}, false, std::forward<Function>(f));
+}
+
+/// @overload void SubmitFastTask(TaskProcessor& task_processor, Function&& f)
+template <typename Function>
+void SubmitFastTask(TaskProcessor& task_processor, Deadline deadline,
+                    Function&& f) {
+  impl::SubmitFastTask(task_processor, deadline, false,
+                       std::forward<Function>(f));
+}
+
+/// @brief Runs a fast task that is not dropped because of overload or
+/// shutdown of the task processor.
+/// @see engine::SubmitFastTask
+template <typename Function>
+void SubmitCriticalFastTask(TaskProcessor& task_processor, Function&& f) {
+  impl::SubmitFastTask(task_processor, {}, true, std::forward<Function>(f));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -108,6 +108,14 @@ class [[nodiscard]] Socket final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends exactly len bytes of the file starting from the offset to
+  /// the socket without copying the data to the user space (sendfile).
+  /// @param in_fd file descriptor of a regular file, its offset is not changed
+  /// @note Can return less than len if socket is closed by peer or if the file
+  /// is shorter than offset + len.
+  [[nodiscard]] size_t SendFile(int in_fd, size_t offset, size_t len,
+                                Deadline deadline);
+
   /// @brief Accepts a connection from a listening socket.
   /// @see engine::io::Listen
   [[nodiscard]] Socket Accept(Deadline);
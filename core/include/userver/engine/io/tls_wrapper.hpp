@@ -3,6 +3,8 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <chrono>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,6 +19,50 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// Settings of the server side TLS connections
+struct TlsServerSettings final {
+  crypto::Certificate cert;
+  crypto::PrivateKey key;
+  std::vector<crypto::Certificate> cert_authorities;
+
+  /// Max count of sessions kept in the server side cache for resumption by
+  /// session ID, 0 disables the cache
+  std::size_t session_cache_size{0};
+
+  /// Lifetime of the cached sessions and of the issued session tickets
+  std::chrono::seconds session_timeout{300};
+
+  /// Whether to issue stateless session tickets to the clients
+  bool session_tickets{true};
+
+  /// Whether to hand the symmetric encryption of the connection to the kernel
+  /// (kTLS) after the handshake. Connections silently fall back to the
+  /// userspace encryption if the kernel, the OpenSSL build or the negotiated
+  /// cipher do not support it.
+  bool kernel_tls{false};
+};
+
+/// TLS context shared by the server connections, keeps the session cache and
+/// the session ticket keys, so the clients may resume their sessions on
+/// reconnection to any connection started with the same context.
+///
+/// Thread safe.
+class TlsServerContext final {
+ public:
+  /// @throws TlsException on invalid certificate or key
+  explicit TlsServerContext(const TlsServerSettings& settings);
+
+  TlsServerContext(TlsServerContext&&) noexcept;
+  TlsServerContext& operator=(TlsServerContext&&) noexcept;
+  ~TlsServerContext();
+
+ private:
+  friend class TlsWrapper;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe.
@@ -36,6 +82,12 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
       const crypto::PrivateKey& key, Deadline deadline,
       const std::vector<crypto::Certificate>& cert_authorities = {});
 
+  /// Starts a TLS server on an opened socket with the shared context, which
+  /// allows session resumption and kernel TLS
+  static TlsWrapper StartTlsServer(Socket&& socket,
+                                   const TlsServerContext& context,
+                                   Deadline deadline);
+
   ~TlsWrapper() override;
 
   TlsWrapper(const TlsWrapper&) = delete;
@@ -66,9 +118,18 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends exactly len bytes of the file starting from the offset,
+  /// the kernel encrypts the data without copying it to the user space.
+  /// @note Can return less than len if socket is closed by peer or if the file
+  /// is shorter than offset + len.
+  /// @throws TlsException if !IsKernelTlsEnabled()
+  [[nodiscard]] size_t SendFile(int in_fd, size_t offset, size_t len,
+                                Deadline deadline);
+
   /// @brief Finishes TLS session and returns the socket.
   /// @warning Wrapper becomes invalid on entry and can only be used to retry
   ///   socket extraction if interrupted.
+  /// @throws TlsException if IsKernelTlsEnabled()
   [[nodiscard]] Socket StopTls(Deadline deadline);
 
   /// @brief Receives at least one byte from the socket.
@@ -93,6 +154,15 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
     return SendAll(buf, len, deadline);
   }
 
+  /// @brief Writes exactly the total length of the buffers to the socket.
+  /// @note Can return less if socket is closed by peer.
+  [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list,
+                                Deadline deadline) override;
+
+  /// Whether the sent data is encrypted by the kernel, so the data may be
+  /// written to GetRawFd() directly, e.g. with `sendfile`
+  bool IsKernelTlsEnabled() const;
+
   int GetRawFd();
 
  private:
@@ -0,0 +1,156 @@
+#pragma once
+
+/// @file userver/engine/task_group.hpp
+/// @brief @copybrief engine::TaskGroup
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Runs a batch of similar subtasks with a limited concurrency and
+/// collects their results.
+///
+/// Instead of a task per item, TaskGroup spawns at most `max_concurrency`
+/// worker tasks, and each worker takes the next not yet processed item
+/// until there are none left. So a batch of any size costs at most
+/// `max_concurrency` task contexts, and they are joined with a single
+/// engine::WaitAllChecked.
+///
+/// If any item throws, the rest of the items are not started, the running
+/// workers are cancelled and waited for, and the exception is rethrown to the
+/// caller.
+///
+/// ## Example:
+/// @code
+/// engine::TaskGroup group{8};
+/// std::vector<Response> responses = group.Run(
+///     requests.size(), [&](std::size_t i) { return Fetch(requests[i]); });
+/// @endcode
+///
+/// @see engine::WaitAllChecked, engine::GetAll
+class TaskGroup final {
+ public:
+  /// Runs the subtasks on the task processor of the caller
+  explicit TaskGroup(std::size_t max_concurrency);
+
+  TaskGroup(TaskProcessor& task_processor, std::size_t max_concurrency);
+
+  /// @brief Calls `f(i)` for every `i` in `[0, count)` in subtasks and waits
+  /// for all of them.
+  ///
+  /// `f` is called concurrently from several subtasks and must be safe to
+  /// call this way. It is not copied and must not be destroyed while `Run` is
+  /// in progress.
+  ///
+  /// @returns `std::vector` of `count` results, where the i-th element is the
+  /// result of `f(i)`, or `void` if `f` returns `void`. The result type must
+  /// be default constructible, the vector is allocated before the subtasks
+  /// are started.
+  /// @throws WaitInterruptedException when `current_task::ShouldCancel()`
+  /// @throws std::exception the first exception thrown by `f`
+  template <typename Function>
+  auto Run(std::size_t count, Function&& f);
+
+  /// The maximum number of subtasks that run concurrently
+  std::size_t GetMaxConcurrency() const noexcept { return max_concurrency_; }
+
+ private:
+  std::size_t GetWorkersCount(std::size_t count) const noexcept;
+
+  TaskProcessor& task_processor_;
+  const std::size_t max_concurrency_;
+};
+
+namespace impl {
+
+// Distributes the items of a TaskGroup::Run batch between the workers
+class TaskGroupItems final {
+ public:
+  explicit TaskGroupItems(std::size_t count) noexcept : count_(count) {}
+
+  // Returns `false` if all the items are taken or the batch has failed
+  bool TryTakeNext(std::size_t& index) noexcept {
+    if (failed_.load(std::memory_order_relaxed)) return false;
+    index = next_.fetch_add(1, std::memory_order_relaxed);
+    return index < count_;
+  }
+
+  void SetFailed() noexcept { failed_.store(true, std::memory_order_relaxed); }
+
+ private:
+  const std::size_t count_;
+  std::atomic<std::size_t> next_{0};
+  std::atomic<bool> failed_{false};
+};
+
+template <typename Function, typename Consumer>
+void RunTaskGroupWorker(TaskGroupItems& items, Function& f,
+                        Consumer& consumer) {
+  std::size_t index = 0;
+  while (items.TryTakeNext(index)) {
+    current_task::CancellationPoint();
+    try {
+      consumer(index, f);
+    } catch (...) {
+      items.SetFailed();
+      throw;
+    }
+  }
+}
+
+}  // namespace impl
+
+template <typename Function>
+auto TaskGroup::Run(std::size_t count, Function&& f) {
+  using Result = std::invoke_result_t<Function&, std::size_t>;
+  constexpr bool kIsVoid = std::is_void_v<Result>;
+  static_assert(kIsVoid || std::is_default_constructible_v<Result>,
+                "The result of the function must be default constructible");
+  static_assert(!std::is_same_v<Result, bool>,
+                "std::vector<bool> elements can not be written concurrently, "
+                "return an enum or char instead");
+
+  // `results` outlive the workers, which are cancelled and waited for in
+  // their destructors
+  std::conditional_t<kIsVoid, std::nullptr_t, std::vector<Result>> results{};
+  if constexpr (!kIsVoid) results.resize(count);
+
+  auto consumer = [&results](std::size_t index, Function& func) {
+    if constexpr (kIsVoid) {
+      func(index);
+    } else {
+      results[index] = func(index);
+    }
+  };
+
+  impl::TaskGroupItems items{count};
+  std::vector<TaskWithResult<void>> workers;
+  const auto workers_count = GetWorkersCount(count);
+  workers.reserve(workers_count);
+  for (std::size_t i = 0; i < workers_count; ++i) {
+    workers.push_back(AsyncNoSpan(task_processor_, [&items, &f, &consumer] {
+      impl::RunTaskGroupWorker(items, f, consumer);
+    }));
+  }
+  WaitAllChecked(workers);
+
+  if constexpr (!kIsVoid) return results;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
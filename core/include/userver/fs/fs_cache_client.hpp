@@ -23,8 +23,10 @@ class FsCacheClient final {
   /// @param update_period time (0 - fill the cache only at startup), not used
   /// in Linux
   /// @param tp task processor to do filesystem operations
+  /// @param keep_opened keep the files opened instead of reading them into
+  /// memory, see fs::FileInfoWithData::file
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp, bool keep_opened = false);
 
   /// @brief get file from memory
   /// @param path to file
@@ -53,6 +55,7 @@ class FsCacheClient final {
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
   engine::TaskProcessor& tp_;
+  const utils::Flags<SettingsReadFile> read_flags_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
 #endif
@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file userver/fs/opened_file.hpp
+/// @brief @copybrief fs::OpenedFile
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+/// @ingroup userver_containers
+///
+/// @brief A regular file opened for reading and mapped to memory. Allows to
+/// send the file contents without reading them, e.g. with
+/// engine::io::Socket::SendFile.
+/// @note The file contents are expected to stay the same while the file is
+/// opened. Replace the file atomically (e.g. with `rename`) instead of
+/// rewriting it in place.
+class OpenedFile final {
+ public:
+  /// @brief Opens the file and maps it to memory
+  /// @note Blocks, use fs::OpenFile in coroutines
+  /// @throws std::runtime_error
+  explicit OpenedFile(const std::string& path);
+
+  OpenedFile(const OpenedFile&) = delete;
+  OpenedFile& operator=(const OpenedFile&) = delete;
+  ~OpenedFile();
+
+  /// Native file descriptor of the file
+  int GetNative() const;
+
+  /// File size at the moment of opening
+  std::size_t GetSize() const;
+
+  /// File contents mapped to memory
+  std::string_view GetData() const;
+
+  /// @brief Strong entity tag of the file made of its modification time and
+  /// size, e.g. `"6531f9a2-1f4"`
+  const std::string& GetETag() const;
+
+ private:
+  blocking::FileDescriptor fd_;
+  std::size_t size_{0};
+  void* mapping_{nullptr};
+  std::string etag_;
+};
+
+/// @brief Opens the file and maps it to memory asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @throws std::runtime_error if open fails for any reason (e.g. no such file)
+std::shared_ptr<const OpenedFile> OpenFile(engine::TaskProcessor& async_tp,
+                                           const std::string& path);
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/opened_file.hpp>
 #include <userver/utils/flags.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +20,8 @@ namespace fs {
 struct FileInfoWithData {
   std::string data;
   std::string extension;
+  /// The opened file if its contents were not read into `data`
+  std::shared_ptr<const OpenedFile> file;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -29,6 +32,8 @@ enum class SettingsReadFile {
   kNone = 0,
   /// Skip hidden files,
   kSkipHidden = 1 << 0,
+  /// Keep the files opened instead of reading them into memory
+  kKeepOpened = 1 << 1,
 };
 
 /// @brief Returns relative path from full path
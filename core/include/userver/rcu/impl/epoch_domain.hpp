@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/impl/wait_token_storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu::impl {
+
+// Process-wide epoch reclamation domain for rcu::SharedEpochReclamation.
+//
+// Readers increment a counter of the current epoch parity in one of a fixed
+// number of per-thread stripes, so the read side overhead does not depend on
+// the count of variables or readers. Retired values of all the variables are
+// kept in two batches: retired during the current epoch and retired before the
+// last epoch change. The epoch is advanced when all the readers of the
+// previous epoch are gone, and the older batch is freed at once.
+using EpochReaderCounter = std::atomic<std::uint64_t>;
+
+// Marks the calling reader as active in the current epoch. Value loads that
+// happen after the call are protected until UnlockEpochRead().
+EpochReaderCounter& LockEpochRead() noexcept;
+
+// Adds one more reader to the epoch that `counter` is locked in.
+inline void RelockEpochRead(EpochReaderCounter& counter) noexcept {
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void UnlockEpochRead(EpochReaderCounter& counter) noexcept {
+  counter.fetch_sub(1, std::memory_order_release);
+}
+
+using EpochDeleter = void (*)(void*) noexcept;
+
+// Retires the unlinked value `ptr` of the variable `owner`, the value is freed
+// by one of the following ReclaimEpochDomain() calls. If `async_tokens` is not
+// null, the value is destroyed in a background task that holds a token from
+// `async_tokens`.
+void RetireToEpochDomain(const void* owner, void* ptr, EpochDeleter deleter,
+                         utils::impl::WaitTokenStorage* async_tokens);
+
+// Tries to advance the epoch and free the batches that are not used anymore.
+// Frees the values of any variables, so must not be called under a lock.
+void ReclaimEpochDomain();
+
+// Synchronously frees all the retired values of `owner`. Must only be called
+// when there are no readers of `owner`, e.g. in its destructor.
+void ReclaimEpochDomainOwner(const void* owner) noexcept;
+
+// Approximate count of values that wait for reclamation, for tests
+std::size_t GetEpochDomainRetiredCountApprox() noexcept;
+
+}  // namespace rcu::impl
+
+USERVER_NAMESPACE_END
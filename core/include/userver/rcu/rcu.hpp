@@ -6,12 +6,14 @@
 #include <atomic>
 #include <cstdlib>
 #include <list>
+#include <type_traits>
 #include <unordered_set>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/rcu/fwd.hpp>
+#include <userver/rcu/impl/epoch_domain.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 
@@ -69,14 +71,67 @@ uint64_t GetNextEpoch() noexcept;
 
 }  // namespace impl
 
+/// @brief Reclamation policy that keeps a list of hazard pointers in each
+/// rcu::Variable. Old values are freed by the writers of the same variable as
+/// soon as they are not used. The default one.
+struct HazardPointerReclamation {};
+
+/// @brief Reclamation policy that shares a single epoch-based reclamation
+/// domain between all the rcu::Variable instances that use it.
+///
+/// Readers do not register per-variable hazard pointers, they only increment a
+/// per-thread-striped counter of the current epoch, so the read side overhead
+/// is bounded and does not grow with the count of variables and readers. Old
+/// values of all the variables are freed in batches, asynchronously if the
+/// variable uses DestructionType::kAsync.
+///
+/// A long-living ReadablePtr of any variable in the domain delays the
+/// reclamation of all the variables of the domain.
+struct SharedEpochReclamation {};
+
+namespace impl {
+
+template <typename RcuTraits, typename = void>
+struct ReclamationPolicyOf {
+  using Type = HazardPointerReclamation;
+};
+
+template <typename RcuTraits>
+struct ReclamationPolicyOf<RcuTraits,
+                           std::void_t<typename RcuTraits::ReclamationPolicy>> {
+  using Type = typename RcuTraits::ReclamationPolicy;
+};
+
+template <typename RcuTraits>
+inline constexpr bool kUsesSharedEpoch =
+    std::is_same_v<typename ReclamationPolicyOf<RcuTraits>::Type,
+                   SharedEpochReclamation>;
+
+template <typename T, typename RcuTraits>
+using ReaderRecord =
+    std::conditional_t<kUsesSharedEpoch<RcuTraits>, EpochReaderCounter,
+                       HazardPointerRecord<T, RcuTraits>>;
+
+}  // namespace impl
+
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - optional `ReclamationPolicy` is either rcu::HazardPointerReclamation
+/// (the default) or rcu::SharedEpochReclamation
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits that use the shared epoch-based reclamation domain, see
+/// rcu::SharedEpochReclamation
+template <typename T>
+struct SharedEpochRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = SharedEpochReclamation;
+};
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -86,21 +141,13 @@ template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
   explicit ReadablePtr(const Variable<T, RcuTraits>& ptr)
-      : hp_record_(&ptr.MakeHazardPointer()) {
-    // This cycle guarantees that at the end of it both t_ptr_ and
-    // hp_record_->ptr will both be set to
-    // 1. something meaningful
-    // 2. and that this meaningful value was not removed between assigning to
-    //    t_ptr_ and storing  it in a hazard pointer
-    do {
-      t_ptr_ = ptr.GetCurrent();
-
-      hp_record_->ptr.store(t_ptr_);
-    } while (t_ptr_ != ptr.GetCurrent());
+      : hp_record_(&ptr.MakeReaderRecord()) {
+    Protect(ptr);
   }
 
   ReadablePtr(ReadablePtr<T, RcuTraits>&& other) noexcept
       : t_ptr_(other.t_ptr_), hp_record_(other.hp_record_) {
+    TakeDebugOwner(other);
     other.t_ptr_ = nullptr;
   }
 
@@ -128,7 +175,7 @@ class [[nodiscard]] ReadablePtr final {
 
     // Get rid of our current hp_record_
     if (t_ptr_) {
-      hp_record_->Release();
+      ReleaseRecord();
     }
     // After that moment, the content of our hp_record_ can't be used -
     // no more hp_record_->xyz calls, because it is probably already reused in
@@ -136,6 +183,7 @@ class [[nodiscard]] ReadablePtr final {
     // freed. Just take values from 'other'.
     hp_record_ = other.hp_record_;
     t_ptr_ = other.t_ptr_;
+    TakeDebugOwner(other);
 
     // Now, it won't do us any good if there were two glorified things having
     // pointer to same hp_record_. Kill the other one.
@@ -147,8 +195,23 @@ class [[nodiscard]] ReadablePtr final {
     return *this;
   }
 
-  ReadablePtr(const ReadablePtr<T, RcuTraits>& other)
-      : ReadablePtr(other.hp_record_->owner) {}
+  ReadablePtr(const ReadablePtr<T, RcuTraits>& other) {
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      // other's epoch lock keeps its value alive, just lock the same epoch
+      // once more
+      t_ptr_ = other.t_ptr_;
+      hp_record_ = other.hp_record_;
+      if (t_ptr_) {
+        impl::RelockEpochRead(*hp_record_);
+        TakeDebugOwner(other);
+        AddDebugReader();
+      }
+    } else {
+      const auto& owner = other.hp_record_->owner;
+      hp_record_ = &owner.MakeReaderRecord();
+      Protect(owner);
+    }
+  }
 
   ReadablePtr& operator=(const ReadablePtr<T, RcuTraits>& other) {
     if (this != &other) *this = ReadablePtr<T, RcuTraits>{other};
@@ -158,7 +221,7 @@ class [[nodiscard]] ReadablePtr final {
   ~ReadablePtr() {
     if (!t_ptr_) return;
     UASSERT(hp_record_ != nullptr);
-    hp_record_->Release();
+    ReleaseRecord();
   }
 
   const T* Get() const& {
@@ -175,6 +238,54 @@ class [[nodiscard]] ReadablePtr final {
   const T& operator*() && { return *GetOnRvalue(); }
 
  private:
+  void Protect(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      // The epoch is locked, any value that is loaded now is not freed until
+      // the unlock
+      t_ptr_ = ptr.GetCurrent();
+#ifndef NDEBUG
+      debug_owner_ = &ptr;
+#endif
+      AddDebugReader();
+    } else {
+      // This cycle guarantees that at the end of it both t_ptr_ and
+      // hp_record_->ptr will both be set to
+      // 1. something meaningful
+      // 2. and that this meaningful value was not removed between assigning
+      //    to t_ptr_ and storing  it in a hazard pointer
+      do {
+        t_ptr_ = ptr.GetCurrent();
+
+        hp_record_->ptr.store(t_ptr_);
+      } while (t_ptr_ != ptr.GetCurrent());
+    }
+  }
+
+  void ReleaseRecord() noexcept {
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+#ifndef NDEBUG
+      --debug_owner_->debug_epoch_readers_;
+#endif
+      impl::UnlockEpochRead(*hp_record_);
+    } else {
+      hp_record_->Release();
+    }
+  }
+
+  // Readers of rcu::SharedEpochReclamation have no per-variable records, so
+  // they are counted for the destructor check of Variable in debug builds
+  void AddDebugReader() noexcept {
+#ifndef NDEBUG
+    ++debug_owner_->debug_epoch_readers_;
+#endif
+  }
+
+  void TakeDebugOwner([[maybe_unused]] const ReadablePtr& other) noexcept {
+#ifndef NDEBUG
+    debug_owner_ = other.debug_owner_;
+#endif
+  }
+
   const T* GetOnRvalue() {
     static_assert(!sizeof(T),
                   "Don't use temporary ReadablePtr, store it to a variable");
@@ -185,11 +296,15 @@ class [[nodiscard]] ReadablePtr final {
   // an indicator that this ReadablePtr is cleared and won't call
   // any logic associated with hp_record_
   T* t_ptr_;
-  // Our hazard pointer. It can be nullptr in some circumstances.
+  // Our hazard pointer or the locked epoch counter for
+  // rcu::SharedEpochReclamation. It can be nullptr in some circumstances.
   // Invariant is this: if t_ptr_ is not nullptr, then hp_record_ is also
   // not nullptr and points to hazard pointer containing same T*.
   // Thus, if t_ptr_ is nullptr, then hp_record_ is undefined.
-  impl::HazardPointerRecord<T, RcuTraits>* hp_record_;
+  impl::ReaderRecord<T, RcuTraits>* hp_record_;
+#ifndef NDEBUG
+  const Variable<T, RcuTraits>* debug_owner_{nullptr};
+#endif
 };
 
 /// Smart pointer for rcu::Variable<T> for changing RCU value. It stores a
@@ -247,6 +362,12 @@ class [[nodiscard]] WritablePtr final {
     std::unique_ptr<T> old_ptr(var_.current_.exchange(ptr_.release()));
     var_.Retire(std::move(old_ptr), lock_);
     lock_.unlock();
+
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      // Frees the values of the other variables as well, so it is done outside
+      // of the critical section
+      impl::ReclaimEpochDomain();
+    }
   }
 
   T* Get() & {
@@ -340,6 +461,16 @@ class Variable final {
   ~Variable() {
     delete current_.load();
 
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+#ifndef NDEBUG
+      UASSERT_MSG(debug_epoch_readers_ == 0,
+                  "RCU variable is destroyed while being used");
+#endif
+      // There are no readers of this variable, its values could be freed
+      // regardless of the other variables of the domain
+      impl::ReclaimEpochDomainOwner(this);
+    }
+
     auto* hp = hp_record_head_.load();
     while (hp) {
       auto* next = hp->next.load();
@@ -402,7 +533,11 @@ class Variable final {
       return;
     }
 
-    ScanRetiredList(CollectHazardPtrs(lock));
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      impl::ReclaimEpochDomain();
+    } else {
+      ScanRetiredList(CollectHazardPtrs(lock));
+    }
   }
 
  private:
@@ -456,6 +591,14 @@ class Variable final {
     return *hp;
   }
 
+  impl::ReaderRecord<T, RcuTraits>& MakeReaderRecord() const {
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      return impl::LockEpochRead();
+    } else {
+      return MakeHazardPointer();
+    }
+  }
+
   impl::HazardPointerRecord<T, RcuTraits>* MakeHazardPointerSlow() const {
     // allocate new pointer, and add it to the list (atomically)
     auto hp = new impl::HazardPointerRecord<T, RcuTraits>(*this);
@@ -469,6 +612,15 @@ class Variable final {
 
   void Retire(std::unique_ptr<T> old_ptr, std::unique_lock<MutexType>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if constexpr (impl::kUsesSharedEpoch<RcuTraits>) {
+      impl::RetireToEpochDomain(
+          this, old_ptr.release(),
+          [](void* ptr) noexcept { delete static_cast<T*>(ptr); },
+          destruction_type_ == DestructionType::kAsync ? &wait_token_storage_
+                                                       : nullptr);
+      return;
+    }
+
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
@@ -536,6 +688,10 @@ class Variable final {
   std::atomic<T*> current_;
   std::list<std::unique_ptr<T>> retire_list_head_;
   utils::impl::WaitTokenStorage wait_token_storage_;
+#ifndef NDEBUG
+  // ReadablePtr count for rcu::SharedEpochReclamation
+  mutable std::atomic<std::size_t> debug_epoch_readers_{0};
+#endif
 
   friend class ReadablePtr<T, RcuTraits>;
   friend class WritablePtr<T, RcuTraits>;
@@ -21,6 +21,7 @@ namespace impl {
 template <typename RcuMapTraits>
 struct RcuTraitsFromRcuMapTraits {
   using MutexType = typename RcuMapTraits::MutexType;
+  using ReclamationPolicy = typename ReclamationPolicyOf<RcuMapTraits>::Type;
 };
 }  // namespace impl
 
@@ -37,6 +38,7 @@ class MissingKeyException : public utils::TracefulException {
 /// type `Key`
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - optional `ReclamationPolicy`, see rcu::DefaultRcuTraits
 template <typename Key, typename Value>
 struct DefaultRcuMapTraits {
   using Hash = std::hash<Key>;
@@ -62,6 +62,13 @@ namespace components {
 /// max_connections | max connections count to keep | 32768
 /// task_processor | task processor to process incoming requests | -
 /// backlog | max count of new connections pending acceptance | 1024
+/// tls.cert | path to TLS certificate | -
+/// tls.private-key | path to TLS certificate private key | -
+/// tls.private-key-passphrase-name | passphrase name located in secdist | -
+/// tls.session-cache-size | max count of TLS sessions in the server side cache for resumption by session ID, 0 disables the cache | 0
+/// tls.session-timeout | lifetime of cached TLS sessions and session tickets in seconds | 300
+/// tls.session-tickets | whether to issue TLS session tickets, the ticket keys are shared by all the connections of the listener | true
+/// tls.kernel-offload | hand the symmetric TLS encryption to the kernel (kTLS) after the handshake; falls back to OpenSSL encryption if the kernel `tls` module, OpenSSL 3 or the negotiated cipher do not support it | false
 /// handler-defaults.max_url_size | max path/URL size or empty to not limit | 8192
 /// handler-defaults.max_request_size | max size of the whole request | 1024 * 1024
 /// handler-defaults.max_headers_size | max request headers size | 65536
@@ -72,6 +79,9 @@ namespace components {
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
+/// queue-shedding.target-ms | acceptable delay between the request read start and its handler start | 5
+/// queue-shedding.interval-ms | the queue is overloaded if the delay stays over the target for this interval; then `sheddable` requests are dropped and `normal` requests are dropped if they waited longer than the target, see `criticality` in server::handlers::HandlerBase | 100
+/// queue-shedding.max-queue-time-ms | drop non-critical requests that waited longer even if the queue is not overloaded | <no limit>
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that profiles the CPU usage of the service for a few
+/// seconds and returns the sampled stacks.
+///
+/// The profiler samples the threads that consume CPU time with `SIGPROF`.
+/// Stacks of the coroutines are cut at the start of the coroutine, and each
+/// sample is tagged with the outermost tracing::Span of the task (the handler
+/// span for the requests) and with the innermost one. Tasks that created
+/// their spans before the profiling started are tagged starting from their
+/// next context switch.
+///
+/// Only a single profiling may run at a time, the concurrent requests get
+/// HTTP 409. The request waits for the profiling to finish. The number of
+/// samples is bounded by `max-samples`, the rest are dropped.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase
+/// @ref userver_http_handlers
+/// and adds the following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-duration | the maximum duration of a single profiling | 60s
+/// max-samples | the maximum number of the samples of a single profiling | 50000
+///
+/// ## Static configuration example:
+///
+/// @code
+/// # yaml
+///     handler-cpu-profiler:
+///         path: /service/cpu-profiler
+///         method: GET
+///         task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Scheme
+/// Optional query parameters:
+/// * `duration` - the profiling duration in seconds, 10 by default;
+/// * `frequency` - the sampling frequency in Hz from 1 to 1000, 100 by
+///   default;
+/// * `format` - `folded` (default) for the folded stacks of FlameGraph with the
+///   span names as the outermost frames, or `pprof` for the legacy CPU profile
+///   of gperftools without the span names.
+
+// clang-format on
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig& config,
+              const components::ComponentContext& component_context);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(
+      const http::HttpRequest& request,
+      request::RequestContext& context) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::chrono::seconds max_duration_;
+  const std::size_t max_samples_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -36,6 +36,8 @@ namespace server::handlers {
 /// request_body_size_log_limit | trim request to this size before logging | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
+/// criticality | 'critical', 'normal' or 'sheddable' priority of the requests for the queue delay based shedding of components::Server, could be overridden by the `X-Request-Criticality` request header | 'normal'
+/// adaptive_concurrency | enables the latency-gradient limit of requests in flight, see below | <disabled>
 /// decompress_request | allow decompression of the requests | true
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
@@ -43,6 +45,25 @@ namespace server::handlers {
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
 /// deadline_expired_status_code | the HTTP status code to return if the request @ref scripts/docs/en/userver/deadline_propagation.md "deadline expires" | 498
+///
+/// ## Adaptive concurrency
+/// `adaptive_concurrency` keeps the limit of requests in flight close to the
+/// point where the handler latency starts growing. Each `update_interval_ms`
+/// the mean latency of the finished requests is compared with the minimal
+/// observed latency and the limit is multiplied by their ratio (clamped to
+/// [0.5, 1]) and increased by the square root of itself. Requests over the
+/// limit get 429. Options:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// min_limit | lower bound of the limit | 10
+/// max_limit | upper bound of the limit | 1000
+/// initial_limit | limit before the first update | 20
+/// rtt_tolerance | latency growth ratio that is not treated as congestion | 1.5
+/// smoothing | weight of the new limit estimation, in (0, 1] | 0.2
+/// update_interval_ms | how often the limit is recalculated | 10
+/// min_samples | min finished requests required to recalculate the limit | 5
+/// min_rtt_reset_interval_ms | how often the minimal latency is re-measured | 10000
 
 // clang-format on
 class HandlerBase : public components::LoggableComponentBase {
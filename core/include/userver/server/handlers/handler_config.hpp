@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <variant>
@@ -26,6 +27,31 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+/// Priority of requests for the queue delay based load shedding, could be
+/// overridden by the `X-Request-Criticality` header.
+enum class RequestCriticality {
+  kCritical,   ///< never shed because of the queue delay
+  kNormal,     ///< shed when the queue delay stays over the target
+  kSheddable,  ///< shed first, while the queue is overloaded
+
+  kDefault = kNormal,
+};
+
+/// Settings of the per-handler latency-gradient concurrency limiter.
+struct AdaptiveConcurrencyConfig {
+  std::size_t min_limit{10};
+  std::size_t max_limit{1000};
+  std::size_t initial_limit{20};
+  /// Latency growth over the minimal one that is not treated as congestion
+  double rtt_tolerance{1.5};
+  /// Weight of the new limit estimation, in (0, 1]
+  double smoothing{0.2};
+  std::chrono::milliseconds update_interval{10};
+  std::size_t min_samples{5};
+  /// The minimal latency is forgotten periodically to adapt to its growth
+  std::chrono::milliseconds min_rtt_reset_interval{10000};
+};
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
@@ -37,9 +63,12 @@ struct HandlerConfig {
   UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
+  std::optional<AdaptiveConcurrencyConfig> adaptive_concurrency;
+  RequestCriticality criticality{RequestCriticality::kDefault};
   bool decompress_request{true};
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
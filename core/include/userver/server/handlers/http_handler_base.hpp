@@ -36,6 +36,7 @@ class HttpHandlerStatistics;
 class HttpRequestStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
+class AdaptiveConcurrencyLimiter;
 
 // clang-format off
 
@@ -201,6 +202,7 @@ class HttpHandlerBase : public HandlerBase {
   std::optional<logging::Level> log_level_;
   bool set_response_server_hostname_;
   mutable utils::TokenBucket rate_limit_;
+  std::unique_ptr<AdaptiveConcurrencyLimiter> concurrency_limiter_;
   bool is_body_streamed_;
 };
 
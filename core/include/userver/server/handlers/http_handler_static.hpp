@@ -19,6 +19,10 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// A single byte range of the `Range` header is served with HTTP 206. Files
+/// of components::FsCache with `zero-copy` enabled are sent with sendfile and
+/// are validated with the `ETag`, `If-None-Match` and `If-Range` headers.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
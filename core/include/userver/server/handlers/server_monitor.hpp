@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <memory>
+
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -39,6 +41,10 @@ namespace server::handlers {
 ///   be a JSON dictionary in the form '{"label1":"value1", "label2":"value2"}'.
 /// * path - return metrics on for the following path
 /// * prefix - return metrics whose path starts from the specified prefix.
+///
+/// Prometheus output reuses the buffers and the escaped series names between
+/// the requests. With the `response-body-stream: true` static option it is
+/// sent in chunks as it is being serialized.
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
@@ -50,9 +56,15 @@ class ServerMonitor final : public HttpHandlerBase {
   /// @brief The default name of server::handlers::ServerMonitor
   static constexpr std::string_view kName = "handler-server-monitor";
 
+  ~ServerMonitor() override;
+
   std::string HandleRequestThrow(const http::HttpRequest& request,
                                  request::RequestContext&) const override;
 
+  void HandleStreamRequest(const http::HttpRequest& request,
+                           request::RequestContext& context,
+                           http::ResponseBodyStream& stream) const override;
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
@@ -62,8 +74,14 @@ class ServerMonitor final : public HttpHandlerBase {
 
   utils::statistics::Storage& statistics_storage_;
 
+  utils::statistics::Request MakeStatisticsRequest(
+      const http::HttpRequest& request, bool is_solomon) const;
+
   using CommonLabels = std::unordered_map<std::string, std::string>;
   const CommonLabels common_labels_;
+
+  struct PrometheusSerializers;
+  const std::unique_ptr<PrometheusSerializers> prometheus_serializers_;
 };
 
 }  // namespace server::handlers
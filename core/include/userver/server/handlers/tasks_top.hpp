@@ -0,0 +1,87 @@
+#pragma once
+
+/// @file userver/server/handlers/tasks_top.hpp
+/// @brief @copybrief server::handlers::TasksTop
+
+#include <memory>
+
+#include <userver/server/handlers/http_handler_json_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the task names that consumed the most of the
+/// task processors time over a recent window, like `top` does for processes.
+///
+/// Only the task processors with `task-stats: true` in the
+/// components::ManagerControllerComponent config are reported. Tasks are
+/// named after the tracing::Span of utils::Async and after the handler name for
+/// the requests.
+///
+/// The handler takes a snapshot of the statistics every second and keeps the
+/// snapshots for the `window`. A request reports the difference between the
+/// current statistics and the oldest snapshot.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase
+/// @ref userver_http_handlers
+/// and adds the following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// window | the time span to report the statistics for | 60s
+/// top | the default number of task names to report per task processor | 20
+///
+/// ## Static configuration example:
+///
+/// @code
+/// # yaml
+///     handler-tasks-top:
+///         path: /service/tasks-top
+///         method: GET
+///         task_processor: monitor-task-processor
+///         window: 60s
+/// @endcode
+///
+/// ## Scheme
+/// Optional query parameters:
+/// * `task_processor` - report only the specified task processor;
+/// * `top` - the number of task names to report per task processor;
+/// * `sort` - one of `cpu` (default), `queue`, `wait` or `switches`.
+
+// clang-format on
+class TasksTop final : public HttpHandlerJsonBase {
+ public:
+  TasksTop(const components::ComponentConfig& config,
+           const components::ComponentContext& component_context);
+
+  ~TasksTop() override;
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::TasksTop
+  static constexpr std::string_view kName = "handler-tasks-top";
+
+  formats::json::Value HandleRequestJsonThrow(
+      const http::HttpRequest& request,
+      const formats::json::Value& request_json,
+      request::RequestContext& context) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::TasksTop> =
+    true;
+
+USERVER_NAMESPACE_END
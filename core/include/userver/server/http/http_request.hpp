@@ -13,6 +13,7 @@
 #include <userver/logging/log_helper_fwd.hpp>
 #include <userver/server/http/form_data_arg.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/utils/impl/projecting_view.hpp>
 #include <userver/utils/str_icase.hpp>
@@ -182,6 +183,14 @@ class HttpRequest final {
   /// @return HTTP body.
   const std::string& RequestBody() const;
 
+  /// @return true if the handler reads the body while it is being received,
+  /// see server::http::RequestBodyStream
+  bool IsBodyStreamed() const;
+
+  /// @return the body of the request being received
+  /// @throws std::logic_error if the body is not streamed
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
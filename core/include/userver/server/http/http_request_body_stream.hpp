@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Body of an HTTP request that is read by the handler while it is
+/// being received
+///
+/// Handlers with `request-body-stream: true` static config option are started
+/// right after the request headers are received, their request body is not
+/// buffered and is available only via server::http::HttpRequest::GetBodyStream.
+/// While the handler does not read the body, the connection is not read either,
+/// so the client is slowed down by the TCP flow control. The part of the body
+/// not read by the time the handler finishes is received and discarded.
+///
+/// Chunked transfer encoding is decoded, `Content-Encoding: gzip` body is
+/// decompressed on the fly if `decompress_request` is enabled for the handler.
+/// The handler `max_request_size` limit is checked for both the received and
+/// the decompressed data while the body is being read.
+///
+/// Multipart form data and `parse_args_from_body` are not supported for
+/// such handlers.
+class RequestBodyStream final {
+ public:
+  RequestBodyStream(RequestBodyStream&&) noexcept;
+  RequestBodyStream& operator=(RequestBodyStream&&) noexcept;
+  ~RequestBodyStream();
+
+  /// @brief Waits for the next chunk of the body.
+  /// @returns std::nullopt if the whole body was read
+  /// @throws server::handlers::ClientError with
+  /// server::handlers::HandlerErrorCode::kPayloadTooLarge if the body exceeds
+  /// `max_request_size`, with HandlerErrorCode::kClientError if the body was
+  /// not received before the deadline or was not sent completely
+  /// @throws server::handlers::RequestParseError if the body could not be
+  /// decompressed
+  /// @throws engine::WaitInterruptedException if the task was cancelled
+  std::optional<std::string> ReadChunk(engine::Deadline deadline = {});
+
+  /// @brief Reads the rest of the body, see ReadChunk for the exceptions.
+  std::string ReadAll(engine::Deadline deadline = {});
+
+  /// @cond
+  // For internal use only
+  struct Impl;
+  explicit RequestBodyStream(std::unique_ptr<Impl>&& impl);
+  /// @endcond
+
+ private:
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
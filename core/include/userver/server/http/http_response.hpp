@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -20,6 +21,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs {
+class OpenedFile;
+}  // namespace fs
+
 namespace server::http {
 
 namespace impl {
@@ -137,6 +142,15 @@ class HttpResponse final : public request::ResponseBase {
   // Can be called only once
   Queue::Producer GetBodyProducer();
 
+  /// @brief Sets the region of the file as the response body, it is used if
+  /// the handler returns an empty body.
+  ///
+  /// The region is sent without copying it to the user space on plain
+  /// connections and on TLS connections with kernel encryption. It is sent
+  /// from the memory mapped file otherwise.
+  void SetBodyFile(std::shared_ptr<const fs::OpenedFile> file,
+                   std::size_t offset, std::size_t size);
+
  private:
   // Returns total size of the response
   std::size_t SetBodyStreamed(engine::io::RwBase& socket, std::string& header);
@@ -145,6 +159,9 @@ class HttpResponse final : public request::ResponseBase {
   std::size_t SetBodyNotStreamed(engine::io::RwBase& socket,
                                  std::string& header);
 
+  // Returns total size of the response
+  std::size_t SendBodyFile(engine::io::RwBase& socket, std::string& header);
+
   const HttpRequestImpl& request_;
   HttpStatus status_ = HttpStatus::kOk;
   HeadersMap headers_;
@@ -153,6 +170,9 @@ class HttpResponse final : public request::ResponseBase {
   engine::SingleConsumerEvent headers_end_;
   std::optional<Queue::Consumer> body_stream_;
   std::optional<Queue::Producer> body_stream_producer_;
+  std::shared_ptr<const fs::OpenedFile> body_file_;
+  std::size_t body_file_offset_{0};
+  std::size_t body_file_size_{0};
 };
 
 void SetThrottleReason(http::HttpResponse& http_response,
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -45,9 +46,17 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+namespace impl {
+struct PreparedMessageData;
+}  // namespace impl
+
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+  // permessage-deflate extension (RFC 7692), used if the client offers it
+  bool permessage_deflate = false;
+  bool server_no_context_takeover = false;
+  bool client_no_context_takeover = false;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
@@ -59,6 +68,25 @@ struct Statistics final {
   std::atomic<int64_t> bytes_recv{0};
 };
 
+/// @brief Message that is framed, and compressed for the connections with
+/// permessage-deflate, only once to be sent to many connections with
+/// WebSocketConnection::SendPrepared()
+///
+/// Copies of the message share the encoded data, the message is sent in a
+/// single frame regardless of the `fragment-size` option.
+class PreparedMessage final {
+ public:
+  PreparedMessage(std::string_view data, bool is_text);
+
+  /// @returns size of the message payload before compression
+  std::size_t GetSize() const;
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  std::shared_ptr<const impl::PreparedMessageData> data_;
+};
+
 /// @brief Main class for Websocket connection
 class WebSocketConnection {
  public:
@@ -91,6 +119,12 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send a message encoded beforehand, e.g. the same message to
+  /// many connections.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Has the same thread-safety guarantees as Send().
+  virtual void SendPrepared(const PreparedMessage& message) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
@@ -28,6 +28,9 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate | accept permessage-deflate extension (RFC 7692) offered by clients | false
+/// server-no-context-takeover | compress each sent message independently, saves memory of idle connections | false
+/// client-no-context-takeover | require clients to compress each message independently | false
 ///
 /// ## Example usage:
 ///
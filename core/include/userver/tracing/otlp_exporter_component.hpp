@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file userver/tracing/otlp_exporter_component.hpp
+/// @brief @copybrief tracing::OtlpExporter
+
+#include <memory>
+#include <string_view>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that exports all the finished tracing::Span in the
+/// OpenTelemetry (OTLP) protobuf format.
+///
+/// Spans are exported in batches, each batch is a serialized
+/// `opentelemetry.proto.collector.trace.v1.ExportTraceServiceRequest`
+/// prefixed with its varint encoded size (protobuf delimited format). Batches
+/// are appended to a file or sent into a unix socket, a local agent is expected
+/// to forward them to the collector.
+///
+/// Span destructors never block on the exporter: if the queue is full, the span
+/// is dropped and accounted in the `tracing.otlp-exporter.dropped` metric.
+/// Spans that are not logged because of their log level are not exported.
+///
+/// The component is not included into components::CommonComponentList, add it
+/// manually if required.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// path | path to the output file or to the unix socket | -
+/// mode | 'file' to append batches to the file, 'unix-socket' to send them into the unix socket | file
+/// service-name | value of the 'service.name' resource attribute | unknown_service
+/// max-queue-size | max count of spans waiting for the export, spans over the limit are dropped | 65536
+/// max-batch-size | max count of spans in a single ExportTraceServiceRequest | 1024
+/// flush-period | max time a span waits in the queue before being exported | 1s
+/// fs-task-processor | task processor for the blocking writes | fs-task-processor
+///
+/// ## Static configuration example:
+///
+/// @code
+/// tracing-otlp-exporter:
+///   path: /var/run/otel-agent/spans.sock
+///   mode: unix-socket
+///   service-name: my-service
+/// @endcode
+
+// clang-format on
+class OtlpExporter final : public components::LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of tracing::OtlpExporter
+  static constexpr std::string_view kName = "tracing-otlp-exporter";
+
+  OtlpExporter(const components::ComponentConfig&,
+               const components::ComponentContext&);
+
+  ~OtlpExporter() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  class Impl;
+
+  std::shared_ptr<Impl> impl_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace tracing
+
+template <>
+inline constexpr bool components::kHasValidate<tracing::OtlpExporter> = true;
+
+USERVER_NAMESPACE_END
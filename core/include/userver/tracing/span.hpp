@@ -143,14 +143,20 @@ class Span final {
 
   std::string GetParentLink() const;
 
-  const std::string& GetTraceId() const;
-  const std::string& GetSpanId() const;
-  const std::string& GetParentId() const;
+  std::string GetTraceId() const;
+  std::string GetSpanId() const;
+  std::string GetParentId() const;
 
   /// @returns true if this span would be logged with the current local and
   /// global log levels to the default logger.
   bool ShouldLogDefault() const noexcept;
 
+  /// @returns the head sampling decision of the trace or std::nullopt if the
+  /// trace was not started by a request handler.
+  /// Spans of not sampled traces are not logged, unless kept by the tail
+  /// sampling. See @ref USERVER_TRACING_SAMPLING
+  std::optional<bool> GetSamplingDecision() const noexcept;
+
   /// Detach the Span from current engine::Task so it is not
   /// returned by CurrentSpan() any more.
   void DetachFromCoroStack();
@@ -4,6 +4,7 @@
 /// @brief @copybrief tracing::SpanBuilder
 
 #include <string>
+#include <string_view>
 
 #include <userver/tracing/span.hpp>
 #include <userver/utils/impl/source_location.hpp>
@@ -20,10 +21,18 @@ class SpanBuilder final {
                            utils::impl::SourceLocation::Current());
 
   void SetTraceId(std::string trace_id);
-  const std::string& GetTraceId() const noexcept;
+  std::string GetTraceId() const;
   void SetSpanId(std::string span_id);
   void SetParentSpanId(std::string parent_span_id);
   void SetParentLink(std::string parent_link);
+
+  /// Sets the head sampling decision received with the request
+  void SetSampled(bool sampled);
+
+  /// Makes the head sampling decision for a request to `handler_name`, if the
+  /// decision was not received with the request.
+  /// See @ref USERVER_TRACING_SAMPLING
+  void MakeSamplingDecision(std::string_view handler_name);
   void AddTagFrozen(std::string key, logging::LogExtra::Value value);
   void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
   Span Build() &&;
@@ -6,6 +6,7 @@
 /// - utils::statistics::LabelView
 /// - utils::statistics::Label
 /// - utils::statistics::LabelsSpan
+/// - utils::statistics::HistogramView
 /// - utils::statistics::MetricValue
 
 #include <variant>
@@ -14,6 +15,7 @@
 
 #include <userver/utils/fmt_compat.hpp>
 #include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
 #include <userver/utils/statistics/labels.hpp>
 #include <userver/utils/statistics/metric_value.hpp>
 #include <userver/utils/statistics/rate.hpp>
@@ -69,6 +71,25 @@ class fmt::formatter<USERVER_NAMESPACE::utils::statistics::Rate> {
       rate_format_;
 };
 
+/// Writes the non-empty buckets as `[upper_bound:count, ..., inf:count]`
+template <>
+struct fmt::formatter<USERVER_NAMESPACE::utils::statistics::HistogramView> {
+  constexpr static auto parse(format_parse_context& ctx) { return ctx.begin(); }
+
+  template <typename FormatContext>
+  auto format(USERVER_NAMESPACE::utils::statistics::HistogramView value,
+              FormatContext& ctx) USERVER_FMT_CONST {
+    auto out = ctx.out();
+    *out++ = '[';
+    for (std::size_t i = 0; i < value.GetBucketCount(); ++i) {
+      const auto count = value.GetValueAt(i);
+      if (count == 0) continue;
+      out = fmt::format_to(out, "{}:{}, ", value.GetUpperBoundAt(i), count);
+    }
+    return fmt::format_to(out, "inf:{}]", value.GetValueAtInf());
+  }
+};
+
 template <>
 class fmt::formatter<USERVER_NAMESPACE::utils::statistics::MetricValue> {
  public:
@@ -82,6 +103,9 @@ class fmt::formatter<USERVER_NAMESPACE::utils::statistics::MetricValue> {
   template <typename FormatContext>
   auto format(USERVER_NAMESPACE::utils::statistics::MetricValue value,
               FormatContext& ctx) USERVER_FMT_CONST {
+    if (value.IsHistogram()) {
+      return fmt::format_to(ctx.out(), "{}", value.AsHistogram());
+    }
     return value.Visit(USERVER_NAMESPACE::utils::Overloaded{
         [&](std::int64_t x) { return int_format_.format(x, ctx); },
         [&](USERVER_NAMESPACE::utils::statistics::Rate x) {
@@ -0,0 +1,133 @@
+#pragma once
+
+/// @file userver/utils/statistics/histogram.hpp
+/// @brief @copybrief utils::statistics::Histogram
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/utils/statistics/histogram_view.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/** @brief HDR-style log-linear histogram with a fixed relative precision.
+ *
+ * Values in [0, 2^PrecisionBits) are counted exactly, each next power of two
+ * is split into 2^PrecisionBits buckets of equal width, so the relative error
+ * of a bucket upper bound never exceeds 2^-PrecisionBits. Values that are not
+ * less than 2^MaxValueBits are counted in a separate overflow bucket.
+ *
+ * Unlike utils::statistics::Percentile the histogram is written as a whole
+ * (as a native histogram in Prometheus and Solomon formats), so the buckets
+ * could be aggregated over instances before computing the percentiles.
+ *
+ * Account() is lock-free and wait-free. Histograms are usually kept in a
+ * utils::statistics::RecentPeriod:
+ *
+ * @code
+ * using Histogram = utils::statistics::Histogram<>;
+ * utils::statistics::RecentPeriod<Histogram, Histogram> timings;
+ *
+ * timings.GetCurrentCounter().Account(ms.count());
+ * writer["timings"] = timings;
+ * @endcode
+ *
+ * @tparam PrecisionBits log2 of the buckets count per power of two
+ * @tparam MaxValueBits values up to 2^MaxValueBits are counted in buckets
+ */
+template <std::size_t PrecisionBits = 2, std::size_t MaxValueBits = 20>
+class Histogram final {
+  static_assert(PrecisionBits < MaxValueBits && MaxValueBits < 64);
+
+ public:
+  static constexpr std::size_t kBucketCount =
+      impl::histogram::GetBucketCount(PrecisionBits, MaxValueBits);
+
+  Histogram() noexcept { Reset(); }
+
+  Histogram(const Histogram& other) noexcept { *this = other; }
+
+  Histogram& operator=(const Histogram& rhs) noexcept {
+    if (this == &rhs) return *this;
+
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      values_[i].store(rhs.values_[i].load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  /// Account for `count` occurrences of `value`
+  void Account(std::uint64_t value, std::uint64_t count = 1) noexcept {
+    const auto index =
+        value >> MaxValueBits
+            ? kInfIndex
+            : impl::histogram::GetBucketIndex(value, PrecisionBits);
+    values_[index].fetch_add(count, std::memory_order_relaxed);
+    values_[kSumIndex].fetch_add(value * count, std::memory_order_relaxed);
+  }
+
+  /// Merges buckets of `other` into this histogram, suitable for
+  /// utils::statistics::RecentPeriod
+  template <class Duration = std::chrono::seconds>
+  void Add(const Histogram& other,
+           [[maybe_unused]] Duration this_epoch_duration = Duration(),
+           [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      const auto value = other.values_[i].load(std::memory_order_relaxed);
+      if (value != 0) values_[i].fetch_add(value, std::memory_order_relaxed);
+    }
+  }
+
+  void Reset() noexcept {
+    for (auto& value : values_) value.store(0, std::memory_order_relaxed);
+  }
+
+  /// @returns an upper bound of the bucket that contains the requested
+  /// percentile, `2^MaxValueBits` if it is in the overflow bucket.
+  /// @param percent value in [0..100]
+  std::uint64_t GetPercentile(double percent) const noexcept {
+    const auto total = GetView().GetTotalCount();
+    if (total == 0) return 0;
+
+    const auto want_sum = static_cast<double>(total) * percent;
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+      sum += values_[i].load(std::memory_order_relaxed);
+      if (static_cast<double>(sum) * 100 >= want_sum && sum != 0) {
+        return impl::histogram::GetBucketUpperBound(i, PrecisionBits);
+      }
+    }
+    return std::uint64_t{1} << MaxValueBits;
+  }
+
+  std::uint64_t GetTotalCount() const noexcept {
+    return GetView().GetTotalCount();
+  }
+
+  HistogramView GetView() const noexcept {
+    return HistogramView{values_.data(), kBucketCount, PrecisionBits};
+  }
+
+ private:
+  static constexpr std::size_t kInfIndex = kBucketCount;
+  static constexpr std::size_t kSumIndex = kBucketCount + 1;
+
+  // buckets, overflow bucket, sum of values
+  std::array<std::atomic<std::uint64_t>, kBucketCount + 2> values_;
+};
+
+template <std::size_t PrecisionBits, std::size_t MaxValueBits>
+void DumpMetric(Writer& writer,
+                const Histogram<PrecisionBits, MaxValueBits>& histogram) {
+  writer = histogram.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
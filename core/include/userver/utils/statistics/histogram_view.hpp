@@ -0,0 +1,95 @@
+#pragma once
+
+/// @file userver/utils/statistics/histogram_view.hpp
+/// @brief @copybrief utils::statistics::HistogramView
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::histogram {
+
+/// Values below 2^precision_bits are stored in exact buckets, each next power
+/// of two is split into 2^precision_bits buckets of equal width.
+constexpr std::size_t GetBucketCount(std::size_t precision_bits,
+                                     std::size_t max_value_bits) noexcept {
+  return (max_value_bits - precision_bits + 1) << precision_bits;
+}
+
+constexpr std::size_t GetBucketIndex(std::uint64_t value,
+                                     std::size_t precision_bits) noexcept {
+  const auto highest_bit =
+      static_cast<std::size_t>(63 - __builtin_clzll(value | 1));
+  const std::size_t shift =
+      highest_bit > precision_bits ? highest_bit - precision_bits : 0;
+  return (shift << precision_bits) + static_cast<std::size_t>(value >> shift);
+}
+
+/// @returns the max value that is stored in the bucket
+constexpr std::uint64_t GetBucketUpperBound(
+    std::size_t index, std::size_t precision_bits) noexcept {
+  if ((index >> precision_bits) == 0) return index;
+
+  const std::size_t shift = (index >> precision_bits) - 1;
+  return (static_cast<std::uint64_t>(index - (shift << precision_bits) + 1)
+          << shift) -
+         1;
+}
+
+}  // namespace impl::histogram
+
+/// @brief A non-owning read-only view of the utils::statistics::Histogram
+/// buckets, the histogram type of utils::statistics::MetricValue.
+///
+/// Bucket `i` counts the values in the (GetUpperBoundAt(i - 1),
+/// GetUpperBoundAt(i)] range, the values over the last upper bound are
+/// counted separately in GetValueAtInf().
+class HistogramView final {
+ public:
+  std::size_t GetBucketCount() const noexcept { return bucket_count_; }
+
+  /// @returns the max value that is accounted in the bucket
+  std::uint64_t GetUpperBoundAt(std::size_t index) const;
+
+  /// @returns count of values in the bucket
+  std::uint64_t GetValueAt(std::size_t index) const;
+
+  /// @returns count of values that are greater than all the upper bounds
+  std::uint64_t GetValueAtInf() const noexcept;
+
+  /// @returns sum of all the accounted values
+  std::uint64_t GetSum() const noexcept;
+
+  /// @returns count of all the accounted values, including the overflow ones
+  std::uint64_t GetTotalCount() const noexcept;
+
+  bool operator==(const HistogramView& other) const noexcept;
+  bool operator!=(const HistogramView& other) const noexcept {
+    return !(*this == other);
+  }
+
+  /// @cond
+  // `values` contain `bucket_count` buckets, then the overflow bucket and the
+  // sum of values.
+  HistogramView(const std::atomic<std::uint64_t>* values,
+                std::size_t bucket_count, std::size_t precision_bits) noexcept
+      : values_(values),
+        bucket_count_(bucket_count),
+        precision_bits_(precision_bits) {}
+
+  std::size_t GetPrecisionBits() const noexcept { return precision_bits_; }
+  /// @endcond
+
+ private:
+  const std::atomic<std::uint64_t>* values_;
+  std::size_t bucket_count_;
+  std::size_t precision_bits_;
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
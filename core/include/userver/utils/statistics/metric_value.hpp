@@ -6,14 +6,19 @@
 #include <cstdint>
 #include <variant>
 
+#include <userver/utils/statistics/histogram_view.hpp>
 #include <userver/utils/statistics/rate.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics {
 
-/// @brief The value of a metric. Only integer and floating-point metrics are
-/// allowed.
+/// @brief The value of a metric. Only integer, floating-point, Rate and
+/// histogram metrics are allowed.
+///
+/// Histogram metrics are not a part of RawType, use IsHistogram() and
+/// AsHistogram() to access them. They are non-owning views, valid only during
+/// the utils::statistics::BaseFormatBuilder::HandleMetric call.
 class MetricValue final {
  public:
   using RawType = std::variant<std::int64_t, double, Rate>;
@@ -31,34 +36,52 @@ class MetricValue final {
 
   /// @brief Retrieve the value of an integer metric.
   /// @throws std::exception on type mismatch.
-  std::int64_t AsInt() const { return std::get<std::int64_t>(value_); }
+  std::int64_t AsInt() const { return std::get<std::int64_t>(GetRaw()); }
 
   /// @brief Retrieve the value of a floating-point metric.
   /// @throws std::exception on type mismatch.
-  double AsFloat() const { return std::get<double>(value_); }
+  double AsFloat() const { return std::get<double>(GetRaw()); }
 
   /// @brief Retrieve the value of a Rate metric.
   /// @throws std::exception on type mismatch.
-  Rate AsRate() const { return std::get<Rate>(value_); }
+  Rate AsRate() const { return std::get<Rate>(GetRaw()); }
+
+  /// @brief Retrieve the value of a histogram metric.
+  /// @throws std::exception on type mismatch.
+  HistogramView AsHistogram() const { return std::get<HistogramView>(value_); }
 
   /// @brief Returns whether metric is Rate metric
-  bool IsRate() const noexcept { return std::holds_alternative<Rate>(value_); }
+  bool IsRate() const noexcept {
+    const auto* raw = std::get_if<RawType>(&value_);
+    return raw && std::holds_alternative<Rate>(*raw);
+  }
 
-  /// @brief Calls @p visitor with either a `std::int64_t` or a `double` value.
+  /// @brief Returns whether metric is a histogram metric
+  bool IsHistogram() const noexcept {
+    return std::holds_alternative<HistogramView>(value_);
+  }
+
+  /// @brief Calls @p visitor with either a `std::int64_t`, a `double` or a
+  /// `Rate` value.
   /// @returns Whatever @p visitor returns.
+  /// @throws std::exception for a histogram metric, check IsHistogram() first.
   template <typename VisitorFunc>
   decltype(auto) Visit(VisitorFunc visitor) const {
-    return std::visit(visitor, value_);
+    return std::visit(visitor, GetRaw());
   }
 
   /// @cond
-  MetricValue() noexcept : value_(std::int64_t{0}) {}
+  MetricValue() noexcept : value_(RawType{std::int64_t{0}}) {}
 
   explicit MetricValue(RawType value) noexcept : value_(value) {}
+
+  explicit MetricValue(HistogramView value) noexcept : value_(value) {}
   /// @endcond
 
  private:
-  RawType value_;
+  const RawType& GetRaw() const { return std::get<RawType>(value_); }
+
+  std::variant<RawType, HistogramView> value_;
 };
 
 }  // namespace utils::statistics
@@ -3,7 +3,10 @@
 /// @file userver/utils/statistics/prometheus.hpp
 /// @brief Statistics output in Prometheus format.
 
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/statistics/storage.hpp>
 
@@ -26,6 +29,50 @@ std::string ToPrometheusLabel(std::string_view name);
 
 }  // namespace impl
 
+/// @brief Reusable serializer of the `statistics` into Prometheus format.
+///
+/// Keeps the output buffer and the escaped names and labels of each series
+/// between the Serialize() calls, so the repeated scrapes of a Storage write
+/// the metrics straight into the buffer without escaping and allocating
+/// anything again. Series that were not written for several serializations
+/// are dropped from the cache.
+///
+/// Not thread-safe.
+class PrometheusSerializer final {
+ public:
+  struct Settings final {
+    /// Write the `# TYPE` lines
+    bool typed{true};
+
+    /// Do not write the series that have the same value as in the previous
+    /// Serialize() call. Useful only for push-based delivery, as Prometheus
+    /// considers the missing series to be stale.
+    bool skip_unchanged{false};
+  };
+
+  PrometheusSerializer();
+  explicit PrometheusSerializer(Settings settings);
+
+  PrometheusSerializer(PrometheusSerializer&&) noexcept;
+  PrometheusSerializer& operator=(PrometheusSerializer&&) noexcept;
+  ~PrometheusSerializer();
+
+  /// @returns metrics in Prometheus format, the view is valid until the next
+  /// call to the serializer
+  std::string_view Serialize(const Storage& statistics,
+                             const Request& request = {});
+
+  /// @returns metrics in Prometheus format split into consecutive parts of
+  /// about `chunk_size` bytes, that could be sent without copying them
+  std::vector<std::string> SerializeChunks(const Storage& statistics,
+                                           const Request& request,
+                                           std::size_t chunk_size);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Output `statistics` in Prometheus format, each metric has `gauge` type.
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request = {});
@@ -89,6 +89,12 @@ Client::Client(impl::ClientSettings settings,
                           [this] { ReinitEasy(); });
 
   SetConfig({});
+
+  SetMultiplexingEnabled(settings.multiplexing_enabled);
+  SetMaxConcurrentStreams(settings.max_concurrent_streams);
+  if (settings.max_host_connections) {
+    SetMaxHostConnections(settings.max_host_connections);
+  }
 }
 
 Client::~Client() {
@@ -179,6 +185,12 @@ void Client::SetMaxHostConnections(size_t max_host_connections) {
   }
 }
 
+void Client::SetMaxConcurrentStreams(size_t max_concurrent_streams) {
+  for (auto& multi : multis_) {
+    multi->SetMaxConcurrentStreams(ClampToLong(max_concurrent_streams));
+  }
+}
+
 std::string Client::GetProxy() const { return proxy_.ReadCopy(); }
 
 void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
@@ -204,6 +216,9 @@ InstanceStatistics Client::GetMultiStatistics(size_t n) const {
   s.multi.socket_open = multi_stats.open_socket_total();
   s.multi.current_load = multi_stats.get_busy_storage().GetCurrentLoad();
   s.multi.socket_ratelimit = multi_stats.socket_ratelimited_total();
+  s.multi.active_transfers = multi_stats.active_transfers();
+  s.multi.reused_connection = multi_stats.reused_connection_total();
+  s.multi.hol_wait = multi_stats.hol_wait_total();
   return s;
 }
 
@@ -0,0 +1,196 @@
+#include <userver/clients/http/client.hpp>
+
+#include <string_view>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <clients/http/statistics.hpp>
+#include <curl-ev/native.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kRequests = 10;
+constexpr auto kTimeout = std::chrono::seconds{5};
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+bool IsHttp2Supported() {
+  const auto* info =
+      curl::native::curl_version_info(curl::native::CURLVERSION_NOW);
+  return info && (info->features & CURL_VERSION_HTTP2);
+}
+
+// Minimal h2c (prior knowledge) server side of a single connection, responds
+// with an empty '200 OK' to every complete request.
+class Http2ServerSession final {
+ public:
+  explicit Http2ServerSession(std::chrono::milliseconds response_delay)
+      : response_delay_(response_delay) {
+    nghttp2_session_callbacks* callbacks = nullptr;
+    EXPECT_EQ(nghttp2_session_callbacks_new(&callbacks), 0);
+    nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                         &OnFrameRecv);
+    EXPECT_EQ(nghttp2_session_server_new(&session_, callbacks, this), 0);
+    nghttp2_session_callbacks_del(callbacks);
+
+    EXPECT_EQ(nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, nullptr, 0),
+              0);
+  }
+
+  ~Http2ServerSession() { nghttp2_session_del(session_); }
+
+  Http2ServerSession(const Http2ServerSession&) = delete;
+  Http2ServerSession& operator=(const Http2ServerSession&) = delete;
+
+  std::string Feed(std::string_view data) {
+    responses_submitted_ = 0;
+    const auto consumed = nghttp2_session_mem_recv(
+        session_, reinterpret_cast<const std::uint8_t*>(data.data()),
+        data.size());
+    EXPECT_EQ(consumed, static_cast<ssize_t>(data.size()));
+
+    if (responses_submitted_ != 0) {
+      engine::SleepFor(response_delay_);
+    }
+
+    std::string result;
+    while (true) {
+      const std::uint8_t* out = nullptr;
+      const auto size = nghttp2_session_mem_send(session_, &out);
+      if (size <= 0) break;
+      result.append(reinterpret_cast<const char*>(out), size);
+    }
+    return result;
+  }
+
+ private:
+  static int OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame,
+                         void* user_data) {
+    const bool is_request_end =
+        (frame->hd.type == NGHTTP2_HEADERS ||
+         frame->hd.type == NGHTTP2_DATA) &&
+        (frame->hd.flags & NGHTTP2_FLAG_END_STREAM);
+    if (!is_request_end) return 0;
+
+    static constexpr std::string_view kName = ":status";
+    static constexpr std::string_view kValue = "200";
+    nghttp2_nv status{
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<std::uint8_t*>(
+            reinterpret_cast<const std::uint8_t*>(kName.data())),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<std::uint8_t*>(
+            reinterpret_cast<const std::uint8_t*>(kValue.data())),
+        kName.size(), kValue.size(),
+        NGHTTP2_NV_FLAG_NO_COPY_NAME | NGHTTP2_NV_FLAG_NO_COPY_VALUE};
+    EXPECT_EQ(nghttp2_submit_response(session, frame->hd.stream_id, &status,
+                                      1, nullptr),
+              0);
+    ++static_cast<Http2ServerSession*>(user_data)->responses_submitted_;
+    return 0;
+  }
+
+  const std::chrono::milliseconds response_delay_;
+  nghttp2_session* session_{nullptr};
+  std::size_t responses_submitted_{0};
+};
+
+// SimpleServer copies the callback for each accepted connection, so every
+// connection gets its own HTTP/2 session.
+struct Http2PriorKnowledgeCallback {
+  HttpResponse operator()(const HttpRequest& request) {
+    if (!session) {
+      session = std::make_shared<Http2ServerSession>(response_delay);
+    }
+    return {session->Feed(request), HttpResponse::kWriteAndContinue};
+  }
+
+  std::chrono::milliseconds response_delay{0};
+  std::shared_ptr<Http2ServerSession> session{};
+};
+
+clients::http::InstanceStatistics GetStatistics(
+    const clients::http::Client& client) {
+  clients::http::InstanceStatistics result;
+  for (const auto& stats : client.GetPoolStatistics().multi) {
+    result += stats;
+  }
+  return result;
+}
+
+void PerformConcurrently(clients::http::Client& client,
+                         const std::string& url) {
+  std::vector<clients::http::ResponseFuture> futures;
+  futures.reserve(kRequests);
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    futures.push_back(
+        client.CreateRequest()
+            .get(url)
+            .http_version(clients::http::HttpVersion::k2PriorKnowledge)
+            .timeout(kTimeout)
+            .async_perform());
+  }
+
+  for (auto& future : futures) {
+    const auto response = future.Get();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  }
+}
+
+}  // namespace
+
+UTEST(HttpClient, Http2PriorKnowledgeMultiplexing) {
+  if (!IsHttp2Supported()) {
+    GTEST_SKIP() << "libcurl is built without HTTP/2 support";
+  }
+
+  const utest::SimpleServer http_server{Http2PriorKnowledgeCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  PerformConcurrently(*http_client_ptr, http_server.GetBaseUrl());
+
+  EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+
+  const auto stats = GetStatistics(*http_client_ptr);
+  EXPECT_EQ(stats.multi.socket_open, 1);
+  EXPECT_EQ(stats.multi.reused_connection, kRequests - 1);
+  EXPECT_EQ(stats.multi.active_transfers, 0);
+}
+
+UTEST(HttpClient, Http2MaxConcurrentStreams) {
+  if (!IsHttp2Supported()) {
+    GTEST_SKIP() << "libcurl is built without HTTP/2 support";
+  }
+
+  constexpr std::chrono::milliseconds kResponseDelay{5};
+  const utest::SimpleServer http_server{
+      Http2PriorKnowledgeCallback{kResponseDelay}};
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+  http_client_ptr->SetMaxConcurrentStreams(1);
+
+  const auto start = std::chrono::steady_clock::now();
+  PerformConcurrently(*http_client_ptr, http_server.GetBaseUrl());
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+
+  // With a single stream allowed per connection, the requests are not
+  // multiplexed and the server delays each of them separately.
+  EXPECT_GE(elapsed, kResponseDelay * kRequests);
+  const auto stats = GetStatistics(*http_client_ptr);
+  EXPECT_EQ(stats.multi.reused_connection, kRequests - 1);
+  // All the requests but the first one wait at least kResponseDelay for the
+  // previous stream to finish.
+  EXPECT_EQ(stats.multi.hol_wait, kRequests - 1);
+}
+
+USERVER_NAMESPACE_END
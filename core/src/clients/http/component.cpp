@@ -170,6 +170,18 @@ properties:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    multiplexing-enabled:
+        type: boolean
+        description: whether to multiplex concurrent requests to the same host over a single HTTP/2 connection
+        defaultDescription: true
+    max-host-connections:
+        type: integer
+        description: max number of connections to a single host per IO thread, 0 for unlimited
+        defaultDescription: 0
+    http2-max-concurrent-streams:
+        type: integer
+        description: max number of concurrent streams per HTTP/2 connection, also limited by the server SETTINGS
+        defaultDescription: 100
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
@@ -46,6 +46,13 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
+  result.multiplexing_enabled =
+      value["multiplexing-enabled"].As<bool>(result.multiplexing_enabled);
+  result.max_host_connections =
+      value["max-host-connections"].As<size_t>(result.max_host_connections);
+  result.max_concurrent_streams =
+      value["http2-max-concurrent-streams"].As<size_t>(
+          result.max_concurrent_streams);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
   return result;
 }
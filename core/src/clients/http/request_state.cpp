@@ -259,6 +259,14 @@ void RequestState::client_key_cert(crypto::PrivateKey pkey,
 
 void RequestState::http_version(curl::easy::http_version_t version) {
   easy().set_http_version(version);
+
+  // Prefer waiting for a connection that is being established (or for a free
+  // stream on an existing one) over opening a new connection, otherwise
+  // concurrent requests to a cold host never share an HTTP/2 connection.
+  easy().set_pipewait(
+      version == curl::easy::http_version_t::http_version_2_0 ||
+      version == curl::easy::http_version_t::http_vertion_2tls ||
+      version == curl::easy::http_version_t::http_version_2_prior_knowledge);
 }
 
 void RequestState::set_timeout(long timeout_ms) {
@@ -162,8 +162,18 @@ void DumpMetric(utils::statistics::Writer& writer,
     // it is very unjust to account active/closed sockets
     writer["sockets"]["close"] = stats.multi.socket_close;
     writer["sockets"]["throttled"] = stats.multi.socket_ratelimit;
-    writer["sockets"]["active"] =
+    const auto active_sockets =
         stats.multi.socket_open - stats.multi.socket_close;
+    writer["sockets"]["active"] = active_sockets;
+
+    // Transfers on a single connection are multiplexed over HTTP/2 streams,
+    // for HTTP/1.x the value never exceeds 1.
+    writer["multiplexing"]["streams-per-connection"] =
+        SumToMean(static_cast<double>(stats.multi.active_transfers),
+                  active_sockets);
+    writer["multiplexing"]["reused-connection"] =
+        stats.multi.reused_connection;
+    writer["multiplexing"]["hol-waits"] = stats.multi.hol_wait;
   }
 
   writer["sockets"]["open"] = stats.multi.socket_open;
@@ -44,12 +44,18 @@ struct MultiStats {
   uint64_t socket_open{0};
   uint64_t socket_close{0};
   uint64_t socket_ratelimit{0};
+  uint64_t active_transfers{0};
+  uint64_t reused_connection{0};
+  uint64_t hol_wait{0};
   double current_load{0};
 
   MultiStats& operator+=(const MultiStats& other) {
     socket_open += other.socket_open;
     socket_close += other.socket_close;
     socket_ratelimit += other.socket_ratelimit;
+    active_transfers += other.active_transfers;
+    reused_connection += other.reused_connection;
+    hol_wait += other.hol_wait;
     current_load += other.current_load;
     return *this;
   }
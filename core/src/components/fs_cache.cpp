@@ -16,7 +16,8 @@ FsCache::FsCache(const components::ComponentConfig& config,
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
           context.GetTaskProcessor(config["fs-task-processor"].As<std::string>(
-              "fs-task-processor"))) {}
+              "fs-task-processor")),
+          config["zero-copy"].As<bool>(false)) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
@@ -37,6 +38,12 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    zero-copy:
+        type: boolean
+        description: |
+            keep the files opened instead of reading them into memory,
+            server::handlers::HttpHandlerStatic sends them with sendfile
+        defaultDescription: false
 )");
 }
 
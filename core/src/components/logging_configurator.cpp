@@ -3,6 +3,7 @@
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampling.hpp>
 #include <userver/components/component.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
@@ -26,6 +27,13 @@ tracing::NoLogSpans ParseNoLogSpans(const dynamic_config::DocsMap& docs_map) {
 constexpr dynamic_config::Key<ParseNoLogSpans> kNoLogSpans{};
 /// [key]
 
+tracing::SamplingConfig ParseTracingSampling(
+    const dynamic_config::DocsMap& docs_map) {
+  return docs_map.Get("USERVER_TRACING_SAMPLING").As<tracing::SamplingConfig>();
+}
+
+constexpr dynamic_config::Key<ParseTracingSampling> kTracingSampling{};
+
 logging::DynamicDebugConfig ParseDynamicDebug(
     const dynamic_config::DocsMap& docs_map) {
   return docs_map.Get("USERVER_LOG_DYNAMIC_DEBUG")
@@ -57,6 +65,7 @@ void LoggingConfigurator::OnConfigUpdate(
     const dynamic_config::Snapshot& config) {
   (void)this;  // silence clang-tidy
   tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+  tracing::impl::SetSamplingConfig(config[kTracingSampling]);
 
   try {
     const auto& dd = config[kDynamicDebugConfig];
@@ -165,6 +165,12 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-stats:
+                    type: boolean
+                    description: |
+                        collect execution, queue wait and wait times per
+                        task name
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
@@ -16,6 +16,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+namespace impl {
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TaskStatsSnapshot& snapshot) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  writer["tasks"] = snapshot.tasks;
+  writer["context-switches"] = snapshot.context_switches;
+  writer["execution-us"] =
+      duration_cast<microseconds>(snapshot.execution_time).count();
+  writer["queue-wait-us"] =
+      duration_cast<microseconds>(snapshot.queue_wait_time).count();
+  for (std::size_t i = 0; i < kTaskWaitKindsCount; ++i) {
+    writer["wait-us"].ValueWithLabels(
+        duration_cast<microseconds>(snapshot.wait_time[i]).count(),
+        {{"wait_kind", ToString(static_cast<TaskWaitKind>(i))}});
+  }
+}
+
+}  // namespace impl
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const engine::TaskProcessor& task_processor) {
   const auto& counter = task_processor.GetTaskCounter();
@@ -49,6 +71,14 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 
   writer["worker-threads"] = task_processor.GetWorkerCount();
+
+  const auto& task_stats = task_processor.GetTaskStats();
+  if (task_stats.IsEnabled()) {
+    auto stats_writer = writer["task-stats"];
+    for (const auto& snapshot : task_stats.GetSnapshots()) {
+      stats_writer.ValueWithLabels(snapshot, {{"task_name", snapshot.name}});
+    }
+  }
 }
 
 }  // namespace engine
@@ -1,5 +1,8 @@
 #include <compression/gzip.hpp>
 
+#include <utility>
+
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -11,6 +14,8 @@ namespace {
 constexpr auto kDecompressBufferSize = 1024;
 }
 
+namespace bio = boost::iostreams;
+
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
 
@@ -19,8 +24,6 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   // (stdlibc++ allocates capacity+1 bytes).
   decompressed.reserve(kDecompressBufferSize - 1);
 
-  namespace bio = boost::iostreams;
-
   bio::filtering_istream stream;
   stream.push(bio::gzip_decompressor());
   stream.push(bio::array_source(compressed.data(), compressed.size()));
@@ -38,6 +41,55 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+struct StreamDecompressor::Impl {
+  explicit Impl(size_t max_size) : max_size(max_size) {
+    stream.push(bio::gzip_decompressor());
+    stream.push(bio::back_inserter(output));
+  }
+
+  std::string TakeOutput() {
+    decompressed_size += output.size();
+    if (decompressed_size > max_size) throw TooBigError();
+    return std::exchange(output, {});
+  }
+
+  // Declared before the stream, which writes to it on destruction
+  std::string output;
+  bio::filtering_ostream stream;
+  const size_t max_size;
+  size_t decompressed_size{0};
+};
+
+StreamDecompressor::StreamDecompressor(size_t max_size)
+    : impl_(std::make_unique<Impl>(max_size)) {}
+
+StreamDecompressor::StreamDecompressor(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor& StreamDecompressor::operator=(
+    StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor::~StreamDecompressor() = default;
+
+std::string StreamDecompressor::Decompress(std::string_view compressed) {
+  impl_->stream.write(compressed.data(), compressed.size());
+  impl_->stream.flush();
+  if (!impl_->stream) {
+    throw DecompressionError("failed to decompress gzip'ed data");
+  }
+  return impl_->TakeOutput();
+}
+
+std::string StreamDecompressor::Finish() {
+  try {
+    // closes the chain, the decompressor checks the gzip footer
+    impl_->stream.pop();
+  } catch (const std::exception& e) {
+    throw DecompressionError(
+        std::string{"failed to decompress gzip'ed data: "} + e.what());
+  }
+  return impl_->TakeOutput();
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <compression/error.hpp>
@@ -12,6 +14,30 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Decompresses the data received in chunks, e.g. a streamed request body.
+class StreamDecompressor final {
+ public:
+  explicit StreamDecompressor(size_t max_size);
+
+  StreamDecompressor(StreamDecompressor&&) noexcept;
+  StreamDecompressor& operator=(StreamDecompressor&&) noexcept;
+  ~StreamDecompressor();
+
+  /// Decompresses the next chunk of data. Part of the decompressed data may be
+  /// returned by the next calls.
+  /// @throws DecompressionError
+  std::string Decompress(std::string_view compressed);
+
+  /// Returns the rest of decompressed data and checks that the compressed data
+  /// is complete.
+  /// @throws DecompressionError
+  std::string Finish();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
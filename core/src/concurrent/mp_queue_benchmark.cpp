@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -31,6 +33,37 @@ auto GetConsumerTask(std::shared_ptr<QueueType> queue,
     }
   });
 }
+template <typename QueueType>
+auto GetBatchProducerTask(std::shared_ptr<QueueType> queue,
+                          std::atomic<bool>& run, std::size_t batch_size) {
+  return utils::Async(
+      "producer", [producer = queue->GetProducer(), &run, batch_size] {
+        std::vector<std::size_t> batch(batch_size);
+        std::size_t message = 0;
+        while (run) {
+          for (auto& value : batch) value = message++;
+          auto res = producer.PushMany(batch);
+          benchmark::DoNotOptimize(res);
+        }
+      });
+}
+
+template <typename QueueType>
+auto GetBatchConsumerTask(std::shared_ptr<QueueType> queue,
+                          const std::atomic<bool>& run,
+                          std::size_t batch_size) {
+  return utils::Async(
+      "consumer", [consumer = queue->GetConsumer(), &run, batch_size] {
+        std::vector<std::size_t> values;
+        values.reserve(batch_size);
+        while (run) {
+          auto res = consumer.PopMany(values, batch_size);
+          benchmark::DoNotOptimize(res);
+          values.clear();
+        }
+      });
+}
+
 }  // namespace
 
 template <typename QueueType>
@@ -71,10 +104,63 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {128, 512}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {128, 512}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {1'000'000'000, 1'000'000'000}});
 
+// Producers and consumers move the items in batches of the given size
+template <typename QueueType>
+void producer_consumer_batch(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + state.range(1), [&] {
+    const std::size_t producers_count = state.range(0);
+    const std::size_t consumers_count = state.range(1);
+    const std::size_t batch_size = state.range(2);
+
+    std::atomic<bool> run{true};
+    auto queue = QueueType::Create(1024);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(producers_count + consumers_count - 1);
+    for (std::size_t i = 0; i < producers_count - 1; ++i) {
+      tasks.push_back(GetBatchProducerTask(queue, run, batch_size));
+    }
+    for (std::size_t i = 0; i < consumers_count; ++i) {
+      tasks.push_back(GetBatchConsumerTask(queue, run, batch_size));
+    }
+
+    // Current thread work
+    {
+      std::vector<std::size_t> batch(batch_size);
+      std::size_t message = 0;
+      auto producer = queue->GetProducer();
+      for (auto _ : state) {
+        for (auto& value : batch) value = message++;
+        auto res = producer.PushMany(batch);
+        benchmark::DoNotOptimize(res);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * producers_count *
+                            batch_size);
+
+    run = false;
+  });
+}
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->ArgsProduct({{1, 4}, {1, 4}, {1, 16, 256}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::BoundedMpmcQueue<std::size_t>)
+    ->ArgsProduct({{1, 4}, {1, 4}, {1, 16, 256}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch, concurrent::SpscQueue<std::size_t>)
+    ->ArgsProduct({{1}, {1}, {1, 16, 256}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
@@ -17,6 +17,7 @@ namespace {
 constexpr std::size_t kProducersCount = 4;
 constexpr std::size_t kConsumersCount = 4;
 constexpr std::size_t kMessageCount = 1000;
+constexpr std::size_t kBatchSize = 7;
 
 template <typename Producer>
 auto GetProducerTask(const Producer& producer, std::size_t i) {
@@ -45,6 +46,68 @@ using TestQueueTypes = testing::Types<concurrent::NonFifoMpmcQueue<std::size_t>,
                                       concurrent::SpmcQueue<std::size_t>,
                                       concurrent::SpscQueue<std::size_t>>;
 
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
+using TestBatchTypes =
+    testing::Types<concurrent::NonFifoMpmcQueue<std::size_t>,
+                   concurrent::NonFifoMpscQueue<std::size_t>,
+                   concurrent::SpmcQueue<std::size_t>,
+                   concurrent::SpscQueue<std::size_t>,
+                   concurrent::BoundedMpmcQueue<std::size_t>>;
+
+template <typename Queue>
+void TestBatchMpmc() {
+  auto queue = Queue::Create(kMessageCount / 10);
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [producer = queue->GetProducer(), i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_EQ(producer.PushMany(batch), kBatchSize);
+              batch.clear();
+            }
+          }
+          ASSERT_EQ(producer.PushMany(batch), batch.size());
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize * 2) != 0) {
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+  queue.reset();
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+}
+
 }  // namespace
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpmcQueue, QueueFixture,
@@ -83,6 +146,104 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_UTEST_SUITE(BatchTest, TestBatchTypes);
+
+TYPED_UTEST_MT(BatchTest, PushPopMany, 2) {
+  auto queue = TypeParam::Create(10);
+  std::optional producer(queue->GetProducer());
+  auto consumer = queue->GetConsumer();
+
+  auto producer_task = utils::Async("producer", [&producer] {
+    std::vector<std::size_t> batch;
+    for (std::size_t message = 0; message < kMessageCount; ++message) {
+      batch.push_back(message);
+      // larger than the queue, so the producer waits for the consumer
+      if (batch.size() == 25) {
+        ASSERT_EQ(producer->PushMany(batch), batch.size());
+        batch.clear();
+      }
+    }
+    ASSERT_EQ(producer->PushMany(batch), batch.size());
+    producer.reset();
+  });
+
+  std::vector<std::size_t> values;
+  std::size_t popped = 0;
+  while ((popped = consumer.PopMany(values, 8)) != 0) {
+    EXPECT_LE(popped, 8);
+  }
+  producer_task.Get();
+
+  // the order of a single producer is kept
+  ASSERT_EQ(values.size(), kMessageCount);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], i);
+  }
+}
+
+TYPED_UTEST(BatchTest, PushManyDeadline) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> batch{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(producer.PushMany(batch, engine::Deadline::FromDuration(
+                                         std::chrono::milliseconds{10})),
+            4);
+  EXPECT_EQ(queue->GetSizeApproximate(), 4);
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopMany(values, 0), 0);
+  EXPECT_EQ(consumer.PopMany(values, 3), 3);
+  EXPECT_EQ(consumer.PopMany(values, 3), 1);
+  EXPECT_EQ(values, (std::vector<std::size_t>{1, 2, 3, 4}));
+  EXPECT_EQ(consumer.PopMany(values, 3, engine::Deadline::FromDuration(
+                                            std::chrono::milliseconds{10})),
+            0);
+}
+
+UTEST_MT(NonFifoMpmcQueue, BatchMpmc, kProducersCount + kConsumersCount) {
+  TestBatchMpmc<concurrent::NonFifoMpmcQueue<std::size_t>>();
+}
+
+UTEST_MT(BoundedMpmcQueue, BatchMpmc, kProducersCount + kConsumersCount) {
+  TestBatchMpmc<concurrent::BoundedMpmcQueue<std::size_t>>();
+}
+
+UTEST_MT(BoundedMpmcQueue, Fifo, 2) {
+  auto queue = concurrent::BoundedMpmcQueue<std::unique_ptr<int>>::Create(3);
+  // rounded up to a power of two
+  queue->SetSoftMaxSize(100);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 4);
+
+  std::optional producer(queue->GetProducer());
+  auto consumer = queue->GetConsumer();
+  auto producer_task = utils::Async("producer", [&producer] {
+    for (int i = 0; i < static_cast<int>(kMessageCount); ++i) {
+      ASSERT_TRUE(producer->Push(std::make_unique<int>(i)));
+    }
+    producer.reset();
+  });
+
+  std::unique_ptr<int> value;
+  for (int i = 0; i < static_cast<int>(kMessageCount); ++i) {
+    ASSERT_TRUE(consumer.Pop(value));
+    ASSERT_EQ(*value, i);
+  }
+  EXPECT_FALSE(consumer.Pop(value));
+  producer_task.Get();
+}
+
+UTEST(BoundedMpmcQueue, ConsumerIsDead) {
+  auto queue = concurrent::BoundedMpmcQueue<int>::Create(16);
+  auto producer = queue->GetProducer();
+
+  (void)(queue->GetConsumer());
+  EXPECT_FALSE(producer.Push(0));
+  std::vector<int> batch{1, 2};
+  EXPECT_EQ(producer.PushMany(batch), 0);
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
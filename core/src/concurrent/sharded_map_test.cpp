@@ -0,0 +1,108 @@
+#include <userver/concurrent/sharded_map.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedMap, Empty) {
+  concurrent::ShardedMap<std::string, int> map;
+  const auto& cmap = map;
+
+  EXPECT_EQ(0, map.SizeApprox());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(cmap.begin(), cmap.end());
+  EXPECT_TRUE(map.GetSnapshot().empty());
+  UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+}
+
+UTEST(ShardedMap, Modify) {
+  concurrent::ShardedMap<std::string, int> map{4};
+  const auto& cmap = map;
+
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+
+  UEXPECT_NO_THROW(*map["any"] = 1);
+  EXPECT_EQ(1, *cmap["any"]);
+  EXPECT_EQ(1, *cmap.Get("any"));
+  EXPECT_TRUE(map.Erase("any"));
+  EXPECT_FALSE(map.Erase("any"));
+
+  EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+  EXPECT_EQ(*map.Insert("any", std::make_shared<int>(0)).value, 3);
+  EXPECT_EQ(*map.Pop("any"), 3);
+
+  EXPECT_TRUE(map.Emplace("any", 4).inserted);
+  EXPECT_FALSE(map.Emplace("any", 0).inserted);
+  EXPECT_EQ(*map.Pop("any"), 4);
+
+  EXPECT_TRUE(map.TryEmplace("any", 5).inserted);
+  EXPECT_EQ(*map.TryEmplace("any", 0).value, 5);
+
+  map.InsertOrAssign("any", std::make_shared<int>(6));
+  EXPECT_EQ(*cmap["any"], 6);
+}
+
+UTEST(ShardedMap, IterationAndSnapshot) {
+  /// [Sample concurrent::ShardedMap usage]
+  concurrent::ShardedMap<int, int> map{8};
+
+  for (int i = 0; i < 100; ++i) map.Emplace(i, i * 10);
+  EXPECT_EQ(map.SizeApprox(), 100);
+
+  int sum = 0;
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(*value, key * 10);
+    sum += key;
+  }
+  EXPECT_EQ(sum, 99 * 100 / 2);
+  /// [Sample concurrent::ShardedMap usage]
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_EQ(snapshot.size(), 100);
+
+  map.Clear();
+  EXPECT_EQ(map.SizeApprox(), 0);
+  EXPECT_EQ(snapshot.size(), 100);
+
+  std::unordered_map<int, std::shared_ptr<int>> raw;
+  for (int i = 0; i < 10; ++i) raw.emplace(i, std::make_shared<int>(i));
+  map.Assign(std::move(raw));
+  EXPECT_EQ(map.SizeApprox(), 10);
+  EXPECT_EQ(*map[7], 7);
+}
+
+UTEST_MT(ShardedMap, ConcurrentWrites, 4) {
+  constexpr int kTasks = 4;
+  constexpr int kKeysPerTask = 1000;
+  concurrent::ShardedMap<int, int> map;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int task = 0; task < kTasks; ++task) {
+    tasks.push_back(utils::Async("writer", [&map, task] {
+      for (int i = 0; i < kKeysPerTask; ++i) {
+        const int key = task * kKeysPerTask + i;
+        map.Emplace(key, key);
+        if (i % 2) {
+          EXPECT_TRUE(map.Erase(key));
+        }
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(map.SizeApprox(), kTasks * kKeysPerTask / 2);
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(key % 2, 0);
+    EXPECT_EQ(*value, key);
+  }
+}
+
+USERVER_NAMESPACE_END
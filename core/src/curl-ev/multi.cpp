@@ -6,7 +6,10 @@
         Integration of libcurl's multi interface with Boost.Asio
 */
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <map>
 #include <string_view>
 #include <system_error>
 
@@ -37,14 +40,54 @@ const char* GetSetterName(native::CURLMoption option) {
       return "SetMaxHostConnections";
     case native::CURLMOPT_MAXCONNECTS:
       return "SetConnectionCacheSize";
+    case native::CURLMOPT_MAX_CONCURRENT_STREAMS:
+      return "SetMaxConcurrentStreams";
     default:
       return "<unknown setter>";
   }
 }
 
+// A transfer that reused an existing connection but still spent this long
+// before it could start sending is considered to have waited for a free
+// stream (or for the connection to become multiplexable).
+constexpr std::chrono::microseconds kHolWaitThreshold{1000};
+
+std::chrono::microseconds GetInfoTime(native::CURL* native_easy,
+                                      native::CURLINFO info) noexcept {
+  native::curl_off_t usec = 0;
+  if (native::curl_easy_getinfo(native_easy, info, &usec) != native::CURLE_OK) {
+    return {};
+  }
+  return std::chrono::microseconds{usec};
+}
+
+void AccountTransferDone(
+    MultiStatistics& statistics, native::CURL* native_easy,
+    std::chrono::steady_clock::time_point added_ts) noexcept {
+  long num_connects = 0;
+  if (native::curl_easy_getinfo(native_easy, native::CURLINFO_NUM_CONNECTS,
+                                &num_connects) != native::CURLE_OK ||
+      num_connects != 0) {
+    return;
+  }
+  statistics.mark_reused_connection();
+
+  // Depending on the libcurl version the time spent in the pending queue is
+  // either a part of the pretransfer time or precedes the total time.
+  const auto queued = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - added_ts -
+      GetInfoTime(native_easy, native::CURLINFO_TOTAL_TIME_T));
+  const auto pretransfer =
+      GetInfoTime(native_easy, native::CURLINFO_PRETRANSFER_TIME_T);
+  if (std::max(queued, pretransfer) >= kHolWaitThreshold) {
+    statistics.mark_hol_wait();
+  }
+}
+
 }  // namespace
 
-using easy_set_type = std::set<easy*>;
+// transfers with the time they were added at
+using easy_set_type = std::map<easy*, std::chrono::steady_clock::time_point>;
 using BusyMarker = utils::statistics::BusyMarker;
 
 class multi::Impl final {
@@ -93,7 +136,7 @@ multi::multi(engine::ev::ThreadControl& thread_control,
 multi::~multi() {
   while (!pimpl_->easy_handles_.empty()) {
     auto it = pimpl_->easy_handles_.begin();
-    easy* easy_handle = *it;
+    easy* easy_handle = it->first;
     easy_handle->cancel();
   }
 
@@ -107,8 +150,10 @@ multi::~multi() {
 }
 
 void multi::add(easy* easy_handle) {
-  pimpl_->easy_handles_.insert(easy_handle);
+  pimpl_->easy_handles_.emplace(easy_handle,
+                                std::chrono::steady_clock::now());
   add_handle(easy_handle->native_handle());
+  statistics_.mark_transfer_start();
 }
 
 void multi::remove(easy* easy_handle) {
@@ -117,6 +162,7 @@ void multi::remove(easy* easy_handle) {
   if (it != pimpl_->easy_handles_.end()) {
     pimpl_->easy_handles_.erase(it);
     remove_handle(easy_handle->native_handle());
+    statistics_.mark_transfer_finish();
   }
 }
 
@@ -140,7 +186,10 @@ void multi::CheckRateLimit(const char* url_str, std::error_code& ec) {
 }
 
 void multi::SetMultiplexingEnabled(bool value) {
-  SetOptionAsync(native::CURLMOPT_PIPELINING, value ? 1 : 0);
+  // CURLPIPE_HTTP1 is a no-op since libcurl 7.62, HTTP/2 multiplexing has to
+  // be requested explicitly.
+  SetOptionAsync(native::CURLMOPT_PIPELINING,
+                 value ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
 }
 
 void multi::SetMaxHostConnections(long value) {
@@ -151,6 +200,10 @@ void multi::SetConnectionCacheSize(long value) {
   SetOptionAsync(native::CURLMOPT_MAXCONNECTS, value);
 }
 
+void multi::SetMaxConcurrentStreams(long value) {
+  SetOptionAsync(native::CURLMOPT_MAX_CONCURRENT_STREAMS, value);
+}
+
 void multi::add_handle(native::CURL* native_easy) {
   std::error_code ec{static_cast<errc::MultiErrorCode>(
       native::curl_multi_add_handle(handle_, native_easy))};
@@ -261,6 +314,12 @@ void multi::process_messages() {
             std::error_code{static_cast<errc::EasyErrorCode>(msg->data.result)};
       }
 
+      // Failed transfers may have never got a connection
+      const auto it = pimpl_->easy_handles_.find(easy_handle);
+      if (msg->data.result == native::CURLE_OK &&
+          it != pimpl_->easy_handles_.end()) {
+        AccountTransferDone(statistics_, msg->easy_handle, it->second);
+      }
       remove(easy_handle);
       LOG_TRACE() << "mult::process_messages() handle_completion";
       easy_handle->handle_completion(ec);
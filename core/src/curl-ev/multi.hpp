@@ -57,6 +57,7 @@ class multi final {
   void SetMultiplexingEnabled(bool);
   void SetMaxHostConnections(long);
   void SetConnectionCacheSize(long);
+  void SetMaxConcurrentStreams(long);
 
  private:
   void add_handle(native::CURL* native_easy);
@@ -14,6 +14,14 @@ void MultiStatistics::mark_close_socket() { close_++; }
 
 void MultiStatistics::mark_socket_ratelimited() { ratelimited_++; }
 
+void MultiStatistics::mark_transfer_start() { active_transfers_++; }
+
+void MultiStatistics::mark_transfer_finish() { active_transfers_--; }
+
+void MultiStatistics::mark_reused_connection() { reused_connection_++; }
+
+void MultiStatistics::mark_hol_wait() { hol_wait_++; }
+
 long long MultiStatistics::open_socket_total() const { return open_.load(); }
 
 long long MultiStatistics::close_socket_total() const { return close_.load(); }
@@ -22,6 +30,16 @@ long long MultiStatistics::socket_ratelimited_total() const {
   return ratelimited_.load();
 }
 
+long long MultiStatistics::active_transfers() const {
+  return active_transfers_.load();
+}
+
+long long MultiStatistics::reused_connection_total() const {
+  return reused_connection_.load();
+}
+
+long long MultiStatistics::hol_wait_total() const { return hol_wait_.load(); }
+
 utils::statistics::BusyStorage& MultiStatistics::get_busy_storage() {
   return busy_storage_;
 }
@@ -16,10 +16,17 @@ class MultiStatistics final {
   void mark_open_socket();
   void mark_close_socket();
   void mark_socket_ratelimited();
+  void mark_transfer_start();
+  void mark_transfer_finish();
+  void mark_reused_connection();
+  void mark_hol_wait();
 
   long long open_socket_total() const;
   long long close_socket_total() const;
   long long socket_ratelimited_total() const;
+  long long active_transfers() const;
+  long long reused_connection_total() const;
+  long long hol_wait_total() const;
 
   utils::statistics::BusyStorage& get_busy_storage();
   const utils::statistics::BusyStorage& get_busy_storage() const;
@@ -28,6 +35,9 @@ class MultiStatistics final {
   std::atomic_llong open_{0};
   std::atomic_llong close_{0};
   std::atomic_llong ratelimited_{0};
+  std::atomic_llong active_transfers_{0};
+  std::atomic_llong reused_connection_{0};
+  std::atomic_llong hol_wait_{0};
   utils::statistics::BusyStorage busy_storage_;
 };
 
@@ -0,0 +1,16 @@
+#include <userver/engine/fast_task.hpp>
+
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+void DoSubmitFastTask(TaskProcessor& task_processor,
+                      std::unique_ptr<FastTaskBase>&& task) {
+  task_processor.ScheduleFast(std::move(task));
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/fast_task.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void WaitForZero(const std::atomic<std::size_t>& counter) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (counter != 0 && !deadline.IsReached()) engine::Yield();
+  ASSERT_EQ(counter, 0);
+}
+
+}  // namespace
+
+UTEST_MT(FastTask, Runs, 4) {
+  constexpr std::size_t kTasksCount = 1000;
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  std::atomic<std::size_t> left{kTasksCount};
+  for (std::size_t i = 0; i < kTasksCount; ++i) {
+    engine::SubmitFastTask(task_processor, [&left] {
+      EXPECT_FALSE(engine::current_task::IsTaskProcessorThread());
+      --left;
+    });
+  }
+  WaitForZero(left);
+}
+
+UTEST(FastTask, InterleavesWithTasks) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  std::atomic<std::size_t> left{2};
+  auto task = engine::AsyncNoSpan([&] {
+    engine::SubmitFastTask(task_processor, [&left] { --left; });
+    engine::Yield();
+    --left;
+  });
+  WaitForZero(left);
+  task.Get();
+}
+
+UTEST(FastTask, ExpiredDeadline) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  std::atomic<std::size_t> left{1};
+  engine::SubmitFastTask(task_processor, engine::Deadline::Passed(), [] {
+    ADD_FAILURE() << "A fast task with an expired deadline should be dropped";
+  });
+  engine::SubmitFastTask(task_processor, engine::Deadline::FromDuration(1h),
+                         [&left] { --left; });
+  WaitForZero(left);
+}
+
+UTEST(FastTask, Critical) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  std::atomic<std::size_t> left{1};
+  engine::SubmitCriticalFastTask(task_processor, [&left] { --left; });
+  WaitForZero(left);
+}
+
+UTEST(FastTask, Exception) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  std::atomic<std::size_t> left{2};
+  engine::SubmitFastTask(task_processor, [&left] {
+    --left;
+    throw std::runtime_error{"fast task failure"};
+  });
+  engine::SubmitFastTask(task_processor, [&left] { --left; });
+  WaitForZero(left);
+}
+
+UTEST_DEATH(FastTaskDeathTest, Suspending) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  const auto submit_sleeping_fast_task = [&task_processor] {
+    std::atomic<std::size_t> left{1};
+    engine::SubmitFastTask(task_processor, [&left] {
+      engine::SleepFor(1ms);
+      --left;
+    });
+    WaitForZero(left);
+  };
+  UEXPECT_DEATH(submit_sleeping_fast_task(), "fast task");
+}
+
+USERVER_NAMESPACE_END
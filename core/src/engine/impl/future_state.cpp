@@ -33,7 +33,9 @@ class FutureStateBase::WaitStrategy final : public impl::WaitStrategy {
  public:
   WaitStrategy(FutureStateBase& state, impl::TaskContext& context,
                Deadline deadline)
-      : impl::WaitStrategy(deadline), state_(state), context_(context) {}
+      : impl::WaitStrategy(deadline, TaskWaitKind::kFuture),
+        state_(state),
+        context_(context) {}
 
   void SetupWakeups() override {
     state_.finish_waiters_->Append(&context_);
@@ -48,7 +48,7 @@ class MutexImpl<WaitList>::MutexWaitStrategy final : public WaitStrategy {
  public:
   MutexWaitStrategy(MutexImpl<WaitList>& mutex, TaskContext& current,
                     Deadline deadline)
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, TaskWaitKind::kMutex),
         mutex_(mutex),
         current_(current),
         waiter_token_(mutex_.lock_waiters_),
@@ -76,7 +76,9 @@ class MutexImpl<WaitListLight>::MutexWaitStrategy final : public WaitStrategy {
  public:
   MutexWaitStrategy(MutexImpl<WaitListLight>& mutex, TaskContext& current,
                     Deadline deadline)
-      : WaitStrategy(deadline), mutex_(mutex), current_(current) {}
+      : WaitStrategy(deadline, TaskWaitKind::kMutex),
+        mutex_(mutex),
+        current_(current) {}
 
   void SetupWakeups() override {
     mutex_.lock_waiters_.Append(&current_);
@@ -17,7 +17,9 @@ class WaitAnyWaitStrategy final : public WaitStrategy {
   WaitAnyWaitStrategy(Deadline deadline,
                       utils::impl::Span<ContextAccessor*> targets,
                       TaskContext& current)
-      : WaitStrategy(deadline), current_(current), targets_(targets) {}
+      : WaitStrategy(deadline, TaskWaitKind::kFuture),
+        current_(current),
+        targets_(targets) {}
 
   void SetupWakeups() override {
     for (auto& target : targets_) {
@@ -86,6 +86,13 @@ class Direction final {
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // (IoFunc*)(int, size_t, size_t) called with the number of already
+  // processed bytes and the number of bytes left, e.g. sendfile
+  template <typename IoFunc, typename... Context>
+  size_t PerformIoWithoutBuffer(SingleUserGuard& guard, IoFunc&& io_func,
+                                size_t len, TransferMode mode,
+                                Deadline deadline, const Context&... context);
+
  private:
   friend class FdControl;
   explicit Direction(Kind kind);
@@ -249,6 +256,29 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
   return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoWithoutBuffer(SingleUserGuard&, IoFunc&& io_func,
+                                         size_t len, TransferMode mode,
+                                         Deadline deadline,
+                                         const Context&... context) {
+  size_t processed_bytes = 0;
+  while (processed_bytes < len) {
+    auto chunk_size = io_func(Fd(), processed_bytes, len - processed_bytes);
+
+    if (chunk_size > 0) {
+      processed_bytes += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!chunk_size ||
+               TryHandleError(errno, processed_bytes, mode, deadline,
+                              context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return processed_bytes;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
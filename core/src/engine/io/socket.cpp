@@ -1,10 +1,15 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -106,6 +111,35 @@ class SendToWrapper {
   const Sockaddr& dest_addr_;
 };
 
+class SendFileWrapper {
+ public:
+  SendFileWrapper(int in_fd, size_t offset) : in_fd_(in_fd), offset_(offset) {}
+
+  [[nodiscard]] ssize_t operator()(int fd, size_t processed_bytes,
+                                   size_t len) const {
+#ifdef __linux__
+    auto offset = static_cast<off_t>(offset_ + processed_bytes);
+    return ::sendfile(fd, in_fd_, &offset, len);
+#else
+    // MAC_COMPAT: sendfile has a different signature on BSD systems
+    std::array<char, kSendFileBufferSize> buf;
+    const auto read_bytes =
+        ::pread(in_fd_, buf.data(), std::min(len, buf.size()),
+                static_cast<off_t>(offset_ + processed_bytes));
+    if (read_bytes <= 0) return read_bytes;
+    return SendWrapper(fd, buf.data(), read_bytes);
+#endif
+  }
+
+ private:
+#ifndef __linux__
+  static constexpr size_t kSendFileBufferSize = 16 * 1024;
+#endif
+
+  const int in_fd_;
+  const size_t offset_;
+};
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -282,6 +316,18 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
                        peername_);
 }
 
+size_t Socket::SendFile(int in_fd, size_t offset, size_t len,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendFile to closed socket");
+  }
+  auto& dir = fd_control_->Write();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoWithoutBuffer(guard, SendFileWrapper{in_fd, offset}, len,
+                                    impl::TransferMode::kWhole, deadline,
+                                    "SendFile to ", peername_);
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len,
                                             Deadline deadline) {
   if (!IsValid()) {
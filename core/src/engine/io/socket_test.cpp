@@ -17,6 +17,9 @@
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -419,6 +422,42 @@ UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
   /// [send self concurrent]
 }
 
+UTEST(Socket, SendFile) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  // larger than the socket buffers to make sendfile wait for the reader
+  std::string data;
+  for (std::size_t i = 0; data.size() < 8 * 1024 * 1024; ++i) {
+    data += std::to_string(i);
+  }
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), data);
+  const auto fd = fs::blocking::FileDescriptor::Open(
+      file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+  TcpListener listener;
+  auto sockets = listener.MakeSocketPair(deadline);
+  const std::size_t offset = 123;
+  const auto expected = data.substr(offset);
+
+  auto read_task = engine::AsyncNoSpan([&sockets, &deadline, &expected] {
+    std::string received(expected.size() + 1, '\0');
+    const auto bytes_read =
+        sockets.first.RecvAll(received.data(), expected.size(), deadline);
+    received.resize(bytes_read);
+    EXPECT_EQ(received, expected);
+  });
+
+  // the file is shorter than requested
+  EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), offset, data.size(),
+                                    deadline),
+            expected.size());
+  read_task.Get();
+
+  EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), data.size(), 1, deadline),
+            0);
+}
+
 UTEST(Socket, WriteALot) {
   const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -11,6 +11,7 @@
 #include <crypto/openssl.hpp>
 #include <engine/io/fd_control.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -225,6 +226,32 @@ SslCtx MakeSslCtx() {
   return ssl_ctx;
 }
 
+void SetUpSessionResumption(SSL_CTX* ssl_ctx,
+                            const TlsServerSettings& settings) {
+  if (settings.session_cache_size > 0) {
+    SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_sess_set_cache_size(ssl_ctx, settings.session_cache_size);
+  } else {
+    SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_OFF);
+  }
+  SSL_CTX_set_timeout(ssl_ctx, settings.session_timeout.count());
+
+  // required to resume sessions of verified clients
+  static constexpr std::string_view kSessionIdContext = "userver";
+  if (1 != SSL_CTX_set_session_id_context(
+               ssl_ctx,
+               reinterpret_cast<const unsigned char*>(kSessionIdContext.data()),
+               kSessionIdContext.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: "
+        "SSL_CTX_set_session_id_context"));
+  }
+
+  if (!settings.session_tickets) {
+    SSL_CTX_set_options(ssl_ctx, SSL_OP_NO_TICKET);
+  }
+}
+
 enum InterruptAction {
   kPass,
   kFail,
@@ -232,6 +259,57 @@ enum InterruptAction {
 
 }  // namespace
 
+struct TlsServerContext::Impl {
+  SslCtx ssl_ctx;
+  bool is_kernel_tls{false};
+};
+
+TlsServerContext::TlsServerContext(const TlsServerSettings& settings)
+    : impl_(std::make_unique<Impl>()) {
+  auto ssl_ctx = MakeSslCtx();
+
+  if (!settings.cert_authorities.empty()) {
+    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
+    for (const auto& ca : settings.cert_authorities) {
+      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
+        throw TlsException(crypto::FormatSslError(
+            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
+      }
+    }
+  }
+
+  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), settings.cert.GetNative())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
+  }
+
+  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), settings.key.GetNative())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
+  }
+
+  SetUpSessionResumption(ssl_ctx.get(), settings);
+
+  if (settings.kernel_tls) {
+#ifdef SSL_OP_ENABLE_KTLS
+    SSL_CTX_set_options(ssl_ctx.get(), SSL_OP_ENABLE_KTLS);
+    impl_->is_kernel_tls = true;
+#else
+    LOG_WARNING() << "Kernel TLS is not supported by the OpenSSL version, "
+                     "using userspace encryption";
+#endif
+  }
+
+  impl_->ssl_ctx = std::move(ssl_ctx);
+}
+
+TlsServerContext::TlsServerContext(TlsServerContext&&) noexcept = default;
+
+TlsServerContext& TlsServerContext::operator=(TlsServerContext&&) noexcept =
+    default;
+
+TlsServerContext::~TlsServerContext() = default;
+
 class TlsWrapper::Impl {
  public:
   explicit Impl(Socket&& socket) : bio_data(std::move(socket)) {}
@@ -239,22 +317,31 @@ class TlsWrapper::Impl {
   Impl(Impl&& other) noexcept
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
-        is_in_shutdown(other.is_in_shutdown) {
+        is_in_shutdown(other.is_in_shutdown),
+        is_socket_bio(other.is_socket_bio),
+        is_kernel_tls_send(other.is_kernel_tls_send) {
     UASSERT(SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
-    SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
+    if (!is_socket_bio) SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
-    Bio socket_bio{BIO_new(GetSocketBioMethod())};
+  // OpenSSL does the IO on the socket fd itself if `use_socket_bio` is set,
+  // which is required for kernel TLS
+  void SetUp(SSL_CTX* ssl_ctx, bool use_socket_bio = false) {
+    Bio socket_bio{
+        use_socket_bio ? BIO_new_socket(bio_data.socket.Fd(), BIO_NOCLOSE)
+                       : BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: BIO_new"));
     }
-    BIO_set_shutdown(socket_bio.get(), 0);
-    SyncBioData(socket_bio.get(), nullptr);
-    BIO_set_init(socket_bio.get(), 1);
+    is_socket_bio = use_socket_bio;
+    if (!is_socket_bio) {
+      BIO_set_shutdown(socket_bio.get(), 0);
+      SyncBioData(socket_bio.get(), nullptr);
+      BIO_set_init(socket_bio.get(), 1);
+    }
 
-    ssl.reset(SSL_new(ssl_ctx.get()));
+    ssl.reset(SSL_new(ssl_ctx));
     if (!ssl) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
@@ -266,6 +353,57 @@ class TlsWrapper::Impl {
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
+  void Handshake(int (*handshake_func)(SSL*), Deadline deadline,
+                 const char* side) {
+    bio_data.current_deadline = deadline;
+    if (is_socket_bio) bio_data.last_exception = {};
+
+    while (true) {
+      const auto ret = handshake_func(ssl.get());
+      if (ret == 1) break;
+
+      const int ssl_error = SSL_get_error(ssl.get(), ret);
+      if (WaitSocket(ssl_error, 0)) continue;
+      if (bio_data.last_exception) {
+        std::rethrow_exception(bio_data.last_exception);
+      }
+      throw TlsException(crypto::FormatSslError(fmt::format(
+          "Failed to set up {} TLS wrapper ({})", side, ssl_error)));
+    }
+
+    if (is_socket_bio) {
+      is_kernel_tls_send = BIO_get_ktls_send(SSL_get_wbio(ssl.get()));
+      LOG_TRACE() << "Kernel TLS send is "
+                  << (is_kernel_tls_send ? "enabled" : "disabled");
+    }
+  }
+
+  // Waits for the socket if OpenSSL does the IO on it, returns whether the
+  // operation should be retried; sets the exception on timeout or cancellation
+  bool WaitSocket(int ssl_error, size_t bytes_transferred) {
+    if (!is_socket_bio) return false;
+    if (ssl_error != SSL_ERROR_WANT_READ && ssl_error != SSL_ERROR_WANT_WRITE) {
+      return false;
+    }
+
+    auto& socket = bio_data.socket;
+    const auto deadline = bio_data.current_deadline;
+    const bool is_ready = ssl_error == SSL_ERROR_WANT_READ
+                              ? socket.WaitReadable(deadline)
+                              : socket.WaitWriteable(deadline);
+    if (is_ready) return true;
+
+    try {
+      if (current_task::ShouldCancel()) {
+        throw IoCancelled(bytes_transferred) << "TLS socket wait";
+      }
+      throw IoTimeout(bytes_transferred) << "TLS socket wait";
+    } catch (const IoInterrupted&) {
+      bio_data.last_exception = std::current_exception();
+    }
+    return false;
+  }
+
   template <typename SslIoFunc>
   size_t PerformSslIo(SslIoFunc&& io_func, void* buf, size_t len,
                       impl::TransferMode mode, InterruptAction interrupt_action,
@@ -274,6 +412,7 @@ class TlsWrapper::Impl {
     if (!len) return 0;
 
     bio_data.current_deadline = deadline;
+    if (is_socket_bio) bio_data.last_exception = {};
 
     char* const begin = static_cast<char*>(buf);
     char* const end = begin + len;
@@ -294,6 +433,8 @@ class TlsWrapper::Impl {
           // timeout, cancel, EOF, or just a spurious wakeup
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (WaitSocket(ssl_error, pos - begin)) continue;
+            break;
           case SSL_ERROR_ZERO_RETURN:
             break;
 
@@ -336,6 +477,8 @@ class TlsWrapper::Impl {
   SocketBioData bio_data;
   Ssl ssl;
   bool is_in_shutdown{false};
+  bool is_socket_bio{false};
+  bool is_kernel_tls_send{false};
 
  private:
   void SyncBioData(BIO* bio,
@@ -367,7 +510,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(ssl_ctx.get());
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -378,18 +521,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
     }
   }
 
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_connect(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up client TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
-  }
+  wrapper.impl_->Handshake(&SSL_connect, deadline, "client");
   return wrapper;
 }
 
@@ -397,43 +529,20 @@ TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
     const std::vector<crypto::Certificate>& cert_authorities) {
-  auto ssl_ctx = MakeSslCtx();
-
-  if (!cert_authorities.empty()) {
-    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
-    for (const auto& ca : cert_authorities) {
-      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
-        throw TlsException(crypto::FormatSslError(
-            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
-      }
-    }
-  }
-
-  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
-  }
+  return StartTlsServer(
+      std::move(socket),
+      TlsServerContext{TlsServerSettings{cert, key, cert_authorities}},
+      deadline);
+}
 
-  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
-  }
+TlsWrapper TlsWrapper::StartTlsServer(Socket&& socket,
+                                      const TlsServerContext& context,
+                                      Deadline deadline) {
+  const auto& context_impl = *context.impl_;
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_accept(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up server TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
-  }
-
+  wrapper.impl_->SetUp(context_impl.ssl_ctx.get(), context_impl.is_kernel_tls);
+  wrapper.impl_->Handshake(&SSL_accept, deadline, "server");
   return wrapper;
 }
 
@@ -476,16 +585,47 @@ size_t TlsWrapper::RecvAll(void* buf, size_t len, Deadline deadline) {
 
 size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
   impl_->CheckAlive();
+  if (impl_->is_kernel_tls_send) {
+    // the kernel makes TLS records, no userspace encryption and copying
+    return impl_->bio_data.socket.SendAll(buf, len, deadline);
+  }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   return impl_->PerformSslIo(&SSL_write_ex, const_cast<void*>(buf), len,
                              impl::TransferMode::kWhole, InterruptAction::kFail,
                              deadline, "SendAll");
 }
 
+size_t TlsWrapper::WriteAll(std::initializer_list<IoData> list,
+                            Deadline deadline) {
+  impl_->CheckAlive();
+  if (impl_->is_kernel_tls_send) {
+    return impl_->bio_data.socket.SendAll(list, deadline);
+  }
+  return RwBase::WriteAll(list, deadline);
+}
+
+size_t TlsWrapper::SendFile(int in_fd, size_t offset, size_t len,
+                            Deadline deadline) {
+  impl_->CheckAlive();
+  if (!impl_->is_kernel_tls_send) {
+    throw TlsException("Cannot send a file without kernel encryption enabled");
+  }
+  return impl_->bio_data.socket.SendFile(in_fd, offset, len, deadline);
+}
+
+bool TlsWrapper::IsKernelTlsEnabled() const {
+  return impl_->ssl && impl_->is_kernel_tls_send;
+}
+
 Socket TlsWrapper::StopTls(Deadline deadline) {
   if (impl_->ssl) {
+    if (impl_->is_kernel_tls_send) {
+      // the kernel keeps encrypting the data sent to the socket
+      throw TlsException("Cannot stop TLS with kernel encryption enabled");
+    }
     impl_->is_in_shutdown = true;
     impl_->bio_data.current_deadline = deadline;
+    if (impl_->is_socket_bio) impl_->bio_data.last_exception = {};
     int shutdown_ret = 0;
     while (shutdown_ret != 1) {
       shutdown_ret = SSL_shutdown(impl_->ssl.get());
@@ -495,6 +635,7 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
           // this is fine
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (impl_->WaitSocket(ssl_error, 0)) continue;
             break;
 
           // connection breaking errors
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <openssl/opensslv.h>
+#include <openssl/ssl.h>
 #include <sys/socket.h>
 
 #include <stdexcept>
@@ -137,6 +138,54 @@ v2R63aFo/UfQSQ4dhC0o2Vy74DyLwnO3pH8wudfBJ8/LX/Uz/A==
 
 constexpr auto kShortTimeout = std::chrono::milliseconds{10};
 
+// OpenSSL client that keeps the session between connections, as the
+// TlsWrapper client does not resume sessions
+class ResumingTlsClient final {
+ public:
+  ResumingTlsClient() : ctx_(SSL_CTX_new(TLS_client_method())) {}
+
+  ~ResumingTlsClient() {
+    if (session_) SSL_SESSION_free(session_);
+    SSL_CTX_free(ctx_);
+  }
+
+  /// Reads a byte from the server and returns whether the session was resumed
+  bool Connect(io::Socket& socket, Deadline deadline) {
+    SSL* ssl = SSL_new(ctx_);
+    SSL_set_fd(ssl, socket.Fd());
+    SSL_set_connect_state(ssl);
+    if (session_) SSL_set_session(ssl, session_);
+
+    // TLS 1.3 session tickets are received after the handshake
+    char c = 0;
+    while (true) {
+      const auto ret = SSL_read(ssl, &c, 1);
+      if (ret == 1) break;
+      const auto error = SSL_get_error(ssl, ret);
+      const bool is_ready = error == SSL_ERROR_WANT_READ
+                                ? socket.WaitReadable(deadline)
+                                : error == SSL_ERROR_WANT_WRITE &&
+                                      socket.WaitWriteable(deadline);
+      if (!is_ready) {
+        ADD_FAILURE() << "SSL error " << error;
+        break;
+      }
+    }
+
+    const bool is_reused = SSL_session_reused(ssl);
+    if (session_) SSL_SESSION_free(session_);
+    session_ = SSL_get1_session(ssl);
+    // sessions of connections without shutdown are not resumable
+    SSL_shutdown(ssl);
+    SSL_free(ssl);
+    return is_reused;
+  }
+
+ private:
+  SSL_CTX* ctx_;
+  SSL_SESSION* session_{nullptr};
+};
+
 }  // namespace
 
 UTEST_MT(TlsWrapper, Smoke, 2) {
@@ -488,6 +537,93 @@ UTEST(TlsWrapper, InvalidSocket) {
                 io::TlsException);
 }
 
+UTEST_MT(TlsWrapper, SessionResumption, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  struct TestCase {
+    std::size_t session_cache_size;
+    bool session_tickets;
+    bool is_resumed;
+  };
+  for (const auto& test_case : {TestCase{0, true, true},
+                                TestCase{100, false, true},
+                                TestCase{0, false, false}}) {
+    io::TlsServerSettings settings;
+    settings.cert = crypto::Certificate::LoadFromString(cert);
+    settings.key = crypto::PrivateKey::LoadFromString(key);
+    settings.session_cache_size = test_case.session_cache_size;
+    settings.session_tickets = test_case.session_tickets;
+    const io::TlsServerContext context{settings};
+
+    TcpListener tcp_listener;
+    ResumingTlsClient client;
+    for (const bool is_resumed : {false, test_case.is_resumed}) {
+      auto [server, client_socket] = tcp_listener.MakeSocketPair(test_deadline);
+      auto server_task = engine::AsyncNoSpan(
+          [&context, test_deadline](auto&& server) {
+            auto tls_server = io::TlsWrapper::StartTlsServer(
+                std::forward<decltype(server)>(server), context,
+                test_deadline);
+            EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+            char c = 0;
+            EXPECT_EQ(0, tls_server.RecvSome(&c, 1, test_deadline));
+          },
+          std::move(server));
+
+      EXPECT_EQ(client.Connect(client_socket, test_deadline), is_resumed)
+          << "session_cache_size=" << test_case.session_cache_size
+          << " session_tickets=" << test_case.session_tickets;
+      server_task.Get();
+    }
+  }
+}
+
+UTEST_MT(TlsWrapper, KernelTls, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  io::TlsServerSettings settings;
+  settings.cert = crypto::Certificate::LoadFromString(cert);
+  settings.key = crypto::PrivateKey::LoadFromString(key);
+  settings.kernel_tls = true;
+  const io::TlsServerContext context{settings};
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+  auto server_task = engine::AsyncNoSpan(
+      [&context, test_deadline](auto&& server) {
+        // falls back to the userspace encryption if kTLS is not available
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server), context, test_deadline);
+        LOG_INFO() << "Kernel TLS is "
+                   << (tls_server.IsKernelTlsEnabled() ? "enabled"
+                                                       : "disabled");
+
+        char c = 0;
+        UEXPECT_THROW([[maybe_unused]] const auto ret = tls_server.RecvAll(
+                          &c, 1, Deadline::FromDuration(kShortTimeout)),
+                      io::IoTimeout);
+        EXPECT_EQ(4,
+                  tls_server.WriteAll({{"ab", 2}, {"cd", 2}}, test_deadline));
+        EXPECT_EQ(1, tls_server.RecvAll(&c, 1, test_deadline));
+        EXPECT_EQ('x', c);
+        EXPECT_EQ(0, tls_server.RecvSome(&c, 1, test_deadline));
+      },
+      std::move(server));
+
+  {
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    std::string buffer(4, '\0');
+    EXPECT_EQ(4, tls_client.RecvAll(buffer.data(), buffer.size(),
+                                    test_deadline));
+    EXPECT_EQ(buffer, "abcd");
+    EXPECT_EQ(1, tls_client.SendAll("x", 1, test_deadline));
+  }
+
+  server_task.Get();
+}
+
 UTEST(TlsWrapper, PeerShutdown) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -2,10 +2,13 @@
 
 #include <array>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task_group.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
 
@@ -99,4 +102,41 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+// Baseline for async_task_group: a task per item, joined one by one
+void async_batch_one_by_one(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const std::size_t batch_size = state.range(0);
+    std::vector<engine::TaskWithResult<std::size_t>> tasks;
+    std::vector<std::size_t> results;
+    for (auto _ : state) {
+      tasks.reserve(batch_size);
+      for (std::size_t i = 0; i < batch_size; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([i] { return i; }));
+      }
+      engine::WaitAllChecked(tasks);
+      results.reserve(batch_size);
+      for (auto& task : tasks) results.push_back(task.Get());
+      benchmark::DoNotOptimize(results.data());
+      tasks.clear();
+      results.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+  });
+}
+BENCHMARK(async_batch_one_by_one)->RangeMultiplier(8)->Range(8, 4096);
+
+void async_task_group(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const std::size_t batch_size = state.range(0);
+    engine::TaskGroup group{static_cast<std::size_t>(state.range(1))};
+    for (auto _ : state) {
+      auto results = group.Run(batch_size, [](std::size_t i) { return i; });
+      benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+  });
+}
+BENCHMARK(async_task_group)
+    ->ArgsProduct({benchmark::CreateRange(8, 4096, 8), {1, 4, 16}});
+
 USERVER_NAMESPACE_END
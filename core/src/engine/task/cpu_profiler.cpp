@@ -0,0 +1,375 @@
+#include <engine/task/cpu_profiler.hpp>
+
+#include <sys/time.h>
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <boost/stacktrace/frame.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::size_t kMaxFrames = 64;
+
+// HandleProfilingSignal and the signal trampoline of the kernel
+constexpr std::size_t kSkipFrames = 2;
+
+constexpr std::size_t kMaxInternedNames = 1024;
+
+// The frames below are the same for all the tasks
+constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+
+}  // namespace
+
+struct CpuProfiler::RawSample final {
+  std::atomic<bool> is_ready{false};
+  bool in_task{false};
+  std::size_t frames_count{0};
+  const std::string* root_span{nullptr};
+  const std::string* span{nullptr};
+  // +1 for the terminating null frame of safe_dump_to
+  const void* frames[kMaxFrames + 1]{};
+};
+
+namespace {
+
+// Constant-initialized, so the signal handler never sees it uninitialized
+struct ProfilerState final {
+  std::atomic<bool> is_running{false};
+  std::atomic<bool> is_active{false};
+  std::atomic<std::size_t> handlers_in_flight{0};
+  std::atomic<std::size_t> next_sample{0};
+  std::atomic<std::size_t> dropped_samples{0};
+  // Incremented on each start, the tags of the tasks are stamped with it
+  std::atomic<std::uint64_t> generation{0};
+  CpuProfiler::RawSample* samples{nullptr};
+  std::size_t samples_capacity{0};
+};
+
+ProfilerState profiler_state;
+
+void RecordSample(CpuProfiler::RawSample& sample) noexcept {
+  auto* context = current_task::GetCurrentTaskContextUnchecked();
+  sample.in_task = context != nullptr;
+  if (context) {
+    const auto& tags = context->GetCpuProfilerTags();
+    // The stale tags of a previous profiling are ignored, the task gets the
+    // fresh ones on its next step
+    if (tags.generation.load(std::memory_order_relaxed) ==
+        profiler_state.generation.load(std::memory_order_relaxed)) {
+      sample.root_span = tags.root_span.load(std::memory_order_relaxed);
+      sample.span = tags.span.load(std::memory_order_relaxed);
+    }
+  }
+
+  const auto dumped = boost::stacktrace::safe_dump_to(
+      kSkipFrames, sample.frames, sizeof(sample.frames));
+  sample.frames_count = dumped > 0 ? dumped - 1 : 0;
+  sample.is_ready.store(true, std::memory_order_release);
+}
+
+// Must stay async-signal-safe: no allocations, no locks
+void HandleProfilingSignal(int) noexcept {
+  const auto saved_errno = errno;
+  auto& state = profiler_state;
+
+  // Pairs with Deactivate(): either the handler sees the profiler inactive,
+  // or Deactivate() waits for the handler
+  state.handlers_in_flight.fetch_add(1);
+  if (state.is_active.load()) {
+    const auto index =
+        state.next_sample.fetch_add(1, std::memory_order_relaxed);
+    if (index < state.samples_capacity) {
+      RecordSample(state.samples[index]);
+    } else {
+      state.dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  state.handlers_in_flight.fetch_sub(1);
+
+  errno = saved_errno;
+}
+
+void SetProfilingTimer(std::chrono::microseconds period) {
+  struct itimerval timer {};
+  timer.it_interval.tv_sec = period.count() / 1'000'000;
+  timer.it_interval.tv_usec = period.count() % 1'000'000;
+  timer.it_value = timer.it_interval;
+  utils::CheckSyscall(::setitimer(ITIMER_PROF, &timer, nullptr),
+                      "setting the profiling timer");
+}
+
+void SetProfilingSignalHandler(void (*handler)(int),
+                               struct sigaction* old_action) {
+  struct sigaction action {};
+  std::memset(&action, 0, sizeof(action));
+  action.sa_handler = handler;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  utils::CheckSyscall(::sigaction(SIGPROF, &action, old_action),
+                      "setting the SIGPROF handler");
+}
+
+bool IsForeignHandler(const struct sigaction& action) {
+  if (action.sa_flags & SA_SIGINFO) return true;
+  // SIG_DFL and SIG_IGN might be macros
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  return action.sa_handler != SIG_DFL && action.sa_handler != SIG_IGN &&
+         action.sa_handler != &HandleProfilingSignal;
+}
+
+const std::string& GetTagName(const std::string* tag, bool in_task) {
+  static const std::string kNoTask = "<no task>";
+  static const std::string kNoSpan = "<no span>";
+  if (tag) return *tag;
+  return in_task ? kNoSpan : kNoTask;
+}
+
+class FrameNames final {
+ public:
+  // An empty name marks the start of the coroutine
+  const std::string& Get(const void* address) {
+    auto [it, inserted] = names_.try_emplace(address);
+    if (inserted) {
+      auto name = boost::stacktrace::frame{address}.name();
+      if (name.find(kStartOfCoroutine) != std::string::npos) {
+        name.clear();
+      } else if (name.empty()) {
+        name = fmt::format("{}", address);
+      }
+      // ';' separates the frames in the folded stacks
+      std::replace(name.begin(), name.end(), ';', ':');
+      it->second = std::move(name);
+    }
+    return it->second;
+  }
+
+ private:
+  std::unordered_map<const void*, std::string> names_;
+};
+
+}  // namespace
+
+bool IsCpuProfilerActive() noexcept {
+  return profiler_state.is_active.load(std::memory_order_relaxed);
+}
+
+bool AreCpuProfilerTagsStale(const CpuProfilerTags& tags) noexcept {
+  return IsCpuProfilerActive() &&
+         tags.generation.load(std::memory_order_relaxed) !=
+             profiler_state.generation.load(std::memory_order_relaxed);
+}
+
+const std::string* InternCpuProfilerName(const std::string& name) noexcept {
+  static rcu::RcuMap<std::string, std::string> names;
+  static const std::string kOtherName = "other";
+
+  try {
+    if (auto interned = names.Get(name)) return interned.get();
+    if (names.SizeApprox() >= kMaxInternedNames) return &kOtherName;
+    // The names are never erased, so the pointers stay valid
+    return names.TryEmplace(name, name).value.get();
+  } catch (const std::exception&) {
+    return nullptr;
+  }
+}
+
+void SetCurrentCpuProfilerTags(const std::string* root_span,
+                               const std::string* span) noexcept {
+  auto* context = current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  auto& tags = context->GetCpuProfilerTags();
+  // seq_cst orders the stores before the destruction of the previous span
+  // for the signal handler on this thread. The generation goes last, so that
+  // the handler never takes the new tags for the ones of the previous
+  // profiling.
+  tags.root_span.store(root_span);
+  tags.span.store(span);
+  tags.generation.store(profiler_state.generation.load());
+}
+
+CpuProfiler::CpuProfiler(std::chrono::microseconds sampling_period,
+                         std::size_t max_samples)
+    : sampling_period_(sampling_period) {
+  UINVARIANT(sampling_period.count() > 0, "Invalid sampling period");
+  UINVARIANT(max_samples > 0, "Invalid samples count");
+
+  auto& state = profiler_state;
+  if (state.is_running.exchange(true)) {
+    throw CpuProfilerBusyError("Another CPU profiler is already running");
+  }
+
+  utils::ScopeGuard release_guard{[&state] {
+    state.samples = nullptr;
+    state.samples_capacity = 0;
+    state.is_running = false;
+  }};
+
+  // Loads the unwinder in advance, the signal handler must not do that
+  const void* warmup_frames[2]{};
+  boost::stacktrace::safe_dump_to(warmup_frames, sizeof(warmup_frames));
+
+  samples_ = std::make_unique<RawSample[]>(max_samples);
+  state.samples = samples_.get();
+  state.samples_capacity = max_samples;
+  state.next_sample = 0;
+  state.dropped_samples = 0;
+  ++state.generation;
+
+  struct sigaction old_action {};
+  SetProfilingSignalHandler(&HandleProfilingSignal, &old_action);
+  if (IsForeignHandler(old_action)) {
+    ::sigaction(SIGPROF, &old_action, nullptr);
+    throw CpuProfilerBusyError("SIGPROF is used by another profiler");
+  }
+  release_guard.Release();
+
+  state.is_active = true;
+  try {
+    SetProfilingTimer(sampling_period_);
+  } catch (...) {
+    Deactivate();
+    throw;
+  }
+}
+
+CpuProfiler::~CpuProfiler() {
+  if (samples_) Deactivate();
+}
+
+CpuProfile CpuProfiler::Stop() {
+  UINVARIANT(samples_, "The CPU profiler is already stopped");
+  auto& state = profiler_state;
+  const auto recorded =
+      std::min(state.next_sample.load(), state.samples_capacity);
+  const auto dropped = state.dropped_samples.load();
+  Deactivate();
+
+  using Key = std::tuple<std::vector<const void*>, const std::string*,
+                         const std::string*, bool>;
+  std::map<Key, std::size_t> counts;
+  for (std::size_t i = 0; i < recorded; ++i) {
+    const auto& sample = samples_[i];
+    // A sample could be reserved by a handler that did not finish in time
+    if (!sample.is_ready.load(std::memory_order_acquire)) continue;
+    Key key{{sample.frames, sample.frames + sample.frames_count},
+            sample.root_span,
+            sample.span,
+            sample.in_task};
+    ++counts[std::move(key)];
+  }
+  samples_.reset();
+
+  CpuProfile profile;
+  profile.sampling_period = sampling_period_;
+  profile.dropped_samples = dropped;
+  profile.samples.reserve(counts.size());
+  for (const auto& [key, count] : counts) {
+    const auto& [frames, root_span, span, in_task] = key;
+    profile.samples.push_back({frames, root_span, span, in_task, count});
+  }
+  return profile;
+}
+
+void CpuProfiler::Deactivate() noexcept {
+  auto& state = profiler_state;
+  struct itimerval disarmed {};
+  ::setitimer(ITIMER_PROF, &disarmed, nullptr);
+
+  state.is_active = false;
+  while (state.handlers_in_flight.load() != 0) {
+    std::this_thread::yield();
+  }
+
+  // The default action of SIGPROF terminates the process, and a signal may
+  // still be pending
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  std::signal(SIGPROF, SIG_IGN);
+
+  state.samples = nullptr;
+  state.samples_capacity = 0;
+  state.is_running = false;
+}
+
+std::string ToFoldedStacks(const CpuProfile& profile) {
+  FrameNames frame_names;
+  std::string result;
+  for (const auto& sample : profile.samples) {
+    const auto& root_span = GetTagName(sample.root_span, sample.in_task);
+    const auto& span = GetTagName(sample.span, sample.in_task);
+    result += root_span;
+    if (span != root_span) {
+      result += ';';
+      result += span;
+    }
+
+    std::size_t frames_count = 0;
+    while (frames_count < sample.frames.size() &&
+           !frame_names.Get(sample.frames[frames_count]).empty()) {
+      ++frames_count;
+    }
+    for (std::size_t i = frames_count; i > 0; --i) {
+      result += ';';
+      result += frame_names.Get(sample.frames[i - 1]);
+    }
+
+    result += ' ';
+    result += std::to_string(sample.count);
+    result += '\n';
+  }
+  return result;
+}
+
+std::string ToLegacyPprof(const CpuProfile& profile,
+                          const std::string& memory_maps) {
+  std::string result;
+  const auto append_word = [&result](std::uintptr_t word) {
+    result.append(reinterpret_cast<const char*>(&word), sizeof(word));
+  };
+
+  // header: count, header words, version, sampling period, padding
+  append_word(0);
+  append_word(3);
+  append_word(0);
+  append_word(profile.sampling_period.count());
+  append_word(0);
+
+  for (const auto& sample : profile.samples) {
+    append_word(sample.count);
+    append_word(sample.frames.size());
+    for (const auto* frame : sample.frames) {
+      append_word(reinterpret_cast<std::uintptr_t>(frame));
+    }
+  }
+
+  // trailer
+  append_word(0);
+  append_word(1);
+  append_word(0);
+
+  result += memory_maps;
+  return result;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
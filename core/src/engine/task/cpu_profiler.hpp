@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Names of the outermost and of the innermost tracing::Span of a task, read
+// by the CPU profiler signal handler. Point to the strings from
+// InternCpuProfilerName, so they are always safe to read. The tags set during
+// another profiling are ignored.
+struct CpuProfilerTags final {
+  std::atomic<const std::string*> root_span{nullptr};
+  std::atomic<const std::string*> span{nullptr};
+  std::atomic<std::uint64_t> generation{0};
+};
+
+// Whether the tags of the tasks should be maintained
+bool IsCpuProfilerActive() noexcept;
+
+// Whether the profiler is active and the tags were set before it has started
+bool AreCpuProfilerTagsStale(const CpuProfilerTags& tags) noexcept;
+
+// Sets the tags of the current task from its spans, called on the first step
+// of the task after the profiler has started. Defined by tracing, as the
+// spans are not known to the engine.
+void UpdateCurrentCpuProfilerTags() noexcept;
+
+// The returned string is never destroyed. After too many different names
+// returns a shared "other" name, returns nullptr on allocation failure.
+const std::string* InternCpuProfilerName(const std::string& name) noexcept;
+
+// Does nothing outside of a task
+void SetCurrentCpuProfilerTags(const std::string* root_span,
+                               const std::string* span) noexcept;
+
+// Samples with the same stack and tags are merged
+struct CpuProfileSample final {
+  // The innermost frame goes first
+  std::vector<const void*> frames;
+  const std::string* root_span{nullptr};
+  const std::string* span{nullptr};
+  bool in_task{false};
+  std::size_t count{0};
+};
+
+struct CpuProfile final {
+  std::chrono::microseconds sampling_period{0};
+  std::vector<CpuProfileSample> samples;
+  std::size_t dropped_samples{0};
+};
+
+// Another profiler is running in the process
+class CpuProfilerBusyError final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+// Samples the stacks of the threads of the process that consume CPU time
+// with SIGPROF, tagging the samples with the spans of the current task.
+// Only a single profiler may run at a time.
+class CpuProfiler final {
+ public:
+  // @throws CpuProfilerBusyError
+  CpuProfiler(std::chrono::microseconds sampling_period,
+              std::size_t max_samples);
+
+  CpuProfiler(CpuProfiler&&) = delete;
+  CpuProfiler& operator=(CpuProfiler&&) = delete;
+  ~CpuProfiler();
+
+  CpuProfile Stop();
+
+  struct RawSample;
+
+ private:
+  void Deactivate() noexcept;
+
+  const std::chrono::microseconds sampling_period_;
+  std::unique_ptr<RawSample[]> samples_;
+};
+
+// The "folded stacks" format of FlameGraph, one line per stack with the frames
+// separated by ';' from the outermost to the innermost one, and the samples
+// count at the end. The tags become the two outermost frames.
+std::string ToFoldedStacks(const CpuProfile& profile);
+
+// The legacy binary CPU profile format of gperftools, understood by pprof.
+// Does not contain the tags.
+std::string ToLegacyPprof(const CpuProfile& profile,
+                          const std::string& memory_maps);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <engine/task/cpu_profiler.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::impl::CpuProfiler;
+
+constexpr std::chrono::microseconds kSamplingPeriod{1000};
+constexpr std::size_t kMaxSamples = 10000;
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+  volatile std::size_t counter = 0;
+  while (std::chrono::steady_clock::now() < deadline) counter = counter + 1;
+}
+
+std::size_t CountSamples(const engine::impl::CpuProfile& profile,
+                         const std::string& span_name) {
+  std::size_t result = 0;
+  for (const auto& sample : profile.samples) {
+    if (sample.span && *sample.span == span_name) result += sample.count;
+  }
+  return result;
+}
+
+}  // namespace
+
+UTEST(CpuProfiler, TagsSamplesWithSpans) {
+  CpuProfiler profiler{kSamplingPeriod, kMaxSamples};
+  {
+    tracing::Span root{"profiled_root"};
+    tracing::Span span{"profiled_span"};
+    BurnCpu(std::chrono::milliseconds{200});
+  }
+  const auto profile = profiler.Stop();
+
+  EXPECT_EQ(profile.sampling_period, kSamplingPeriod);
+  EXPECT_GT(CountSamples(profile, "profiled_span"), 0);
+  for (const auto& sample : profile.samples) {
+    if (sample.span && *sample.span == "profiled_span") {
+      ASSERT_TRUE(sample.root_span);
+      EXPECT_EQ(*sample.root_span, "profiled_root");
+      EXPECT_TRUE(sample.in_task);
+      EXPECT_FALSE(sample.frames.empty());
+    }
+  }
+}
+
+UTEST(CpuProfiler, TagsSpansCreatedBeforeStart) {
+  tracing::Span span{"early_span"};
+  CpuProfiler profiler{kSamplingPeriod, kMaxSamples};
+  // The tags are refreshed on the next step of the task
+  engine::Yield();
+  BurnCpu(std::chrono::milliseconds{200});
+  const auto profile = profiler.Stop();
+
+  EXPECT_GT(CountSamples(profile, "early_span"), 0);
+}
+
+UTEST(CpuProfiler, IgnoresTagsOfPreviousProfiling) {
+  {
+    CpuProfiler profiler{kSamplingPeriod, kMaxSamples};
+    tracing::Span span{"stale_span"};
+    profiler.Stop();
+    // The tags are not cleared by the destruction of the span, as the
+    // profiler is inactive
+  }
+
+  CpuProfiler profiler{kSamplingPeriod, kMaxSamples};
+  BurnCpu(std::chrono::milliseconds{100});
+  const auto profile = profiler.Stop();
+
+  EXPECT_EQ(CountSamples(profile, "stale_span"), 0);
+}
+
+UTEST(CpuProfiler, SingleProfiler) {
+  CpuProfiler profiler{kSamplingPeriod, kMaxSamples};
+  EXPECT_THROW(CpuProfiler(kSamplingPeriod, kMaxSamples),
+               engine::impl::CpuProfilerBusyError);
+  profiler.Stop();
+
+  // The next profiler may start after the previous one has stopped
+  EXPECT_NO_THROW(CpuProfiler(kSamplingPeriod, kMaxSamples).Stop());
+}
+
+UTEST(CpuProfiler, DropsSamplesOverLimit) {
+  CpuProfiler profiler{kSamplingPeriod, 1};
+  BurnCpu(std::chrono::milliseconds{100});
+  const auto profile = profiler.Stop();
+
+  ASSERT_EQ(profile.samples.size(), 1);
+  EXPECT_EQ(profile.samples[0].count, 1);
+  EXPECT_GT(profile.dropped_samples, 0);
+}
+
+TEST(CpuProfiler, FoldedStacks) {
+  const std::string root_span = "root";
+  const std::string span = "span";
+
+  engine::impl::CpuProfile profile;
+  profile.samples.push_back({{}, &root_span, &span, true, 3});
+  profile.samples.push_back({{}, &root_span, &root_span, true, 2});
+  profile.samples.push_back({{}, nullptr, nullptr, true, 1});
+  profile.samples.push_back({{}, nullptr, nullptr, false, 1});
+
+  EXPECT_EQ(engine::impl::ToFoldedStacks(profile),
+            "root;span 3\n"
+            "root 2\n"
+            "<no span> 1\n"
+            "<no task> 1\n");
+}
+
+TEST(CpuProfiler, LegacyPprof) {
+  static const int kFrame = 0;
+
+  engine::impl::CpuProfile profile;
+  profile.sampling_period = kSamplingPeriod;
+  profile.samples.push_back({{&kFrame, &kFrame}, nullptr, nullptr, true, 5});
+
+  const std::string maps = "maps\n";
+  const auto result = engine::impl::ToLegacyPprof(profile, maps);
+
+  // header, a sample with 2 frames, trailer
+  constexpr std::size_t kWords = 5 + 4 + 3;
+  ASSERT_EQ(result.size(), kWords * sizeof(std::uintptr_t) + maps.size());
+
+  std::uintptr_t words[kWords]{};
+  std::copy(result.data(), result.data() + sizeof(words),
+            reinterpret_cast<char*>(words));
+  EXPECT_EQ(words[1], 3);
+  EXPECT_EQ(words[3], kSamplingPeriod.count());
+  EXPECT_EQ(words[5], 5);
+  EXPECT_EQ(words[6], 2);
+  EXPECT_EQ(words[7], reinterpret_cast<std::uintptr_t>(&kFrame));
+  EXPECT_EQ(words[10], 1);
+  EXPECT_EQ(result.substr(sizeof(words)), maps);
+}
+
+USERVER_NAMESPACE_END
@@ -94,6 +94,7 @@ TaskCancellationReason TaskBase::CancellationReason() const {
 void TaskBase::BlockingWait() const {
   UASSERT(context_);
   UASSERT(!current_task::IsTaskProcessorThread());
+  UASSERT_MSG(!impl::IsFastTaskRunning(), "Fast tasks must not block");
 
   auto& context = *context_;
   if (context.IsFinished()) return;
@@ -5,6 +5,7 @@
 
 #include <engine/impl/standalone.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/fast_task.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -22,6 +23,55 @@ void engine_task_create(benchmark::State& state) {
 }
 BENCHMARK(engine_task_create);
 
+void engine_fast_task_create(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    for (auto _ : state) engine::SubmitFastTask(task_processor, [] {});
+  });
+}
+BENCHMARK(engine_fast_task_create);
+
+namespace {
+
+// Runs `callbacks_count` callbacks that increment a counter and waits for all
+// of them
+template <typename Submit>
+void FanOut(std::size_t callbacks_count, Submit submit) {
+  std::atomic<std::size_t> left{callbacks_count};
+  for (std::size_t i = 0; i < callbacks_count; ++i) {
+    submit([&left] { --left; });
+  }
+  while (left != 0) engine::Yield();
+}
+
+}  // namespace
+
+void engine_task_fan_out(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const std::size_t callbacks_count = state.range(1);
+    for (auto _ : state) {
+      FanOut(callbacks_count,
+             [](auto&& f) { engine::AsyncNoSpan(std::move(f)).Detach(); });
+    }
+    state.SetItemsProcessed(state.iterations() * callbacks_count);
+  });
+}
+BENCHMARK(engine_task_fan_out)->ArgsProduct({{1, 4}, {16, 1024}});
+
+void engine_fast_task_fan_out(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    const std::size_t callbacks_count = state.range(1);
+    for (auto _ : state) {
+      FanOut(callbacks_count, [&task_processor](auto&& f) {
+        engine::SubmitFastTask(task_processor, std::move(f));
+      });
+    }
+    state.SetItemsProcessed(state.iterations() * callbacks_count);
+  });
+}
+BENCHMARK(engine_fast_task_fan_out)->ArgsProduct({{1, 4}, {16, 1024}});
+
 void engine_task_yield_single_thread(benchmark::State& state) {
   engine::RunStandalone([&] {
     std::vector<engine::TaskWithResult<void>> tasks;
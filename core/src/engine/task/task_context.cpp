@@ -32,24 +32,33 @@ namespace {
 
 thread_local impl::TaskContext* current_task_context_ptr = nullptr;
 
+thread_local bool is_fast_task_running = false;
+
 void SetCurrentTaskContext(impl::TaskContext* context) {
   UASSERT(!current_task_context_ptr || !context);
   current_task_context_ptr = context;
 }
 
+[[noreturn]] __attribute__((noinline)) void ReportNoCurrentTaskContext() {
+  utils::impl::AbortWithStacktrace(
+      is_fast_task_running
+          ? "current_task::GetCurrentTaskContext() has been called from a "
+            "fast task, fast tasks must not block or suspend"
+          : "current_task::GetCurrentTaskContext() has been called "
+            "outside of coroutine context");
+}
+
 }  // namespace
 
 USERVER_PREVENT_TLS_CACHING
 impl::TaskContext& GetCurrentTaskContext() noexcept {
   if (!current_task_context_ptr) {
-    // AbortWithStacktrace MUST be a separate function! Putting the body of this
-    // function into GetCurrentTaskContext() clobbers too many registers and
-    // compiler decides to use stack memory in GetCurrentTaskContext(). This
-    // leads to slowdown of GetCurrentTaskContext(). In particular Mutex::lock()
-    // slows down on ~25%.
-    utils::impl::AbortWithStacktrace(
-        "current_task::GetCurrentTaskContext() has been called "
-        "outside of coroutine context");
+    // ReportNoCurrentTaskContext MUST be a separate function! Putting the body
+    // of this function into GetCurrentTaskContext() clobbers too many
+    // registers and compiler decides to use stack memory in
+    // GetCurrentTaskContext(). This leads to slowdown of
+    // GetCurrentTaskContext(). In particular Mutex::lock() slows down on ~25%.
+    ReportNoCurrentTaskContext();
   }
   return *current_task_context_ptr;
 }
@@ -63,6 +72,19 @@ impl::TaskContext* GetCurrentTaskContextUnchecked() noexcept {
 
 namespace impl {
 
+FastTaskScope::FastTaskScope() noexcept {
+  UASSERT(!current_task::current_task_context_ptr);
+  UASSERT(!current_task::is_fast_task_running);
+  current_task::is_fast_task_running = true;
+}
+
+FastTaskScope::~FastTaskScope() { current_task::is_fast_task_running = false; }
+
+USERVER_PREVENT_TLS_CACHING
+bool IsFastTaskRunning() noexcept {
+  return current_task::is_fast_task_running;
+}
+
 [[noreturn]] void ReportDeadlock() {
   UINVARIANT(false, "Coroutine attempted to wait for itself");
 }
@@ -173,7 +195,7 @@ class LockedWaitStrategy final : public WaitStrategy {
  public:
   LockedWaitStrategy(Deadline deadline, GenericWaitList& waiters,
                      TaskContext& current, const TaskContext& target)
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, TaskWaitKind::kFuture),
         waiters_(waiters),
         current_(current),
         target_(target) {}
@@ -219,12 +241,21 @@ void TaskContext::DoStep() {
   }
   sleep_state_.ClearFlags<std::memory_order_relaxed>(clear_flags);
 
+  const bool is_stats_enabled = task_processor_.GetTaskStats().IsEnabled();
+  const auto step_started = is_stats_enabled
+                                ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point{};
+
   // eh_globals is replaced in task scope, we must proxy the exception
   std::exception_ptr uncaught;
   {
     CurrentTaskScope current_task_scope(*this, eh_globals_);
     try {
       SetState(Task::State::kRunning);
+      // Spans of the task might have been attached before the profiler start
+      if (AreCpuProfilerTagsStale(cpu_profiler_tags_)) {
+        UpdateCurrentCpuProfilerTags();
+      }
       (*coro_)(this);
     } catch (...) {
       uncaught = std::current_exception();
@@ -232,6 +263,10 @@ void TaskContext::DoStep() {
   }
   if (uncaught) std::rethrow_exception(uncaught);
 
+  if (is_stats_enabled) {
+    AccountStats(step_started, std::chrono::steady_clock::now());
+  }
+
   switch (yield_reason_) {
     case YieldReason::kTaskCancelled:
     case YieldReason::kTaskComplete: {
@@ -322,6 +357,7 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy) {
   if (has_deadline) ArmDeadlineTimer(deadline, sleep_epoch);
 
   yield_reason_ = YieldReason::kTaskWaiting;
+  stats_wait_kind_ = wait_strategy.GetWaitKind();
   UASSERT(task_pipe_);
   TraceStateTransition(Task::State::kSuspended);
   ProfilerStopExecution();
@@ -670,6 +706,47 @@ void TaskContext::Schedule() {
   // NOTE: may be executed at this point
 }
 
+void TaskContext::SetStatsName(const std::string& name) {
+  UASSERT(IsCurrent());
+  auto& task_stats = task_processor_.GetTaskStats();
+  if (!task_stats.IsEnabled()) return;
+
+  stats_entry_ = &task_stats.GetEntry(name);
+  stats_entry_->AccountTask();
+}
+
+void TaskContext::AccountStats(
+    std::chrono::steady_clock::time_point step_started,
+    std::chrono::steady_clock::time_point step_finished) {
+  using std::chrono::steady_clock;
+  auto& entry = stats_entry_ ? *stats_entry_
+                             : task_processor_.GetTaskStats().GetUnnamedEntry();
+
+  // With the statistics enabled the time of each Schedule() is known, the
+  // checks are for the tasks that were queued before the statistics were
+  // enabled
+  const auto queued = task_queue_wait_timepoint_;
+  steady_clock::duration queue_wait_time{0};
+  steady_clock::duration wait_time{0};
+  if (queued != steady_clock::time_point{} && queued <= step_started) {
+    queue_wait_time = step_started - queued;
+    if (stats_sleep_started_ != steady_clock::time_point{} &&
+        stats_sleep_started_ <= queued) {
+      wait_time = queued - stats_sleep_started_;
+    }
+  }
+
+  entry.AccountStep(step_finished - step_started, queue_wait_time,
+                    stats_sleep_wait_kind_, wait_time);
+
+  // The task goes to sleep right after the step, the kind of the sleep is set
+  // by Sleep() during the step
+  stats_sleep_started_ = yield_reason_ == YieldReason::kTaskWaiting
+                             ? step_finished
+                             : steady_clock::time_point{};
+  stats_sleep_wait_kind_ = stats_wait_kind_;
+}
+
 void TaskContext::ProfilerStartExecution() {
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
@@ -12,10 +12,12 @@
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_control.hpp>
 #include <engine/task/context_timer.hpp>
+#include <engine/task/cpu_profiler.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_counter.hpp>
+#include <engine/task/task_stats.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -52,13 +54,18 @@ class WaitStrategy {
 
   Deadline GetDeadline() const { return deadline_; }
 
+  TaskWaitKind GetWaitKind() const { return wait_kind_; }
+
  protected:
   ~WaitStrategy() = default;
 
-  constexpr WaitStrategy(Deadline deadline) noexcept : deadline_(deadline) {}
+  constexpr WaitStrategy(Deadline deadline,
+                         TaskWaitKind wait_kind = TaskWaitKind::kOther) noexcept
+      : deadline_(deadline), wait_kind_(wait_kind) {}
 
  private:
   const Deadline deadline_;
+  const TaskWaitKind wait_kind_;
 };
 
 class TaskContext final : public ContextAccessor {
@@ -172,6 +179,11 @@ class TaskContext final : public ContextAccessor {
 
   void SetCancelDeadline(Deadline deadline);
 
+  // Sets the name for the statistics of the task, see TaskStatsStorage
+  void SetStatsName(const std::string& name);
+
+  CpuProfilerTags& GetCpuProfilerTags() noexcept { return cpu_profiler_tags_; }
+
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
@@ -211,12 +223,18 @@ class TaskContext final : public ContextAccessor {
 
   void TraceStateTransition(Task::State state);
 
+  void AccountStats(std::chrono::steady_clock::time_point step_started,
+                    std::chrono::steady_clock::time_point step_finished);
+
   const uint64_t magic_{kMagic};
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
+  // The kind of the current Sleep and of the one the task woke up from
+  TaskWaitKind stats_wait_kind_{TaskWaitKind::kOther};
+  TaskWaitKind stats_sleep_wait_kind_{TaskWaitKind::kOther};
   EhGlobals eh_globals_;
 
   utils::impl::WrappedCallBase* payload_;
@@ -234,6 +252,13 @@ class TaskContext final : public ContextAccessor {
   std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
   std::chrono::steady_clock::time_point execute_started_;
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
+  std::chrono::steady_clock::time_point stats_sleep_started_;
+
+  // nullptr until the task gets a name
+  TaskStatsEntry* stats_entry_{nullptr};
+
+  // Maintained only while the CPU profiler is active
+  CpuProfilerTags cpu_profiler_tags_;
 
   size_t trace_csw_left_;
 
@@ -268,6 +293,18 @@ void intrusive_ptr_release(TaskContext* p) noexcept;
 
 bool HasWaitSucceeded(TaskContext::WakeupSource) noexcept;
 
+// Marks the current thread as running a fast task, see engine::SubmitFastTask
+class FastTaskScope final {
+ public:
+  FastTaskScope() noexcept;
+
+  FastTaskScope(const FastTaskScope&) = delete;
+  FastTaskScope& operator=(const FastTaskScope&) = delete;
+  ~FastTaskScope();
+};
+
+bool IsFastTaskRunning() noexcept;
+
 }  // namespace impl
 
 namespace current_task {
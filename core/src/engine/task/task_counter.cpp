@@ -159,6 +159,14 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountFastTaskCreated() noexcept {
+  Increment(GlobalCounterId::kCreated);
+}
+
+void TaskCounter::AccountFastTaskDestroyed() noexcept {
+  Increment(GlobalCounterId::kDestroyed);
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -71,6 +71,12 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  // Fast tasks are accounted as created and destroyed tasks, so that the task
+  // processor waits for them on shutdown
+  void AccountFastTaskCreated() noexcept;
+
+  void AccountFastTaskDestroyed() noexcept;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include <concurrent/impl/latch.hpp>
+#include <userver/engine/fast_task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/static_registration.hpp>
@@ -69,6 +70,7 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_counter_(config.worker_threads),
       task_queue_(config),
+      task_stats_(config.task_stats_enabled),
       config_(std::move(config)),
       pools_(std::move(pools)) {
   utils::impl::FinishStaticRegistration();
@@ -134,11 +136,23 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
   if (is_shutting_down_)
     context->RequestCancel(TaskCancellationReason::kShutdown);
 
-  SetTaskQueueWaitTimepoint(context);
+  if (task_stats_.IsEnabled()) {
+    // task statistics need the queue wait time of each task
+    context->SetQueueWaitTimepoint(std::chrono::steady_clock::now());
+  } else {
+    SetTaskQueueWaitTimepoint(context);
+  }
 
   task_queue_.Push(context);
 }
 
+void TaskProcessor::ScheduleFast(
+    std::unique_ptr<impl::FastTaskBase>&& fast_task) {
+  UASSERT(fast_task);
+  GetTaskCounter().AccountFastTaskCreated();
+  task_queue_.PushFast(std::move(fast_task));
+}
+
 void TaskProcessor::Adopt(impl::TaskContext& context) {
   detached_contexts_->Add(context);
 }
@@ -249,7 +263,13 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
 
 void TaskProcessor::ProcessTasks() noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto item = task_queue_.PopBlocking();
+    if (item.fast_task) {
+      RunFastTask(std::move(item.fast_task));
+      continue;
+    }
+
+    auto& context = item.context;
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
@@ -269,6 +289,62 @@ void TaskProcessor::ProcessTasks() noexcept {
   }
 }
 
+void TaskProcessor::RunFastTask(
+    std::unique_ptr<impl::FastTaskBase> fast_task) noexcept {
+  if (!ShouldDropFastTask(*fast_task)) {
+    const auto threshold = GetProfilerThreshold();
+    const auto started = threshold.count() > 0
+                             ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
+    try {
+      const impl::FastTaskScope fast_task_scope;
+      fast_task->Run();
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "uncaught exception from a fast task: " << ex;
+    }
+
+    if (started != std::chrono::steady_clock::time_point{}) {
+      const auto duration =
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - started);
+      if (duration >= threshold) {
+        LOG_LIMITED_ERROR() << "Profiler threshold reached, fast task was "
+                               "executing for too long ("
+                            << duration.count() << "us >= " << threshold.count()
+                            << "us)";
+      }
+    }
+  }
+
+  fast_task.reset();
+  GetTaskCounter().AccountFastTaskDestroyed();
+}
+
+bool TaskProcessor::ShouldDropFastTask(const impl::FastTaskBase& fast_task) {
+  if (fast_task.IsCritical()) return false;
+
+  if (is_shutting_down_) {
+    GetTaskCounter().AccountTaskCancel();
+    return true;
+  }
+
+  if (fast_task.GetDeadline().IsReached()) {
+    GetTaskCounter().AccountTaskCancel();
+    return true;
+  }
+
+  if (overload_action_ == TaskProcessorSettings::OverloadAction::kCancel &&
+      (task_queue_wait_time_overloaded_->load() ||
+       (max_task_queue_wait_length_ &&
+        GetTaskQueueSize() >= max_task_queue_wait_length_))) {
+    GetTaskCounter().AccountTaskOverload();
+    GetTaskCounter().AccountTaskCancelOverload();
+    return true;
+  }
+
+  return false;
+}
+
 void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   const auto max_wait_time = max_task_queue_wait_time_.load();
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
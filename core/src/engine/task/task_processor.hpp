@@ -13,6 +13,7 @@
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/task_stats.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -24,6 +25,7 @@ namespace engine {
 
 namespace impl {
 class TaskContext;
+class FastTaskBase;
 class TaskProcessorPools;
 class CountedCoroutinePtr;
 }  // namespace impl
@@ -41,6 +43,8 @@ class TaskProcessor final {
 
   void Schedule(impl::TaskContext*);
 
+  void ScheduleFast(std::unique_ptr<impl::FastTaskBase>&& fast_task);
+
   void Adopt(impl::TaskContext& context);
 
   impl::CountedCoroutinePtr GetCoroutine();
@@ -57,6 +61,12 @@ class TaskProcessor final {
 
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
+  impl::TaskStatsStorage& GetTaskStats() noexcept { return task_stats_; }
+
+  const impl::TaskStatsStorage& GetTaskStats() const noexcept {
+    return task_stats_;
+  }
+
   size_t GetTaskQueueSize() const { return task_queue_.GetSizeApproximate(); }
 
   size_t GetWorkerCount() const { return workers_.size(); }
@@ -84,6 +94,10 @@ class TaskProcessor final {
 
   void ProcessTasks() noexcept;
 
+  void RunFastTask(std::unique_ptr<impl::FastTaskBase> fast_task) noexcept;
+
+  bool ShouldDropFastTask(const impl::FastTaskBase& fast_task);
+
   void CheckWaitTime(impl::TaskContext& context);
 
   void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
@@ -96,6 +110,7 @@ class TaskProcessor final {
   concurrent::impl::InterferenceShield<std::atomic<bool>>
       task_queue_wait_time_overloaded_{false};
   TaskQueue task_queue_;
+  impl::TaskStatsStorage task_stats_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
@@ -35,6 +35,8 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_stats_enabled =
+      value["task-stats"].As<bool>(config.task_stats_enabled);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -1,6 +1,7 @@
 #include <engine/task/task_queue.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <userver/engine/fast_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,26 +20,33 @@ void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   context.detach();
 }
 
-boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
+void TaskQueue::PushFast(std::unique_ptr<impl::FastTaskBase>&& fast_task) {
+  UASSERT(fast_task);
+  fast_queue_.enqueue(fast_task.get());
+  fast_task.release();
+  queue_semaphore_.signal();
+}
+
+TaskQueue::Item TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
+  // tokens for the task processor in thread-local variables.
   thread_local moodycamel::ConsumerToken token(queue_);
+  thread_local moodycamel::ConsumerToken fast_token(fast_queue_);
 
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
-                                                  /* add_ref= */ false};
+  auto item = DoPopBlocking(token, fast_token);
 
-  if (!context) {
+  if (!item.context && !item.fast_task) {
     // return "stop" token back
     DoPush(nullptr);
   }
 
-  return context;
+  return item;
 }
 
 void TaskQueue::StopProcessing() { DoPush(nullptr); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  return queue_.size_approx() + fast_queue_.size_approx();
 }
 
 void TaskQueue::DoPush(impl::TaskContext* context) {
@@ -48,18 +56,32 @@ void TaskQueue::DoPush(impl::TaskContext* context) {
   queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+TaskQueue::Item TaskQueue::DoPopBlocking(
+    moodycamel::ConsumerToken& token, moodycamel::ConsumerToken& fast_token) {
+  // Fast tasks and tasks are taken in turns, so that neither of them starves
+  thread_local bool prefer_fast_tasks = false;
+  prefer_fast_tasks = !prefer_fast_tasks;
+
   impl::TaskContext* context{};
+  impl::FastTaskBase* fast_task{};
 
-  // This piece of code is copy-pasted from
-  // moodycamel::BlockingConcurrentQueue::wait_dequeue
+  // This piece of code is based on
+  // moodycamel::BlockingConcurrentQueue::wait_dequeue. The semaphore counts
+  // the items of both queues.
   queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+  while (true) {
+    if (prefer_fast_tasks && fast_queue_.try_dequeue(fast_token, fast_task)) {
+      return {nullptr, std::unique_ptr<impl::FastTaskBase>{fast_task}};
+    }
+    if (queue_.try_dequeue(token, context)) {
+      return {{context, /* add_ref= */ false}, nullptr};
+    }
+    if (!prefer_fast_tasks && fast_queue_.try_dequeue(fast_token, fast_task)) {
+      return {nullptr, std::unique_ptr<impl::FastTaskBase>{fast_task}};
+    }
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
-
-  return context;
 }
 
 }  // namespace engine
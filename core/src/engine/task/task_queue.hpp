@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -12,16 +14,24 @@ namespace engine {
 
 namespace impl {
 class TaskContext;
+class FastTaskBase;
 }  // namespace impl
 
 class TaskQueue final {
  public:
+  // Holds either a task or a fast task, holds none of them as a stop signal
+  struct Item final {
+    boost::intrusive_ptr<impl::TaskContext> context;
+    std::unique_ptr<impl::FastTaskBase> fast_task;
+  };
+
   explicit TaskQueue(const TaskProcessorConfig& config);
 
   void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
-  // Returns nullptr as a stop signal
-  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+  void PushFast(std::unique_ptr<impl::FastTaskBase>&& fast_task);
+
+  Item PopBlocking();
 
   void StopProcessing();
 
@@ -30,9 +40,11 @@ class TaskQueue final {
  private:
   void DoPush(impl::TaskContext* context);
 
-  impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+  Item DoPopBlocking(moodycamel::ConsumerToken& token,
+                     moodycamel::ConsumerToken& fast_token);
 
   moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+  moodycamel::ConcurrentQueue<impl::FastTaskBase*> fast_queue_;
   moodycamel::LightweightSemaphore queue_semaphore_;
 };
 
@@ -0,0 +1,123 @@
+#include <engine/task/task_stats.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::string_view kUnnamedTaskName = "unnamed";
+constexpr std::string_view kOtherTaskName = "other";
+
+std::uint64_t ToNanoseconds(std::chrono::nanoseconds duration) noexcept {
+  return duration.count() > 0 ? duration.count() : 0;
+}
+
+std::chrono::nanoseconds Load(const std::atomic<std::uint64_t>& counter) {
+  return std::chrono::nanoseconds{counter.load(std::memory_order_relaxed)};
+}
+
+}  // namespace
+
+std::string_view ToString(TaskWaitKind kind) noexcept {
+  switch (kind) {
+    case TaskWaitKind::kMutex:
+      return "mutex";
+    case TaskWaitKind::kIo:
+      return "io";
+    case TaskWaitKind::kFuture:
+      return "future";
+    case TaskWaitKind::kSleep:
+      return "sleep";
+    case TaskWaitKind::kOther:
+      return "other";
+  }
+
+  UINVARIANT(false, "Unexpected TaskWaitKind");
+}
+
+TaskStatsSnapshot& TaskStatsSnapshot::operator-=(
+    const TaskStatsSnapshot& other) noexcept {
+  UASSERT(name == other.name);
+  tasks -= other.tasks;
+  context_switches -= other.context_switches;
+  execution_time -= other.execution_time;
+  queue_wait_time -= other.queue_wait_time;
+  for (std::size_t i = 0; i < kTaskWaitKindsCount; ++i) {
+    wait_time[i] -= other.wait_time[i];
+  }
+  return *this;
+}
+
+TaskStatsEntry::TaskStatsEntry(std::string name) : name_(std::move(name)) {}
+
+void TaskStatsEntry::AccountTask() noexcept {
+  tasks_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TaskStatsEntry::AccountStep(std::chrono::nanoseconds execution_time,
+                                 std::chrono::nanoseconds queue_wait_time,
+                                 TaskWaitKind wait_kind,
+                                 std::chrono::nanoseconds wait_time) noexcept {
+  context_switches_.fetch_add(1, std::memory_order_relaxed);
+  execution_ns_.fetch_add(ToNanoseconds(execution_time),
+                          std::memory_order_relaxed);
+  if (queue_wait_time.count() > 0) {
+    queue_wait_ns_.fetch_add(ToNanoseconds(queue_wait_time),
+                             std::memory_order_relaxed);
+  }
+  if (wait_time.count() > 0) {
+    wait_ns_[static_cast<std::size_t>(wait_kind)].fetch_add(
+        ToNanoseconds(wait_time), std::memory_order_relaxed);
+  }
+}
+
+TaskStatsSnapshot TaskStatsEntry::GetSnapshot() const {
+  TaskStatsSnapshot result;
+  result.name = name_;
+  result.tasks = tasks_.load(std::memory_order_relaxed);
+  result.context_switches = context_switches_.load(std::memory_order_relaxed);
+  result.execution_time = Load(execution_ns_);
+  result.queue_wait_time = Load(queue_wait_ns_);
+  for (std::size_t i = 0; i < kTaskWaitKindsCount; ++i) {
+    result.wait_time[i] = Load(wait_ns_[i]);
+  }
+  return result;
+}
+
+TaskStatsStorage::TaskStatsStorage(bool is_enabled)
+    : is_enabled_(is_enabled),
+      unnamed_(std::string{kUnnamedTaskName}),
+      other_(std::string{kOtherTaskName}) {}
+
+TaskStatsEntry& TaskStatsStorage::GetEntry(const std::string& name) {
+  if (auto entry = entries_.Get(name)) return *entry;
+
+  if (entries_.SizeApprox() >= kMaxNames) return other_;
+  // Entries are never erased, so the references to them stay valid
+  return *entries_.TryEmplace(name, name).value;
+}
+
+std::vector<TaskStatsSnapshot> TaskStatsStorage::GetSnapshots() const {
+  std::vector<TaskStatsSnapshot> result;
+  result.reserve(entries_.SizeApprox() + 2);
+  for (const auto& [name, entry] : entries_) {
+    result.push_back(entry->GetSnapshot());
+  }
+  result.push_back(unnamed_.GetSnapshot());
+  result.push_back(other_.GetSnapshot());
+  return result;
+}
+
+void SetCurrentTaskStatsName(const std::string& name) {
+  auto* context = current_task::GetCurrentTaskContextUnchecked();
+  if (context) context->SetStatsName(name);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// What a suspended task is waiting for
+enum class TaskWaitKind : std::uint8_t {
+  kMutex,
+  kIo,
+  kFuture,
+  kSleep,
+  kOther,
+};
+
+inline constexpr std::size_t kTaskWaitKindsCount =
+    static_cast<std::size_t>(TaskWaitKind::kOther) + 1;
+
+std::string_view ToString(TaskWaitKind kind) noexcept;
+
+// Cumulative statistics of the tasks with the same name
+struct TaskStatsSnapshot final {
+  std::string name;
+  std::uint64_t tasks{0};
+  std::uint64_t context_switches{0};
+  std::chrono::nanoseconds execution_time{0};
+  std::chrono::nanoseconds queue_wait_time{0};
+  std::array<std::chrono::nanoseconds, kTaskWaitKindsCount> wait_time{};
+
+  TaskStatsSnapshot& operator-=(const TaskStatsSnapshot& other) noexcept;
+};
+
+class TaskStatsEntry final {
+ public:
+  explicit TaskStatsEntry(std::string name);
+
+  void AccountTask() noexcept;
+
+  // Accounts a single execution slice of a task between context switches, the
+  // time the task spent in the queue before the slice and the time it was
+  // waiting for `wait_kind` before being queued
+  void AccountStep(std::chrono::nanoseconds execution_time,
+                   std::chrono::nanoseconds queue_wait_time,
+                   TaskWaitKind wait_kind,
+                   std::chrono::nanoseconds wait_time) noexcept;
+
+  TaskStatsSnapshot GetSnapshot() const;
+
+ private:
+  using Counter = std::atomic<std::uint64_t>;
+
+  const std::string name_;
+  Counter tasks_{0};
+  Counter context_switches_{0};
+  Counter execution_ns_{0};
+  Counter queue_wait_ns_{0};
+  std::array<Counter, kTaskWaitKindsCount> wait_ns_{};
+};
+
+// Per task name statistics of a task processor. Names are taken from the
+// tracing::Span of utils::Async tasks and from the handler names of requests.
+class TaskStatsStorage final {
+ public:
+  explicit TaskStatsStorage(bool is_enabled);
+
+  bool IsEnabled() const noexcept { return is_enabled_; }
+
+  // The entry lives as long as the storage. After kMaxNames different names
+  // all the new names share a single entry.
+  TaskStatsEntry& GetEntry(const std::string& name);
+
+  // For the tasks without a name
+  TaskStatsEntry& GetUnnamedEntry() noexcept { return unnamed_; }
+
+  std::vector<TaskStatsSnapshot> GetSnapshots() const;
+
+  static constexpr std::size_t kMaxNames = 256;
+
+ private:
+  const bool is_enabled_;
+  rcu::RcuMap<std::string, TaskStatsEntry> entries_;
+  TaskStatsEntry unnamed_;
+  TaskStatsEntry other_;
+};
+
+// Sets the name for the statistics of the current task, does nothing outside
+// of a task or if the statistics are disabled for the task processor
+void SetCurrentTaskStatsName(const std::string& name);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+#include <engine/task/task_stats.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/components/single_threaded_task_processors.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::impl::TaskStatsSnapshot;
+using engine::impl::TaskWaitKind;
+
+TaskStatsSnapshot FindSnapshot(const engine::TaskProcessor& task_processor,
+                               const std::string& name) {
+  const auto snapshots = task_processor.GetTaskStats().GetSnapshots();
+  const auto it = std::find_if(
+      snapshots.begin(), snapshots.end(),
+      [&name](const auto& snapshot) { return snapshot.name == name; });
+  EXPECT_NE(it, snapshots.end()) << "No statistics for " << name;
+  return it == snapshots.end() ? TaskStatsSnapshot{} : *it;
+}
+
+std::chrono::nanoseconds GetWaitTime(const TaskStatsSnapshot& snapshot,
+                                     TaskWaitKind kind) {
+  return snapshot.wait_time[static_cast<std::size_t>(kind)];
+}
+
+engine::TaskProcessorConfig MakeConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "stats";
+  config.worker_threads = 1;
+  config.task_stats_enabled = true;
+  return config;
+}
+
+}  // namespace
+
+UTEST(TaskStats, DisabledByDefault) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  EXPECT_FALSE(task_processor.GetTaskStats().IsEnabled());
+
+  utils::Async("not-accounted", [] { engine::Yield(); }).Get();
+  // Only the "unnamed" and "other" entries
+  EXPECT_EQ(task_processor.GetTaskStats().GetSnapshots().size(), 2);
+}
+
+UTEST(TaskStats, Storage) {
+  engine::impl::TaskStatsStorage storage{true};
+
+  auto& entry = storage.GetEntry("first");
+  EXPECT_EQ(&entry, &storage.GetEntry("first"));
+
+  entry.AccountTask();
+  entry.AccountStep(std::chrono::microseconds{3}, std::chrono::microseconds{2},
+                    TaskWaitKind::kIo, std::chrono::microseconds{1});
+  const auto snapshot = entry.GetSnapshot();
+  EXPECT_EQ(snapshot.name, "first");
+  EXPECT_EQ(snapshot.tasks, 1);
+  EXPECT_EQ(snapshot.context_switches, 1);
+  EXPECT_EQ(snapshot.execution_time, std::chrono::microseconds{3});
+  EXPECT_EQ(snapshot.queue_wait_time, std::chrono::microseconds{2});
+  EXPECT_EQ(GetWaitTime(snapshot, TaskWaitKind::kIo),
+            std::chrono::microseconds{1});
+  EXPECT_EQ(GetWaitTime(snapshot, TaskWaitKind::kMutex),
+            std::chrono::nanoseconds{0});
+
+  auto diff = entry.GetSnapshot();
+  diff -= snapshot;
+  EXPECT_EQ(diff.tasks, 0);
+  EXPECT_EQ(diff.execution_time, std::chrono::nanoseconds{0});
+}
+
+UTEST(TaskStats, NamesLimit) {
+  engine::impl::TaskStatsStorage storage{true};
+  for (std::size_t i = 0; i < engine::impl::TaskStatsStorage::kMaxNames; ++i) {
+    storage.GetEntry(std::to_string(i));
+  }
+
+  auto& other = storage.GetEntry("one-too-many");
+  EXPECT_EQ(&other, &storage.GetEntry("and-another-one"));
+  EXPECT_EQ(other.GetSnapshot().name, "other");
+  EXPECT_EQ(storage.GetSnapshots().size(),
+            engine::impl::TaskStatsStorage::kMaxNames + 2);
+}
+
+UTEST(TaskStats, AccountsWaits) {
+  engine::SingleThreadedTaskProcessorsPool pool{MakeConfig()};
+  auto& task_processor = pool.At(0);
+
+  utils::Async(task_processor, "sleeper", [] {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }).Get();
+
+  engine::Mutex mutex;
+  std::unique_lock lock{mutex};
+  auto locker = utils::Async(task_processor, "locker",
+                             [&mutex] { const std::lock_guard guard{mutex}; });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  lock.unlock();
+  locker.Get();
+
+  const auto sleeper = FindSnapshot(task_processor, "sleeper");
+  EXPECT_EQ(sleeper.tasks, 1);
+  EXPECT_GE(sleeper.context_switches, 2);
+  EXPECT_GE(GetWaitTime(sleeper, TaskWaitKind::kSleep),
+            std::chrono::milliseconds{10});
+
+  const auto locker_stats = FindSnapshot(task_processor, "locker");
+  EXPECT_EQ(locker_stats.tasks, 1);
+  EXPECT_GT(GetWaitTime(locker_stats, TaskWaitKind::kMutex),
+            std::chrono::nanoseconds{0});
+}
+
+UTEST(TaskStats, AccountsEachWaitToItsKind) {
+  engine::SingleThreadedTaskProcessorsPool pool{MakeConfig()};
+  auto& task_processor = pool.At(0);
+
+  engine::Mutex mutex;
+  std::unique_lock lock{mutex};
+  // the mutex wait is followed by a sleep of another kind right away
+  auto task = utils::Async(task_processor, "mixed", [&mutex] {
+    { const std::lock_guard guard{mutex}; }
+    engine::SleepFor(std::chrono::milliseconds{10});
+  });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  lock.unlock();
+  task.Get();
+
+  const auto mixed = FindSnapshot(task_processor, "mixed");
+  EXPECT_GT(GetWaitTime(mixed, TaskWaitKind::kMutex),
+            std::chrono::nanoseconds{0});
+  EXPECT_GE(GetWaitTime(mixed, TaskWaitKind::kSleep),
+            std::chrono::milliseconds{10});
+}
+
+USERVER_NAMESPACE_END
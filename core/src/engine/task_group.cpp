@@ -0,0 +1,27 @@
+#include <userver/engine/task_group.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+TaskGroup::TaskGroup(std::size_t max_concurrency)
+    : TaskGroup(current_task::GetTaskProcessor(), max_concurrency) {}
+
+TaskGroup::TaskGroup(TaskProcessor& task_processor,
+                     std::size_t max_concurrency)
+    : task_processor_(task_processor), max_concurrency_(max_concurrency) {
+  UINVARIANT(max_concurrency_ > 0,
+             "TaskGroup max_concurrency must be positive");
+}
+
+std::size_t TaskGroup::GetWorkersCount(std::size_t count) const noexcept {
+  return std::min(count, max_concurrency_);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
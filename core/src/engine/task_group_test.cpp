@@ -0,0 +1,91 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task_group.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(TaskGroup, Results, 4) {
+  engine::TaskGroup group{3};
+  EXPECT_EQ(group.GetMaxConcurrency(), 3);
+
+  const auto results =
+      group.Run(100, [](std::size_t i) { return std::to_string(i); });
+  ASSERT_EQ(results.size(), 100);
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i], std::to_string(i));
+  }
+
+  EXPECT_TRUE(group.Run(0, [](std::size_t i) { return i; }).empty());
+}
+
+UTEST_MT(TaskGroup, Void, 4) {
+  std::atomic<std::size_t> sum{0};
+  engine::TaskGroup{engine::current_task::GetTaskProcessor(), 8}.Run(
+      1000, [&sum](std::size_t i) { sum += i; });
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+UTEST_MT(TaskGroup, MaxConcurrency, 4) {
+  constexpr std::size_t kMaxConcurrency = 2;
+  std::atomic<std::size_t> running{0};
+  std::atomic<std::size_t> max_running{0};
+
+  engine::TaskGroup{kMaxConcurrency}.Run(20, [&](std::size_t) {
+    const auto current = ++running;
+    auto max = max_running.load();
+    while (current > max && !max_running.compare_exchange_weak(max, current)) {
+    }
+    engine::SleepFor(1ms);
+    --running;
+  });
+
+  EXPECT_GT(max_running, 0);
+  EXPECT_LE(max_running, kMaxConcurrency);
+}
+
+UTEST_MT(TaskGroup, FirstFailureCancelsTheRest, 4) {
+  std::atomic<std::size_t> started{0};
+  std::atomic<bool> slow_cancelled{false};
+
+  UEXPECT_THROW_MSG(
+      engine::TaskGroup{2}.Run(
+          100,
+          [&](std::size_t i) {
+            ++started;
+            if (i == 0) {
+              engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+              slow_cancelled = engine::current_task::ShouldCancel();
+              return;
+            }
+            throw std::runtime_error{"failure"};
+          }),
+      std::runtime_error, "failure");
+
+  // The running item is cancelled, no new items are started
+  EXPECT_TRUE(slow_cancelled);
+  EXPECT_LE(started, 3);
+}
+
+UTEST(TaskGroup, CallerCancellation) {
+  engine::SingleConsumerEvent started;
+  auto task = engine::AsyncNoSpan([&started] {
+    engine::TaskGroup{1}.Run(1, [&started](std::size_t) {
+      started.Send();
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    });
+  });
+
+  ASSERT_TRUE(started.WaitForEvent());
+  task.RequestCancel();
+  UEXPECT_THROW(task.Get(), engine::WaitInterruptedException);
+}
+
+USERVER_NAMESPACE_END
@@ -25,6 +25,12 @@ std::string GetNormalizeDirectory(std::string_view dir) {
   return std::string{dir.data(), slice};
 }
 
+utils::Flags<fs::SettingsReadFile> MakeReadFlags(bool keep_opened) {
+  utils::Flags<fs::SettingsReadFile> flags{fs::SettingsReadFile::kSkipHidden};
+  if (keep_opened) flags |= fs::SettingsReadFile::kKeepOpened;
+  return flags;
+}
+
 }  // namespace
 
 namespace fs {
@@ -42,8 +48,11 @@ bool IsFilepathHidden(const std::string& path) {
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+                             engine::TaskProcessor& tp, bool keep_opened)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      read_flags_(MakeReadFlags(keep_opened)) {
   UpdateCache();
 
   if (update_period_ == std::chrono::milliseconds(0)) {
@@ -61,8 +70,7 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, read_flags_);
   data_.Assign(std::move(map));
 }
 
@@ -114,7 +122,11 @@ void FsCacheClient::HandleCreate(const std::string& path) {
 
   FileInfoWithData info{};
   info.extension = boost::filesystem::path(path).extension().string();
-  info.data = ReadFileContents(tp_, path);
+  if (read_flags_ & SettingsReadFile::kKeepOpened) {
+    info.file = OpenFile(tp_, path);
+  } else {
+    info.data = ReadFileContents(tp_, path);
+  }
   data_.InsertOrAssign(
       GetLexicallyRelative(path, dir_),
       std::make_shared<const FileInfoWithData>(std::move(info)));
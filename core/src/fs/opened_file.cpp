@@ -0,0 +1,57 @@
+#include <userver/fs/opened_file.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+OpenedFile::OpenedFile(const std::string& path)
+    : fd_(blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead)) {
+  struct ::stat info {};
+  utils::CheckSyscall(::fstat(fd_.GetNative(), &info), "calling fstat on ",
+                      path);
+  size_ = info.st_size;
+  etag_ = fmt::format("\"{:x}-{:x}\"", info.st_mtime, size_);
+
+  // mmap does not accept zero length
+  if (size_ != 0) {
+    mapping_ = utils::CheckSyscallNotEquals(
+        ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_.GetNative(), 0),
+        MAP_FAILED, "mapping file ", path, " to memory");
+  }
+}
+
+OpenedFile::~OpenedFile() {
+  if (mapping_ && ::munmap(mapping_, size_) == -1) {
+    UASSERT_MSG(false, "munmap failed");
+  }
+}
+
+int OpenedFile::GetNative() const { return fd_.GetNative(); }
+
+std::size_t OpenedFile::GetSize() const { return size_; }
+
+std::string_view OpenedFile::GetData() const {
+  return {static_cast<const char*>(mapping_), size_};
+}
+
+const std::string& OpenedFile::GetETag() const { return etag_; }
+
+std::shared_ptr<const OpenedFile> OpenFile(engine::TaskProcessor& async_tp,
+                                           const std::string& path) {
+  return engine::AsyncNoSpan(async_tp, [&path] {
+           return std::make_shared<const OpenedFile>(path);
+         }).Get();
+}
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
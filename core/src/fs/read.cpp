@@ -50,7 +50,11 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
       continue;
     FileInfoWithData info{};
     info.extension = it->path().extension().string();
-    info.data = ReadFileContents(async_tp, it->path().string());
+    if (flags & SettingsReadFile::kKeepOpened) {
+      info.file = OpenFile(async_tp, it->path().string());
+    } else {
+      info.data = ReadFileContents(async_tp, it->path().string());
+    }
     data[GetLexicallyRelative(it->path().string(), path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
   }
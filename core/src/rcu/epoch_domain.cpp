@@ -0,0 +1,196 @@
+#include <userver/rcu/impl/epoch_domain.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu::impl {
+
+namespace {
+
+constexpr std::size_t kStripeCount = 64;
+
+struct Stripe final {
+  // readers count by the epoch parity
+  std::array<EpochReaderCounter, 2> readers{};
+};
+
+struct Retired final {
+  const void* owner;
+  void* ptr;
+  EpochDeleter deleter;
+  // keeps the owner's destructor waiting for the async deletion
+  utils::impl::WaitTokenStorage::Token token;
+  bool is_async;
+};
+
+using RetiredBatch = std::vector<Retired>;
+
+void DeleteSync(RetiredBatch& batch) noexcept {
+  for (auto& retired : batch) retired.deleter(retired.ptr);
+  batch.clear();
+}
+
+void Delete(RetiredBatch batch) {
+  if (batch.empty()) return;
+
+  const auto async_begin = std::stable_partition(
+      batch.begin(), batch.end(),
+      [](const Retired& retired) { return !retired.is_async; });
+  RetiredBatch async_batch(std::make_move_iterator(async_begin),
+                           std::make_move_iterator(batch.end()));
+  batch.erase(async_begin, batch.end());
+  DeleteSync(batch);
+
+  if (async_batch.empty()) return;
+  if (!engine::current_task::IsTaskProcessorThread()) {
+    DeleteSync(async_batch);
+    return;
+  }
+  engine::CriticalAsyncNoSpan([async_batch = std::move(async_batch)]() mutable {
+    // Make sure the values are deleted before the tokens are destroyed
+    DeleteSync(async_batch);
+  }).Detach();
+}
+
+class EpochDomain final {
+ public:
+  EpochReaderCounter& LockRead() noexcept {
+    auto& stripe = *stripes_[GetThreadStripeIndex()];
+    while (true) {
+      const auto epoch = epoch_.load();
+      auto& counter = stripe.readers[epoch & 1];
+      counter.fetch_add(1);
+
+      // If the epoch has not changed since the increment, the reclaimer either
+      // sees the increment or has not advanced from this epoch yet. Otherwise
+      // the reader might be missed by the reclaimer, retry in the new epoch.
+      if (epoch_.load() == epoch) return counter;
+      counter.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  void Retire(Retired retired) {
+    const std::lock_guard lock(mutex_);
+    current_.push_back(std::move(retired));
+  }
+
+  void Reclaim() {
+    RetiredBatch freed;
+    {
+      std::unique_lock lock(mutex_, std::try_to_lock);
+      if (!lock.owns_lock()) return;
+
+      // Two epoch changes in a row free the recently retired values at once
+      // if there are no readers at all
+      freed = TryAdvance(lock);
+      if (!pending_.empty()) {
+        auto more_freed = TryAdvance(lock);
+        std::move(more_freed.begin(), more_freed.end(),
+                  std::back_inserter(freed));
+      }
+    }
+    Delete(std::move(freed));
+  }
+
+  void ReclaimOwner(const void* owner) noexcept {
+    RetiredBatch owned;
+    {
+      std::lock_guard lock(mutex_);
+      ExtractOwned(current_, owner, owned);
+      ExtractOwned(pending_, owner, owned);
+    }
+    DeleteSync(owned);
+  }
+
+  std::size_t GetRetiredCountApprox() noexcept {
+    std::lock_guard lock(mutex_);
+    return current_.size() + pending_.size();
+  }
+
+ private:
+  static std::size_t GetThreadStripeIndex() noexcept {
+    static std::atomic<std::size_t> next_index{0};
+    thread_local const std::size_t index =
+        next_index.fetch_add(1, std::memory_order_relaxed) % kStripeCount;
+    return index;
+  }
+
+  template <typename Lock>
+  RetiredBatch TryAdvance(Lock&) {
+    const auto epoch = epoch_.load();
+
+    // pending_ were retired before the switch to `epoch`, so they could only
+    // be reached by readers that are locked in the previous epoch
+    const auto previous_parity = (epoch + 1) & 1;
+    for (const auto& stripe : stripes_) {
+      if (stripe->readers[previous_parity].load() != 0) return {};
+    }
+
+    auto freed = std::move(pending_);
+    pending_ = std::move(current_);
+    current_.clear();
+    epoch_.store(epoch + 1);
+    return freed;
+  }
+
+  static void ExtractOwned(RetiredBatch& from, const void* owner,
+                           RetiredBatch& to) {
+    const auto owned_begin =
+        std::stable_partition(from.begin(), from.end(),
+                              [owner](const Retired& retired) {
+                                return retired.owner != owner;
+                              });
+    std::move(owned_begin, from.end(), std::back_inserter(to));
+    from.erase(owned_begin, from.end());
+  }
+
+  std::atomic<std::uint64_t> epoch_{0};
+  std::array<concurrent::impl::InterferenceShield<Stripe>, kStripeCount>
+      stripes_;
+
+  std::mutex mutex_;      // for current_ and pending_ access and epoch_ changes
+  RetiredBatch current_;  // retired during the current epoch
+  RetiredBatch pending_;  // retired before the last epoch change
+};
+
+EpochDomain& GetEpochDomain() noexcept {
+  // Leaked to be usable by the static variables destructors
+  static auto* const domain = new EpochDomain();
+  return *domain;
+}
+
+}  // namespace
+
+EpochReaderCounter& LockEpochRead() noexcept {
+  return GetEpochDomain().LockRead();
+}
+
+void RetireToEpochDomain(const void* owner, void* ptr, EpochDeleter deleter,
+                         utils::impl::WaitTokenStorage* async_tokens) {
+  Retired retired{owner, ptr, deleter, {}, async_tokens != nullptr};
+  if (async_tokens) retired.token = async_tokens->GetToken();
+  GetEpochDomain().Retire(std::move(retired));
+}
+
+void ReclaimEpochDomain() { GetEpochDomain().Reclaim(); }
+
+void ReclaimEpochDomainOwner(const void* owner) noexcept {
+  GetEpochDomain().ReclaimOwner(owner);
+}
+
+std::size_t GetEpochDomainRetiredCountApprox() noexcept {
+  return GetEpochDomain().GetRetiredCountApprox();
+}
+
+}  // namespace rcu::impl
+
+USERVER_NAMESPACE_END
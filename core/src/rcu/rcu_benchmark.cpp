@@ -5,18 +5,27 @@
 #include <queue>
 #include <vector>
 
+#include <userver/concurrent/sharded_map.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+namespace {
+
+using HazardPointerTraits = rcu::DefaultRcuTraits<std::uint64_t>;
+using SharedEpochTraits = rcu::SharedEpochRcuTraits<std::uint64_t>;
+
+}  // namespace
+
+template <typename Traits, int VariableCount>
 void rcu_read(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    rcu::Variable<std::uint64_t, Traits> vars[VariableCount];
     {
       std::uint64_t i = 0;
       for (auto& var : vars) {
@@ -33,14 +42,19 @@ void rcu_read(benchmark::State& state) {
     }
   });
 }
-BENCHMARK_TEMPLATE(rcu_read, 1);
-BENCHMARK_TEMPLATE(rcu_read, 2);
-BENCHMARK_TEMPLATE(rcu_read, 4);
-
-template <int VariableCount>
+BENCHMARK_TEMPLATE(rcu_read, HazardPointerTraits, 1);
+BENCHMARK_TEMPLATE(rcu_read, HazardPointerTraits, 2);
+BENCHMARK_TEMPLATE(rcu_read, HazardPointerTraits, 4);
+BENCHMARK_TEMPLATE(rcu_read, HazardPointerTraits, 64);
+BENCHMARK_TEMPLATE(rcu_read, SharedEpochTraits, 1);
+BENCHMARK_TEMPLATE(rcu_read, SharedEpochTraits, 2);
+BENCHMARK_TEMPLATE(rcu_read, SharedEpochTraits, 4);
+BENCHMARK_TEMPLATE(rcu_read, SharedEpochTraits, 64);
+
+template <typename Traits, int VariableCount>
 void rcu_write(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    rcu::Variable<std::uint64_t, Traits> vars[VariableCount];
 
     std::uint64_t i = 0;
     for (auto _ : state) {
@@ -49,10 +63,14 @@ void rcu_write(benchmark::State& state) {
     }
   });
 }
-BENCHMARK_TEMPLATE(rcu_write, 1);
-BENCHMARK_TEMPLATE(rcu_write, 2);
-BENCHMARK_TEMPLATE(rcu_write, 4);
-
+BENCHMARK_TEMPLATE(rcu_write, HazardPointerTraits, 1);
+BENCHMARK_TEMPLATE(rcu_write, HazardPointerTraits, 2);
+BENCHMARK_TEMPLATE(rcu_write, HazardPointerTraits, 4);
+BENCHMARK_TEMPLATE(rcu_write, SharedEpochTraits, 1);
+BENCHMARK_TEMPLATE(rcu_write, SharedEpochTraits, 2);
+BENCHMARK_TEMPLATE(rcu_write, SharedEpochTraits, 4);
+
+template <typename Traits>
 void rcu_contention(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
   const std::size_t writers_count = state.range(1);
@@ -63,14 +81,14 @@ void rcu_contention(benchmark::State& state) {
 
   engine::RunStandalone(thread_count, [&] {
     std::atomic<bool> run{true};
-    rcu::Variable<std::uint64_t> var{0};
+    rcu::Variable<std::uint64_t, Traits> var{0};
 
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(readers_count - 1 + writers_count);
 
     for (std::size_t j = 0; j < readers_count - 1; j++) {
       tasks.push_back(utils::Async("reader", [&] {
-        std::vector<rcu::ReadablePtr<std::uint64_t>> pointers;
+        std::vector<rcu::ReadablePtr<std::uint64_t, Traits>> pointers;
         pointers.reserve(kept_readable_pointers_count);
 
         while (run) {
@@ -94,7 +112,7 @@ void rcu_contention(benchmark::State& state) {
     }
 
     {
-      std::queue<rcu::ReadablePtr<std::uint64_t>> pointers;
+      std::queue<rcu::ReadablePtr<std::uint64_t, Traits>> pointers;
       for (std::size_t i = 0; i < kept_readable_pointers_count; i++) {
         pointers.push(var.Read());
       }
@@ -112,7 +130,11 @@ void rcu_contention(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(rcu_contention)
+BENCHMARK_TEMPLATE(rcu_contention, HazardPointerTraits)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 16}, {0, 1}, {1, 4}})
+    ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
+BENCHMARK_TEMPLATE(rcu_contention, SharedEpochTraits)
     ->RangeMultiplier(2)
     ->Ranges({{1, 16}, {0, 1}, {1, 4}})
     ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
@@ -150,4 +172,65 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+// Every thread does `WritePercent`% of inserts and erases, the rest are
+// lookups. The map holds about kMapKeys keys.
+template <typename Map, int WritePercent>
+void map_mixed_read_write(benchmark::State& state) {
+  static constexpr std::uint64_t kMapKeys = 10000;
+  const std::size_t thread_count = state.range(0);
+
+  engine::RunStandalone(thread_count, [&] {
+    std::atomic<bool> run{true};
+    Map map;
+    for (std::uint64_t key = 0; key < kMapKeys; key += 2) {
+      map.Emplace(key, key);
+    }
+
+    const auto do_operation = [&map](std::uint64_t i) {
+      // Multiplicative hashing to spread the consecutive keys
+      const auto key = (i * 2654435761) % kMapKeys;
+      if (i % 100 < WritePercent) {
+        if (i % 2) {
+          map.Erase(key);
+        } else {
+          map.Emplace(key, key);
+        }
+      } else {
+        benchmark::DoNotOptimize(map.Get(key));
+      }
+    };
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(thread_count - 1);
+    for (std::size_t t = 1; t < thread_count; ++t) {
+      tasks.push_back(utils::Async("worker", [&, t] {
+        std::uint64_t i = t * 1000003;
+        while (run) do_operation(++i);
+      }));
+    }
+
+    std::uint64_t i = 0;
+    for (auto _ : state) do_operation(++i);
+
+    run = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+
+using RcuMapBench = rcu::RcuMap<std::uint64_t, std::uint64_t>;
+using ShardedMapBench = concurrent::ShardedMap<std::uint64_t, std::uint64_t>;
+
+BENCHMARK_TEMPLATE(map_mixed_read_write, RcuMapBench, 1)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(map_mixed_read_write, ShardedMapBench, 1)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(map_mixed_read_write, RcuMapBench, 10)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(map_mixed_read_write, ShardedMapBench, 10)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
 USERVER_NAMESPACE_END
@@ -20,6 +20,11 @@ struct StdMutexRcuTraits {
   using MutexType = std::mutex;
 };
 
+struct StdMutexSharedEpochRcuTraits {
+  using MutexType = std::mutex;
+  using ReclamationPolicy = rcu::SharedEpochReclamation;
+};
+
 }  // namespace
 
 UTEST(Rcu, Ctr) { rcu::Variable<X> ptr; }
@@ -577,6 +582,138 @@ UTEST_MT(Rcu, Core, 3) {
   }
 }
 
+UTEST(Rcu, SharedEpochLifetime) {
+  std::atomic<bool> destroyed[3]{false, false, false};
+  {
+    rcu::Variable<DestructionTracker, rcu::SharedEpochRcuTraits<
+                                          DestructionTracker>>
+        var{rcu::DestructionType::kSync, destroyed[0]};
+
+    {
+      auto reader = var.Read();
+      var.Emplace(destroyed[1]);
+      EXPECT_FALSE(destroyed[0]) << "used by the reader";
+
+      auto reader_copy = reader;
+      reader = var.Read();
+      EXPECT_FALSE(destroyed[0]) << "used by the reader copy";
+    }
+
+    var.Cleanup();
+    EXPECT_TRUE(destroyed[0]);
+    EXPECT_FALSE(destroyed[1]);
+
+    var.Emplace(destroyed[2]);
+    EXPECT_TRUE(destroyed[1]) << "not used by anyone";
+    EXPECT_FALSE(destroyed[2]);
+  }
+  EXPECT_TRUE(destroyed[2]);
+}
+
+UTEST(Rcu, SharedEpochDomain) {
+  using Traits = rcu::SharedEpochRcuTraits<DestructionTracker>;
+  std::atomic<bool> destroyed[3]{false, false, false};
+
+  rcu::Variable<DestructionTracker, Traits> first{rcu::DestructionType::kSync,
+                                                  destroyed[0]};
+  {
+    rcu::Variable<DestructionTracker, Traits> second{
+        rcu::DestructionType::kSync, destroyed[1]};
+
+    auto first_reader = first.Read();
+    second.Emplace(destroyed[2]);
+    EXPECT_FALSE(destroyed[1]) << "a reader of the domain delays reclamation";
+    EXPECT_GE(rcu::impl::GetEpochDomainRetiredCountApprox(), 1);
+  }
+
+  // there are no readers of the destroyed variable
+  EXPECT_TRUE(destroyed[1]);
+  EXPECT_TRUE(destroyed[2]);
+}
+
+UTEST(Rcu, SharedEpochAsyncGc) {
+  auto& mutation_task = engine::current_task::GetCurrentTaskContext();
+
+  rcu::Variable<utils::ScopeGuard, rcu::SharedEpochRcuTraits<utils::ScopeGuard>>
+      var([&] { EXPECT_FALSE(mutation_task.IsCurrent()); });
+
+  {
+    auto read_ptr = var.Read();
+    var.Emplace([&] { EXPECT_FALSE(mutation_task.IsCurrent()); });
+  }
+  var.Cleanup();
+
+  // destruction of the last value is executed synchronously
+  var.Emplace([&] { EXPECT_TRUE(mutation_task.IsCurrent()); });
+}
+
+UTEST(Rcu, SharedEpochReclaimOutsideOfWriter) {
+  rcu::Variable<int, rcu::SharedEpochRcuTraits<int>> writer{0};
+  bool write_on_destruction = true;
+  rcu::Variable<utils::ScopeGuard, rcu::SharedEpochRcuTraits<utils::ScopeGuard>>
+      other{rcu::DestructionType::kSync, [&] {
+              // Would deadlock if called under the lock of `writer`
+              if (write_on_destruction) writer.Assign(1);
+            }};
+
+  {
+    auto reader = other.Read();
+    other.Emplace([] {});
+  }
+
+  // Frees the value of `other` retired in the previous epoch
+  writer.Assign(2);
+  EXPECT_EQ(writer.ReadCopy(), 1);
+  write_on_destruction = false;
+}
+
+UTEST_MT(Rcu, SharedEpochTortureTest, kTotalTasks) {
+  using Traits = rcu::SharedEpochRcuTraits<CleaningUpInt>;
+  rcu::Variable<CleaningUpInt, Traits> data{1};
+  rcu::Variable<CleaningUpInt, Traits> other_data{1};
+  std::atomic<bool> keep_running{true};
+
+  engine::Mutex ping_pong_mutex;
+  rcu::ReadablePtr<CleaningUpInt, Traits> ptr = data.Read();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < kReadablePtrPingPongTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::lock_guard lock(ping_pong_mutex);
+        // copy a ptr created by another thread
+        ptr = rcu::ReadablePtr{ptr};
+        ASSERT_GT(ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kReadingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto local_ptr = data.Read();
+        const auto other_ptr = other_data.Read();
+        ASSERT_GT(local_ptr->value, 0);
+        ASSERT_GT(other_ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kWritingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, i] {
+      auto& var = (i % 2 == 0) ? data : other_data;
+      while (keep_running) {
+        const auto old = var.Read();
+        var.Assign(CleaningUpInt{old->value + 1});
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  keep_running = false;
+}
+
 TEST(Rcu, StdMutexInit) {
   rcu::Variable<X, StdMutexRcuTraits> ptr(1, 2);
   auto reader = ptr.Read();
@@ -624,4 +761,15 @@ TEST(Rcu, StdMutexConcurrentWrites) {
   EXPECT_EQ(std::make_pair(3, 2), *reader);
 }
 
+TEST(Rcu, StdMutexSharedEpoch) {
+  rcu::Variable<X, StdMutexSharedEpochRcuTraits> ptr(1, 2);
+
+  auto reader = ptr.Read();
+  ptr.Assign({3, 4});
+  EXPECT_EQ(std::make_pair(1, 2), *reader);
+
+  auto new_reader = ptr.Read();
+  EXPECT_EQ(std::make_pair(3, 4), *new_reader);
+}
+
 USERVER_NAMESPACE_END
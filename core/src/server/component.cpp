@@ -124,6 +124,22 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    session-cache-size:
+                        type: integer
+                        description: max count of TLS sessions in the server side cache, 0 disables the cache
+                        defaultDescription: 0
+                    session-timeout:
+                        type: integer
+                        description: lifetime of cached TLS sessions and session tickets in seconds
+                        defaultDescription: 300
+                    session-tickets:
+                        type: boolean
+                        description: whether to issue TLS session tickets to clients
+                        defaultDescription: true
+                    kernel-offload:
+                        type: boolean
+                        description: hand the TLS encryption to the kernel (kTLS) after the handshake if supported
+                        defaultDescription: false
             handler-defaults:
                 type: object
                 description: handler defaults options
@@ -174,6 +190,26 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+            queue-shedding:
+                type: object
+                description: |
+                    CoDel-like shedding of the requests that waited too long
+                    before their handler started. Handlers with
+                    `throttling_enabled: false` are not affected.
+                additionalProperties: false
+                properties:
+                    target-ms:
+                        type: integer
+                        description: acceptable queue delay
+                        defaultDescription: 5
+                    interval-ms:
+                        type: integer
+                        description: the queue is overloaded if the delay stays over the target for this interval; then sheddable requests are dropped and normal requests are dropped if they waited longer than the target
+                        defaultDescription: 100
+                    max-queue-time-ms:
+                        type: integer
+                        description: drop non-critical requests that waited longer even if the queue is not overloaded
+                        defaultDescription: <no limit>
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
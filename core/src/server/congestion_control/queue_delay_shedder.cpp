@@ -0,0 +1,118 @@
+#include <server/congestion_control/queue_delay_shedder.hpp>
+
+#include <limits>
+
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+namespace {
+
+constexpr auto kNoSojourn =
+    std::numeric_limits<QueueDelayShedder::Clock::rep>::max();
+
+}  // namespace
+
+QueueSheddingConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<QueueSheddingConfig>) {
+  QueueSheddingConfig config;
+  config.target = value["target-ms"].As<std::chrono::milliseconds>(
+      config.target);
+  config.interval = value["interval-ms"].As<std::chrono::milliseconds>(
+      config.interval);
+  config.max_queue_time =
+      value["max-queue-time-ms"]
+          .As<std::optional<std::chrono::milliseconds>>();
+
+  if (config.target.count() <= 0 || config.interval < config.target) {
+    throw std::runtime_error(
+        "Invalid queue shedding config at " + value.GetPath() +
+        ": expected 0 < target-ms <= interval-ms");
+  }
+  return config;
+}
+
+std::optional<handlers::RequestCriticality> ParseRequestCriticality(
+    std::string_view value) noexcept {
+  if (value == "critical") return handlers::RequestCriticality::kCritical;
+  if (value == "normal") return handlers::RequestCriticality::kNormal;
+  if (value == "sheddable") return handlers::RequestCriticality::kSheddable;
+  return std::nullopt;
+}
+
+QueueDelayShedder::QueueDelayShedder(const QueueSheddingConfig& config)
+    : config_(config), interval_min_sojourn_(kNoSojourn) {}
+
+bool QueueDelayShedder::ShouldShed(
+    Clock::time_point now, Clock::duration sojourn,
+    handlers::RequestCriticality criticality) noexcept {
+  const auto sojourn_rep = sojourn.count();
+  auto min_sojourn = interval_min_sojourn_.load(std::memory_order_relaxed);
+  while (sojourn_rep < min_sojourn &&
+         !interval_min_sojourn_.compare_exchange_weak(
+             min_sojourn, sojourn_rep, std::memory_order_relaxed)) {
+  }
+
+  const auto now_rep = now.time_since_epoch().count();
+  auto interval_end = interval_end_.load(std::memory_order_relaxed);
+  if (now_rep >= interval_end &&
+      interval_end_.compare_exchange_strong(
+          interval_end,
+          (now + config_.interval).time_since_epoch().count(),
+          std::memory_order_relaxed)) {
+    const auto interval_min =
+        interval_min_sojourn_.exchange(kNoSojourn, std::memory_order_relaxed);
+    const bool overloaded =
+        interval_end != 0 && interval_min != kNoSojourn &&
+        Clock::duration{interval_min} > config_.target;
+    overloaded_.store(overloaded, std::memory_order_relaxed);
+    if (overloaded) ++overloaded_intervals_;
+  }
+
+  const auto max_sojourn = GetMaxSojourn(criticality);
+  if (!max_sojourn || sojourn <= *max_sojourn) return false;
+
+  if (criticality == handlers::RequestCriticality::kSheddable) {
+    ++shed_sheddable_;
+  } else {
+    ++shed_normal_;
+  }
+  return true;
+}
+
+bool QueueDelayShedder::IsOverloaded() const noexcept {
+  return overloaded_.load(std::memory_order_relaxed);
+}
+
+std::optional<QueueDelayShedder::Clock::duration>
+QueueDelayShedder::GetMaxSojourn(
+    handlers::RequestCriticality criticality) const noexcept {
+  switch (criticality) {
+    case handlers::RequestCriticality::kCritical:
+      return std::nullopt;
+    case handlers::RequestCriticality::kNormal:
+      if (IsOverloaded()) return config_.target;
+      break;
+    case handlers::RequestCriticality::kSheddable:
+      if (IsOverloaded()) return Clock::duration::zero();
+      break;
+  }
+  return config_.max_queue_time;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueDelayShedder& shedder) {
+  writer["overloaded"] = shedder.IsOverloaded() ? 1 : 0;
+  writer["overloaded-intervals"] = shedder.overloaded_intervals_;
+  writer["shed"].ValueWithLabels(shedder.shed_normal_,
+                                 {"criticality", "normal"});
+  writer["shed"].ValueWithLabels(shedder.shed_sheddable_,
+                                 {"criticality", "sheddable"});
+}
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+struct QueueSheddingConfig final {
+  // Queue delay that is acceptable even if it is not going away
+  std::chrono::milliseconds target{5};
+  // Queue is overloaded if the delay stayed over the target for the interval
+  std::chrono::milliseconds interval{100};
+  // Drop non-critical requests that waited longer even without an overload
+  std::optional<std::chrono::milliseconds> max_queue_time;
+};
+
+QueueSheddingConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<QueueSheddingConfig>);
+
+// Returns std::nullopt for unknown values
+std::optional<handlers::RequestCriticality> ParseRequestCriticality(
+    std::string_view value) noexcept;
+
+// CoDel-like shedding of the requests by their queue delay (sojourn time) in
+// the server: from the request read start till the start of its task.
+//
+// The queue is considered overloaded for the next `interval` if the minimal
+// delay during the previous one was over `target`, so short bursts are not
+// shed. While overloaded, sheddable requests are dropped and normal ones are
+// dropped if they waited more than `target`. Critical requests are never
+// dropped.
+class QueueDelayShedder final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit QueueDelayShedder(const QueueSheddingConfig& config);
+
+  // Accounts the request queue delay, returns true if it should be dropped
+  bool ShouldShed(Clock::time_point now, Clock::duration sojourn,
+                  handlers::RequestCriticality criticality) noexcept;
+
+  bool IsOverloaded() const noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const QueueDelayShedder& shedder);
+
+ private:
+  std::optional<Clock::duration> GetMaxSojourn(
+      handlers::RequestCriticality criticality) const noexcept;
+
+  const QueueSheddingConfig config_;
+
+  std::atomic<Clock::rep> interval_end_{0};
+  std::atomic<Clock::rep> interval_min_sojourn_;
+  std::atomic<bool> overloaded_{false};
+
+  utils::statistics::RateCounter overloaded_intervals_;
+  utils::statistics::RateCounter shed_normal_;
+  utils::statistics::RateCounter shed_sheddable_;
+};
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
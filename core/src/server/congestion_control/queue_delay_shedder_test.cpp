@@ -0,0 +1,90 @@
+#include <server/congestion_control/queue_delay_shedder.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::congestion_control::QueueDelayShedder;
+using server::handlers::RequestCriticality;
+using std::chrono::milliseconds;
+
+server::congestion_control::QueueSheddingConfig MakeConfig() {
+  server::congestion_control::QueueSheddingConfig config;
+  config.target = milliseconds{5};
+  config.interval = milliseconds{100};
+  return config;
+}
+
+// Accounts requests with the same queue delay during the whole interval
+void RunInterval(QueueDelayShedder& shedder,
+                 QueueDelayShedder::Clock::time_point& now,
+                 milliseconds sojourn) {
+  for (int i = 0; i < 10; ++i) {
+    shedder.ShouldShed(now, sojourn, RequestCriticality::kCritical);
+    now += milliseconds{11};
+  }
+}
+
+}  // namespace
+
+TEST(QueueDelayShedder, BurstIsNotShed) {
+  QueueDelayShedder shedder{MakeConfig()};
+  auto now = QueueDelayShedder::Clock::now();
+
+  RunInterval(shedder, now, milliseconds{1});
+  EXPECT_FALSE(
+      shedder.ShouldShed(now, milliseconds{50}, RequestCriticality::kNormal));
+  EXPECT_FALSE(shedder.IsOverloaded());
+}
+
+TEST(QueueDelayShedder, StandingQueueIsShed) {
+  QueueDelayShedder shedder{MakeConfig()};
+  auto now = QueueDelayShedder::Clock::now();
+
+  RunInterval(shedder, now, milliseconds{1});
+  RunInterval(shedder, now, milliseconds{20});
+  RunInterval(shedder, now, milliseconds{20});
+  ASSERT_TRUE(shedder.IsOverloaded());
+
+  EXPECT_TRUE(
+      shedder.ShouldShed(now, milliseconds{20}, RequestCriticality::kNormal));
+  EXPECT_FALSE(
+      shedder.ShouldShed(now, milliseconds{2}, RequestCriticality::kNormal));
+  EXPECT_TRUE(
+      shedder.ShouldShed(now, milliseconds{2}, RequestCriticality::kSheddable));
+  EXPECT_FALSE(shedder.ShouldShed(now, milliseconds{1000},
+                                  RequestCriticality::kCritical));
+
+  // The queue drained
+  RunInterval(shedder, now, milliseconds{1});
+  RunInterval(shedder, now, milliseconds{1});
+  EXPECT_FALSE(shedder.IsOverloaded());
+  EXPECT_FALSE(
+      shedder.ShouldShed(now, milliseconds{20}, RequestCriticality::kNormal));
+}
+
+TEST(QueueDelayShedder, MaxQueueTime) {
+  auto config = MakeConfig();
+  config.max_queue_time = milliseconds{100};
+  QueueDelayShedder shedder{config};
+  const auto now = QueueDelayShedder::Clock::now();
+
+  EXPECT_FALSE(
+      shedder.ShouldShed(now, milliseconds{50}, RequestCriticality::kNormal));
+  EXPECT_TRUE(shedder.ShouldShed(now, milliseconds{200},
+                                 RequestCriticality::kSheddable));
+  EXPECT_FALSE(shedder.ShouldShed(now, milliseconds{200},
+                                  RequestCriticality::kCritical));
+}
+
+TEST(QueueDelayShedder, ParseRequestCriticality) {
+  using server::congestion_control::ParseRequestCriticality;
+  EXPECT_EQ(ParseRequestCriticality("sheddable"),
+            RequestCriticality::kSheddable);
+  EXPECT_EQ(ParseRequestCriticality("critical"), RequestCriticality::kCritical);
+  EXPECT_EQ(ParseRequestCriticality("whatever"), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,157 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr double kMinGradient = 0.5;
+constexpr double kMaxGradient = 1.0;
+constexpr auto kNoRtt = std::numeric_limits<std::uint64_t>::max();
+
+void UpdateMin(std::atomic<std::uint64_t>& min, std::uint64_t value) noexcept {
+  auto current = min.load(std::memory_order_relaxed);
+  while (value < current &&
+         !min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::Token::Token(Token&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)), start_(other.start_) {}
+
+AdaptiveConcurrencyLimiter::Token::~Token() {
+  if (!limiter_) return;
+
+  const auto now = Clock::now();
+  limiter_->Release(
+      now, std::chrono::duration_cast<std::chrono::microseconds>(now - start_));
+}
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    const AdaptiveConcurrencyConfig& config)
+    : config_(config),
+      limit_(std::clamp(config.initial_limit, config.min_limit,
+                        config.max_limit)),
+      interval_min_rtt_us_(kNoRtt),
+      next_update_(0),
+      exact_limit_(static_cast<double>(limit_.load())),
+      min_rtt_us_(kNoRtt) {}
+
+bool AdaptiveConcurrencyLimiter::TryAcquire() noexcept {
+  const auto in_flight = in_flight_.fetch_add(1, std::memory_order_relaxed);
+  if (in_flight >= limit_.load(std::memory_order_relaxed)) {
+    in_flight_.fetch_sub(1, std::memory_order_relaxed);
+    ++rejected_;
+    return false;
+  }
+  return true;
+}
+
+void AdaptiveConcurrencyLimiter::Release(
+    Clock::time_point now, std::chrono::microseconds rtt) noexcept {
+  in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  Account(now, rtt);
+}
+
+std::optional<AdaptiveConcurrencyLimiter::Token>
+AdaptiveConcurrencyLimiter::TryAcquireToken() noexcept {
+  if (!TryAcquire()) return std::nullopt;
+  return Token{*this, Clock::now()};
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetLimit() const noexcept {
+  return limit_.load(std::memory_order_relaxed);
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetInFlight() const noexcept {
+  return in_flight_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveConcurrencyLimiter::Account(
+    Clock::time_point now, std::chrono::microseconds rtt) noexcept {
+  const auto rtt_us = static_cast<std::uint64_t>(std::max<std::int64_t>(
+      rtt.count(), 1));
+  rtt_sum_us_.fetch_add(rtt_us, std::memory_order_relaxed);
+  rtt_count_.fetch_add(1, std::memory_order_relaxed);
+  UpdateMin(interval_min_rtt_us_, rtt_us);
+
+  if (now.time_since_epoch().count() <
+      next_update_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  if (updating_.test_and_set(std::memory_order_acquire)) return;
+  Update(now);
+  updating_.clear(std::memory_order_release);
+}
+
+void AdaptiveConcurrencyLimiter::Update(Clock::time_point now) noexcept {
+  if (rtt_count_.load(std::memory_order_relaxed) < config_.min_samples) return;
+
+  next_update_.store((now + config_.update_interval).time_since_epoch().count(),
+                     std::memory_order_relaxed);
+
+  const auto count = rtt_count_.exchange(0, std::memory_order_relaxed);
+  const auto sum = rtt_sum_us_.exchange(0, std::memory_order_relaxed);
+  const auto interval_min =
+      interval_min_rtt_us_.exchange(kNoRtt, std::memory_order_relaxed);
+  if (count == 0) return;
+
+  const auto rtt = static_cast<double>(sum) / static_cast<double>(count);
+  last_rtt_us_.store(static_cast<std::uint64_t>(rtt),
+                     std::memory_order_relaxed);
+
+  if (now >= min_rtt_reset_time_) {
+    // Forget the old minimum, so that the limiter adapts to a permanent
+    // latency growth (e.g. a slower downstream or more work per request)
+    min_rtt_us_.store(interval_min, std::memory_order_relaxed);
+    min_rtt_reset_time_ = now + config_.min_rtt_reset_interval;
+  } else {
+    UpdateMin(min_rtt_us_, interval_min);
+  }
+  const auto min_rtt =
+      static_cast<double>(min_rtt_us_.load(std::memory_order_relaxed));
+
+  const double gradient = std::clamp(config_.rtt_tolerance * min_rtt / rtt,
+                                     kMinGradient, kMaxGradient);
+  const double queue_size = std::sqrt(exact_limit_);
+  double new_limit = exact_limit_ * gradient + queue_size;
+
+  // Do not grow the limit that is not used
+  const auto in_flight = in_flight_.load(std::memory_order_relaxed);
+  if (new_limit > exact_limit_ &&
+      static_cast<double>(in_flight) * 2 < exact_limit_) {
+    new_limit = exact_limit_;
+  }
+
+  new_limit = exact_limit_ * (1.0 - config_.smoothing) +
+              new_limit * config_.smoothing;
+  new_limit = std::clamp(new_limit, static_cast<double>(config_.min_limit),
+                         static_cast<double>(config_.max_limit));
+  if (new_limit < exact_limit_) ++decreased_;
+
+  exact_limit_ = new_limit;
+  limit_.store(static_cast<std::size_t>(new_limit), std::memory_order_relaxed);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AdaptiveConcurrencyLimiter& limiter) {
+  writer["limit"] = limiter.GetLimit();
+  writer["in-flight"] = limiter.GetInFlight();
+  const auto min_rtt = limiter.min_rtt_us_.load(std::memory_order_relaxed);
+  writer["min-rtt-us"] = min_rtt == kNoRtt ? 0 : min_rtt;
+  writer["rtt-us"] = limiter.last_rtt_us_.load(std::memory_order_relaxed);
+  writer["rejected"] = limiter.rejected_;
+  writer["limit-decreased"] = limiter.decreased_;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// Latency-gradient limiter of requests in flight for a single handler.
+//
+// Finished requests report their latencies, once in `update_interval` the
+// mean latency is compared with the minimal observed one:
+//   gradient = clamp(rtt_tolerance * min_rtt / rtt, 0.5, 1)
+//   new_limit = limit * gradient + sqrt(limit)
+// The limit does not grow while less than a half of it is in use.
+//
+// TryAcquire() and the accounting are lock-free, the update is done by the
+// request that happens to finish first after the interval.
+class AdaptiveConcurrencyLimiter final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  class Token final {
+   public:
+    Token(Token&& other) noexcept;
+    Token& operator=(Token&&) = delete;
+    ~Token();
+
+   private:
+    friend class AdaptiveConcurrencyLimiter;
+
+    Token(AdaptiveConcurrencyLimiter& limiter, Clock::time_point start) noexcept
+        : limiter_(&limiter), start_(start) {}
+
+    AdaptiveConcurrencyLimiter* limiter_;
+    Clock::time_point start_;
+  };
+
+  explicit AdaptiveConcurrencyLimiter(const AdaptiveConcurrencyConfig& config);
+
+  // Returns false and counts a rejection if the limit is reached, otherwise
+  // the caller must call Release() when the request is finished.
+  bool TryAcquire() noexcept;
+
+  void Release(Clock::time_point now, std::chrono::microseconds rtt) noexcept;
+
+  // Same as TryAcquire(), Release() is called when the token is destroyed.
+  std::optional<Token> TryAcquireToken() noexcept;
+
+  std::size_t GetLimit() const noexcept;
+
+  std::size_t GetInFlight() const noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AdaptiveConcurrencyLimiter& limiter);
+
+ private:
+  void Account(Clock::time_point now, std::chrono::microseconds rtt) noexcept;
+
+  void Update(Clock::time_point now) noexcept;
+
+  const AdaptiveConcurrencyConfig config_;
+
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> in_flight_{0};
+
+  // samples of the current interval
+  std::atomic<std::uint64_t> rtt_sum_us_{0};
+  std::atomic<std::uint64_t> rtt_count_{0};
+  std::atomic<std::uint64_t> interval_min_rtt_us_;
+
+  std::atomic<Clock::rep> next_update_;
+  std::atomic_flag updating_ = ATOMIC_FLAG_INIT;
+
+  // accessed only by the updating thread, except for the statistics
+  double exact_limit_;
+  std::atomic<std::uint64_t> min_rtt_us_;
+  std::atomic<std::uint64_t> last_rtt_us_{0};
+  Clock::time_point min_rtt_reset_time_{};
+
+  utils::statistics::RateCounter rejected_;
+  utils::statistics::RateCounter decreased_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
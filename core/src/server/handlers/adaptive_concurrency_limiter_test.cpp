@@ -0,0 +1,93 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::AdaptiveConcurrencyLimiter;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+server::handlers::AdaptiveConcurrencyConfig MakeConfig() {
+  server::handlers::AdaptiveConcurrencyConfig config;
+  config.min_limit = 2;
+  config.max_limit = 100;
+  config.initial_limit = 10;
+  config.smoothing = 1.0;
+  config.min_samples = 1;
+  config.update_interval = milliseconds{1};
+  return config;
+}
+
+// Runs `concurrency` requests with the `rtt` latency per update interval
+void Step(AdaptiveConcurrencyLimiter& limiter,
+          AdaptiveConcurrencyLimiter::Clock::time_point& now,
+          std::size_t concurrency, microseconds rtt) {
+  std::size_t acquired = 0;
+  for (std::size_t i = 0; i < concurrency; ++i) {
+    if (limiter.TryAcquire()) ++acquired;
+  }
+  now += milliseconds{1};
+  for (std::size_t i = 0; i < acquired; ++i) limiter.Release(now, rtt);
+}
+
+}  // namespace
+
+TEST(AdaptiveConcurrencyLimiter, RejectsOverLimit) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  ASSERT_EQ(limiter.GetLimit(), 10);
+
+  for (std::size_t i = 0; i < 10; ++i) EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_FALSE(limiter.TryAcquire());
+  EXPECT_EQ(limiter.GetInFlight(), 10);
+
+  limiter.Release(AdaptiveConcurrencyLimiter::Clock::now(), microseconds{100});
+  EXPECT_EQ(limiter.GetInFlight(), 9);
+  EXPECT_TRUE(limiter.TryAcquire());
+}
+
+TEST(AdaptiveConcurrencyLimiter, GrowsWhileLatencyIsStable) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  auto now = AdaptiveConcurrencyLimiter::Clock::now();
+
+  for (int i = 0; i < 100; ++i) {
+    Step(limiter, now, limiter.GetLimit(), microseconds{1000});
+  }
+  EXPECT_EQ(limiter.GetLimit(), 100);
+}
+
+TEST(AdaptiveConcurrencyLimiter, DoesNotGrowUnused) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  auto now = AdaptiveConcurrencyLimiter::Clock::now();
+
+  for (int i = 0; i < 100; ++i) {
+    Step(limiter, now, 2, microseconds{1000});
+  }
+  EXPECT_EQ(limiter.GetLimit(), 10);
+}
+
+TEST(AdaptiveConcurrencyLimiter, ShrinksOnLatencyGrowth) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  auto now = AdaptiveConcurrencyLimiter::Clock::now();
+
+  for (int i = 0; i < 100; ++i) {
+    Step(limiter, now, limiter.GetLimit(), microseconds{1000});
+  }
+  ASSERT_EQ(limiter.GetLimit(), 100);
+
+  // Within a few update intervals the limit is at least halved
+  for (int i = 0; i < 3; ++i) {
+    Step(limiter, now, limiter.GetLimit(), microseconds{10000});
+  }
+  EXPECT_LT(limiter.GetLimit(), 50);
+
+  for (int i = 0; i < 100; ++i) {
+    Step(limiter, now, limiter.GetLimit(), microseconds{10000});
+  }
+  // limit == limit * 0.5 + sqrt(limit)
+  EXPECT_EQ(limiter.GetLimit(), 4);
+}
+
+USERVER_NAMESPACE_END
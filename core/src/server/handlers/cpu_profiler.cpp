@@ -0,0 +1,124 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <engine/task/cpu_profiler.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::size_t kDefaultDurationSeconds = 10;
+constexpr std::size_t kDefaultFrequency = 100;
+constexpr std::size_t kMaxFrequency = 1000;
+
+std::size_t GetNumberArg(const http::HttpRequest& request,
+                         const std::string& name, std::size_t default_value,
+                         std::size_t max_value) {
+  const auto& arg = request.GetArg(name);
+  if (arg.empty()) return default_value;
+
+  std::size_t value = 0;
+  try {
+    value = utils::FromString<std::size_t>(arg);
+  } catch (const std::exception& ex) {
+    throw ClientError(ExternalBody{
+        fmt::format("Invalid '{}' URL parameter: {}", name, ex.what())});
+  }
+  if (value == 0 || value > max_value) {
+    throw ClientError(ExternalBody{fmt::format(
+        "'{}' URL parameter should be from 1 to {}", name, max_value)});
+  }
+  return value;
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /* is_monitor = */ true),
+      max_duration_(config["max-duration"].As<std::chrono::seconds>(60)),
+      max_samples_(config["max-samples"].As<std::size_t>(50000)) {}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  const std::chrono::seconds duration{GetNumberArg(
+      request, "duration", kDefaultDurationSeconds, max_duration_.count())};
+  const auto frequency =
+      GetNumberArg(request, "frequency", kDefaultFrequency, kMaxFrequency);
+  const auto& format = request.GetArg("format");
+  if (!format.empty() && format != "folded" && format != "pprof") {
+    throw ClientError(ExternalBody{
+        fmt::format("Unknown value '{}' of 'format' URL parameter. Expected "
+                    "one of the following: folded, pprof",
+                    format)});
+  }
+
+  // Samples of all the CPUs busy for the whole duration, if they fit
+  const std::size_t cpus = std::max(std::thread::hardware_concurrency(), 1U);
+  const auto max_samples =
+      std::min(max_samples_, duration.count() * frequency * cpus);
+
+  std::optional<engine::impl::CpuProfiler> profiler;
+  try {
+    profiler.emplace(std::chrono::microseconds{1'000'000 / frequency},
+                     max_samples);
+  } catch (const engine::impl::CpuProfilerBusyError& ex) {
+    throw ConflictError(ExternalBody{ex.what()});
+  }
+
+  engine::InterruptibleSleepFor(duration);
+  const auto profile = profiler->Stop();
+  if (profile.dropped_samples > 0) {
+    LOG_WARNING() << "CPU profiler dropped " << profile.dropped_samples
+                  << " samples, consider increasing 'max-samples'";
+  }
+
+  auto& response = request.GetHttpResponse();
+  if (format == "pprof") {
+    response.SetContentType(
+        USERVER_NAMESPACE::http::content_type::kApplicationOctetStream);
+    // procfs is not backed by a disk, reading it does not block
+    return engine::impl::ToLegacyPprof(
+        profile, fs::blocking::ReadFileContents("/proc/self/maps"));
+  }
+
+  response.SetContentType(USERVER_NAMESPACE::http::content_type::kTextPlain);
+  return engine::impl::ToFoldedStacks(profile);
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-cpu-profiler config
+additionalProperties: false
+properties:
+    max-duration:
+        type: string
+        description: the maximum duration of a single profiling
+        defaultDescription: 60s
+    max-samples:
+        type: integer
+        description: the maximum number of the samples of a single profiling
+        defaultDescription: 50000
+        minimum: 1
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -91,6 +91,54 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    criticality:
+        type: string
+        description: priority of the requests for the queue delay based shedding of components::Server, could be overridden by the `X-Request-Criticality` request header
+        defaultDescription: normal
+        enum:
+          - critical
+          - normal
+          - sheddable
+    adaptive_concurrency:
+        type: object
+        description: enables the latency-gradient limit of requests in flight
+        defaultDescription: <disabled>
+        additionalProperties: false
+        properties:
+            min_limit:
+                type: integer
+                description: lower bound of the limit
+                defaultDescription: 10
+                minimum: 1
+            max_limit:
+                type: integer
+                description: upper bound of the limit
+                defaultDescription: 1000
+                minimum: 1
+            initial_limit:
+                type: integer
+                description: limit before the first update
+                defaultDescription: 20
+            rtt_tolerance:
+                type: number
+                description: latency growth ratio that is not treated as congestion
+                defaultDescription: 1.5
+            smoothing:
+                type: number
+                description: weight of the new limit estimation, in (0, 1]
+                defaultDescription: 0.2
+            update_interval_ms:
+                type: integer
+                description: how often the limit is recalculated
+                defaultDescription: 10
+            min_samples:
+                type: integer
+                description: min finished requests required to recalculate the limit
+                defaultDescription: 5
+            min_rtt_reset_interval_ms:
+                type: integer
+                description: how often the minimal latency is re-measured
+                defaultDescription: 10000
     decompress_request:
         type: boolean
         description: allow decompression of the requests
@@ -107,6 +155,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: start the handler right after the request headers are received and let it read the body with server::http::RequestBodyStream, the body is not buffered
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
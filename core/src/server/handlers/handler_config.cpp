@@ -31,6 +31,49 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+RequestCriticality Parse(const yaml_config::YamlConfig& yaml,
+                         formats::parse::To<RequestCriticality>) {
+  const auto& value = yaml.As<std::string>();
+  if (value == "critical") return RequestCriticality::kCritical;
+  if (value == "normal") return RequestCriticality::kNormal;
+  if (value == "sheddable") return RequestCriticality::kSheddable;
+  throw std::runtime_error("can't parse RequestCriticality from '" + value +
+                           '\'');
+}
+
+AdaptiveConcurrencyConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<AdaptiveConcurrencyConfig>) {
+  AdaptiveConcurrencyConfig config;
+  config.min_limit = value["min_limit"].As<std::size_t>(config.min_limit);
+  config.max_limit = value["max_limit"].As<std::size_t>(config.max_limit);
+  config.initial_limit =
+      value["initial_limit"].As<std::size_t>(config.initial_limit);
+  config.rtt_tolerance = value["rtt_tolerance"].As<double>(config.rtt_tolerance);
+  config.smoothing = value["smoothing"].As<double>(config.smoothing);
+  config.update_interval = std::chrono::milliseconds{
+      value["update_interval_ms"].As<std::int64_t>(
+          config.update_interval.count())};
+  config.min_samples = value["min_samples"].As<std::size_t>(config.min_samples);
+  config.min_rtt_reset_interval = std::chrono::milliseconds{
+      value["min_rtt_reset_interval_ms"].As<std::int64_t>(
+          config.min_rtt_reset_interval.count())};
+
+  if (config.min_limit == 0 || config.min_limit > config.max_limit) {
+    throw std::runtime_error(fmt::format(
+        "Invalid adaptive_concurrency limits at {}: expected 0 < min_limit <= "
+        "max_limit, got min_limit={} max_limit={}",
+        value.GetPath(), config.min_limit, config.max_limit));
+  }
+  if (config.rtt_tolerance < 1.0 || config.smoothing <= 0.0 ||
+      config.smoothing > 1.0) {
+    throw std::runtime_error(fmt::format(
+        "Invalid adaptive_concurrency at {}: expected rtt_tolerance >= 1 and "
+        "smoothing in (0, 1]",
+        value.GetPath()));
+  }
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -82,12 +125,18 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
           kLogRequestDataSizeDefaultLimit);
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
+  config.adaptive_concurrency =
+      value["adaptive_concurrency"]
+          .As<std::optional<AdaptiveConcurrencyConfig>>();
+  config.criticality = value["criticality"].As<RequestCriticality>(
+      RequestCriticality::kDefault);
   config.decompress_request = value["decompress_request"].As<bool>(true);
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
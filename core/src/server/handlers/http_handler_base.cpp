@@ -4,6 +4,8 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <compression/gzip.hpp>
+#include <engine/task/task_stats.hpp>
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/http/http_request_impl.hpp>
@@ -507,6 +509,22 @@ std::unordered_map<int, logging::Level> ParseStatusCodesLogLevel(
   return result;
 }
 
+AdaptiveConcurrencyLimiter::Token AcquireConcurrencyToken(
+    AdaptiveConcurrencyLimiter& limiter,
+    const http::HttpRequest& http_request) {
+  auto token = limiter.TryAcquireToken();
+  if (!token) {
+    auto log_reason = fmt::format("reached adaptive concurrency limit={}",
+                                  limiter.GetLimit());
+    SetThrottleReason(
+        http_request.GetHttpResponse(), std::move(log_reason),
+        std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::
+                        kAdaptiveConcurrency});
+    throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
+  }
+  return std::move(*token);
+}
+
 }  // namespace
 
 HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
@@ -535,6 +553,11 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
     LOG_WARNING() << "empty allowed methods list in " << config.Name();
   }
 
+  if (GetConfig().adaptive_concurrency) {
+    concurrency_limiter_ = std::make_unique<AdaptiveConcurrencyLimiter>(
+        *GetConfig().adaptive_concurrency);
+  }
+
   if (GetConfig().max_requests_per_second) {
     const auto max_rps = *GetConfig().max_requests_per_second;
     UASSERT_MSG(
@@ -577,6 +600,9 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       std::move(prefix),
       [this](utils::statistics::Writer& result) {
         FormatStatistics(result["handler"], *handler_statistics_);
+        if (concurrency_limiter_) {
+          result["adaptive-concurrency"] = *concurrency_limiter_;
+        }
         if constexpr (kIncludeServerHttpMetrics) {
           FormatStatistics(result["request"], *request_statistics_);
         }
@@ -659,6 +685,7 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     const auto meta_type = CutTrailingSlash(GetMetaType(http_request),
                                             GetConfig().url_trailing_slash);
     span_storage.emplace(MakeSpan(http_request, meta_type));
+    engine::impl::SetCurrentTaskStatsName(HandlerName());
     // All fallible or logging steps should go after this to get good logs.
 
     RequestProcessor request_processor(*this, http_request_impl, http_request,
@@ -667,9 +694,17 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     SetUpBaggage(http_request, request_processor.GetInitialDynamicConfig());
     LogYandexHeaders(http_request);
 
+    // Holds a slot of the adaptive concurrency limit till the request is
+    // handled, the latency is accounted on release
+    std::optional<AdaptiveConcurrencyLimiter::Token> concurrency_token;
     request_processor.ProcessRequestStep(
-        "check_ratelimit",
-        [this, &http_request] { CheckRatelimit(http_request); });
+        "check_ratelimit", [this, &http_request, &concurrency_token] {
+          CheckRatelimit(http_request);
+          if (concurrency_limiter_) {
+            concurrency_token.emplace(
+                AcquireConcurrencyToken(*concurrency_limiter_, http_request));
+          }
+        });
 
     request_processor.ProcessRequestStepNoScopeTime(
         "check_deadline_propagation", [&request_processor, &dp_context] {
@@ -814,6 +849,7 @@ tracing::Span HttpHandlerBase::MakeSpan(const http::HttpRequest& http_request,
                                         const std::string& meta_type) const {
   tracing::SpanBuilder span_builder(fmt::format("http/{}", HandlerName()));
   tracing_manager_.TryFillSpanBuilderFromRequest(http_request, span_builder);
+  span_builder.MakeSamplingDecision(HandlerName());
   auto span = std::move(span_builder).Build();
 
   span.SetLocalLogLevel(log_level_);
@@ -893,6 +929,9 @@ void HttpHandlerBase::DecompressRequestBody(
 
   try {
     if (content_encoding == "gzip") {
+      // decompressed by server::http::RequestBodyStream while being read
+      if (http_request.IsBodyStreamed()) return;
+
       http_request.RemoveHeader("Content-Encoding");
       auto body = compression::gzip::Decompress(
           http_request.RequestBody(),
@@ -25,6 +25,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
   writer["timings"] = stats.timings;
+  writer["timings-histogram"] = stats.timings_histogram;
 }
 
 }  // namespace
@@ -34,6 +35,7 @@ void HttpHandlerMethodStatistics::Account(
   reply_codes_.Account(
       static_cast<utils::statistics::HttpCodes::Code>(stats.code));
   timings_.GetCurrentCounter().Account(stats.timing.count());
+  timings_histogram_.GetCurrentCounter().Account(stats.timing.count());
   if (stats.deadline.IsReachable()) ++deadline_received_;
   if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
 }
@@ -53,6 +55,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
     const HttpHandlerMethodStatistics& stats)
     : timings(stats.timings_.GetStatsForPeriod()),
+      timings_histogram(stats.timings_histogram_.GetStatsForPeriod()),
       reply_codes(stats.reply_codes_),
       in_flight(stats.GetInFlight()),
       finished(stats.finished_.Load()),
@@ -64,6 +67,7 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
   timings.Add(other.timings);
+  timings_histogram.Add(other.timings_histogram);
   reply_codes += other.reply_codes;
   in_flight += other.in_flight;
   finished += other.finished;
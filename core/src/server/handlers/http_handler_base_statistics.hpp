@@ -9,6 +9,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -54,8 +55,13 @@ class HttpHandlerMethodStatistics final {
   using RecentPeriod =
       utils::statistics::RecentPeriod<Percentile, Percentile,
                                       utils::datetime::SteadyClock>;
+  using Histogram = utils::statistics::Histogram<>;
+  using HistogramRecentPeriod =
+      utils::statistics::RecentPeriod<Histogram, Histogram,
+                                      utils::datetime::SteadyClock>;
 
   RecentPeriod timings_;
+  HistogramRecentPeriod timings_histogram_;
   utils::statistics::HttpCodes reply_codes_;
   utils::statistics::RateCounter started_;
   utils::statistics::RateCounter finished_;
@@ -77,6 +83,7 @@ struct HttpHandlerStatisticsSnapshot final {
   void Add(const HttpHandlerStatisticsSnapshot& other);
 
   HttpHandlerMethodStatistics::Percentile timings;
+  HttpHandlerMethodStatistics::Histogram timings_histogram;
   utils::statistics::HttpCodes::Snapshot reply_codes;
   std::size_t in_flight{0};
   utils::statistics::Rate finished;
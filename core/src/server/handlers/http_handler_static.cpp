@@ -1,9 +1,16 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <algorithm>
+#include <optional>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/from_string.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,6 +25,84 @@ auto ParseContentTypeMap(const dynamic_config::DocsMap& docs_map) {
 }
 constexpr dynamic_config::Key<ParseContentTypeMap> kContentTypeMap{};
 
+constexpr std::string_view kBytesUnit = "bytes";
+
+struct ByteRange {
+  std::size_t offset{0};
+  // zero for an unsatisfiable range
+  std::size_t size{0};
+};
+
+std::string_view Trim(std::string_view str) {
+  const auto begin = str.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(" \t");
+  return str.substr(begin, end - begin + 1);
+}
+
+std::optional<std::size_t> ParsePosition(std::string_view str) {
+  if (str.empty() || str.find_first_not_of("0123456789") != str.npos) {
+    return std::nullopt;
+  }
+  try {
+    return utils::FromString<std::size_t>(str);
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
+// Parses a single range of the Range header, see RFC 9110 14.1.2.
+// Returns std::nullopt if the header should be ignored.
+std::optional<ByteRange> ParseRange(std::string_view header,
+                                    std::size_t file_size) {
+  header = Trim(header);
+  if (header.substr(0, kBytesUnit.size()) != kBytesUnit) return std::nullopt;
+  header = Trim(header.substr(kBytesUnit.size()));
+  if (header.empty() || header.front() != '=') return std::nullopt;
+  header = Trim(header.substr(1));
+
+  // multiple ranges are not supported, the whole file is sent instead
+  if (header.find(',') != std::string_view::npos) return std::nullopt;
+
+  const auto dash_pos = header.find('-');
+  if (dash_pos == std::string_view::npos) return std::nullopt;
+  const auto first_str = Trim(header.substr(0, dash_pos));
+  const auto last_str = Trim(header.substr(dash_pos + 1));
+
+  if (first_str.empty()) {
+    // suffix range: the last N bytes
+    const auto suffix_size = ParsePosition(last_str);
+    if (!suffix_size) return std::nullopt;
+    const auto size = std::min(*suffix_size, file_size);
+    return ByteRange{file_size - size, size};
+  }
+
+  const auto first = ParsePosition(first_str);
+  if (!first) return std::nullopt;
+  auto last = file_size - 1;
+  if (!last_str.empty()) {
+    const auto parsed_last = ParsePosition(last_str);
+    if (!parsed_last || *parsed_last < *first) return std::nullopt;
+    last = std::min(last, *parsed_last);
+  }
+  if (*first >= file_size) return ByteRange{};
+  return ByteRange{*first, last - *first + 1};
+}
+
+// Weak comparison of entity tags, see RFC 9110 13.1.2
+bool IsNoneMatchFailed(std::string_view header, std::string_view etag) {
+  bool is_matched = false;
+  std::size_t pos = 0;
+  while (!is_matched && pos != std::string_view::npos) {
+    const auto next_pos = header.find(',', pos);
+    auto tag = Trim(header.substr(pos, next_pos - pos));
+    if (tag.substr(0, 2) == "W/") tag.remove_prefix(2);
+    is_matched = tag == "*" || tag == etag;
+    pos = next_pos == std::string_view::npos ? next_pos : next_pos + 1;
+  }
+  return is_matched;
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -35,14 +120,64 @@ std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
   const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
+  }
+
+  auto& response = request.GetHttpResponse();
+  const auto config = config_.GetSnapshot();
+  response.SetContentType(config[kContentTypeMap][file->extension]);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges,
+                     std::string{kBytesUnit});
+
+  // files in memory have no entity tag to validate the requests with
+  const std::string_view etag =
+      file->file ? std::string_view{file->file->GetETag()} : std::string_view{};
+  if (!etag.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag,
+                       std::string{etag});
+    if (request.HasHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch) &&
+        IsNoneMatchFailed(
+            request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch),
+            etag)) {
+      response.SetStatus(http::HttpStatus::kNotModified);
+      return {};
+    }
+  }
+
+  const auto file_size = file->file ? file->file->GetSize() : file->data.size();
+  ByteRange range{0, file_size};
+  if (request.HasHeader(USERVER_NAMESPACE::http::headers::kRange) &&
+      (!request.HasHeader(USERVER_NAMESPACE::http::headers::kIfRange) ||
+       (!etag.empty() &&
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kIfRange) ==
+            etag))) {
+    const auto requested_range = ParseRange(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kRange),
+        file_size);
+    if (requested_range) {
+      if (requested_range->size == 0) {
+        response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                           fmt::format("bytes */{}", file_size));
+        return {};
+      }
+      range = *requested_range;
+      response.SetStatus(http::HttpStatus::kPartialContent);
+      response.SetHeader(
+          USERVER_NAMESPACE::http::headers::kContentRange,
+          fmt::format("bytes {}-{}/{}", range.offset,
+                      range.offset + range.size - 1, file_size));
+    }
+  }
+
+  if (file->file) {
+    // the file is sent by the server without reading it
+    response.SetBodyFile(file->file, range.offset, range.size);
+    return {};
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+  return file->data.substr(range.offset, range.size);
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -50,7 +185,8 @@ yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
 type: object
 description: |
     Handler that returns HTTP 200 if file exist
-    and returns file data with mapped content/type
+    and returns file data with mapped content/type,
+    supports single byte ranges and entity tags
 additionalProperties: false
 properties:
     fs-cache-component:
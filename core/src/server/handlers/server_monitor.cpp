@@ -2,8 +2,11 @@
 
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/utils/statistics/graphite.hpp>
 #include <userver/utils/statistics/json.hpp>
 #include <userver/utils/statistics/pretty_format.hpp>
@@ -55,8 +58,22 @@ StatsFormat ParseFormat(std::string_view format) {
                   format, kToFormat.DescribeFirst())});
 }
 
+constexpr std::size_t kStreamChunkSize = 64 * 1024;
+
+using utils::statistics::PrometheusSerializer;
+using CachedSerializer = concurrent::Variable<PrometheusSerializer>;
+
 }  // namespace
 
+struct ServerMonitor::PrometheusSerializers final {
+  CachedSerializer& Get(StatsFormat format) {
+    return format == StatsFormat::kPrometheus ? typed : untyped;
+  }
+
+  CachedSerializer typed{PrometheusSerializer::Settings{/*typed=*/true}};
+  CachedSerializer untyped{PrometheusSerializer::Settings{/*typed=*/false}};
+};
+
 ServerMonitor::ServerMonitor(
     const components::ComponentConfig& config,
     const components::ComponentContext& component_context)
@@ -64,10 +81,13 @@ ServerMonitor::ServerMonitor(
       statistics_storage_(
           component_context.FindComponent<components::StatisticsStorage>()
               .GetStorage()),
-      common_labels_{config["common-labels"].As<CommonLabels>({})} {}
+      common_labels_{config["common-labels"].As<CommonLabels>({})},
+      prometheus_serializers_(std::make_unique<PrometheusSerializers>()) {}
 
-std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
-                                              request::RequestContext&) const {
+ServerMonitor::~ServerMonitor() = default;
+
+utils::statistics::Request ServerMonitor::MakeStatisticsRequest(
+    const http::HttpRequest& request, bool is_solomon) const {
   const auto& prefix = request.GetArg("prefix");
   const auto& path = request.GetArg("path");
   if (!path.empty() && !prefix.empty() && path != prefix) {
@@ -84,16 +104,19 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
     }
   }
 
-  const auto format = ParseFormat(request.GetArg("format"));
-
   using utils::statistics::Request;
-  auto common_labels =
-      format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels_;
+  auto common_labels = is_solomon ? Request::AddLabels{} : common_labels_;
+  return path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels),
+                                                std::move(labels))
+                      : Request::MakeWithPath(path, std::move(common_labels),
+                                              std::move(labels));
+}
+
+std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
+                                              request::RequestContext&) const {
+  const auto format = ParseFormat(request.GetArg("format"));
   const auto statistics_request =
-      (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels),
-                                              std::move(labels))
-                    : Request::MakeWithPath(path, std::move(common_labels),
-                                            std::move(labels)));
+      MakeStatisticsRequest(request, format == StatsFormat::kSolomon);
 
   request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
   switch (format) {
@@ -102,12 +125,21 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                                  statistics_request);
 
     case StatsFormat::kPrometheus:
-      return utils::statistics::ToPrometheusFormat(statistics_storage_,
-                                                   statistics_request);
-
-    case StatsFormat::kPrometheusUntyped:
-      return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_,
-                                                          statistics_request);
+    case StatsFormat::kPrometheusUntyped: {
+      // Concurrent scrapes do not wait for each other, only one of them uses
+      // the cached serializer
+      auto serializer =
+          prometheus_serializers_->Get(format).UniqueLock(std::try_to_lock);
+      if (serializer) {
+        return std::string{
+            (*serializer)->Serialize(statistics_storage_, statistics_request)};
+      }
+      return format == StatsFormat::kPrometheus
+                 ? utils::statistics::ToPrometheusFormat(statistics_storage_,
+                                                         statistics_request)
+                 : utils::statistics::ToPrometheusFormatUntyped(
+                       statistics_storage_, statistics_request);
+    }
 
     case StatsFormat::kJson:
       request.GetHttpResponse().SetContentType("application/json");
@@ -133,6 +165,56 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
   UINVARIANT(false, "Unexpected 'format' value");
 }
 
+void ServerMonitor::HandleStreamRequest(
+    const http::HttpRequest& request, request::RequestContext& context,
+    http::ResponseBodyStream& stream) const {
+  const auto format = ParseFormat(request.GetArg("format"));
+  const auto deadline = engine::Deadline{};
+
+  if (format != StatsFormat::kPrometheus &&
+      format != StatsFormat::kPrometheusUntyped) {
+    auto body = HandleRequestThrow(request, context);
+    stream.SetStatusCode(http::HttpStatus::kOk);
+    stream.SetEndOfHeaders();
+    stream.PushBodyChunk(std::move(body), deadline);
+    return;
+  }
+
+  const auto statistics_request =
+      MakeStatisticsRequest(request, /*is_solomon=*/false);
+  stream.SetStatusCode(http::HttpStatus::kOk);
+  stream.SetHeader(USERVER_NAMESPACE::http::headers::kContentType,
+                   std::string{"text/plain; charset=utf-8"});
+  stream.SetEndOfHeaders();
+
+  // The chunks are pushed after the serializer and the statistics storage
+  // are released, a slow client blocks neither the other scrapes nor the
+  // metric writers registration
+  std::vector<std::string> chunks;
+  bool serialized = false;
+  {
+    auto serializer =
+        prometheus_serializers_->Get(format).UniqueLock(std::try_to_lock);
+    if (serializer) {
+      chunks = (*serializer)->SerializeChunks(
+          statistics_storage_, statistics_request, kStreamChunkSize);
+      serialized = true;
+    }
+  }
+  if (!serialized) {
+    chunks.push_back(
+        format == StatsFormat::kPrometheus
+            ? utils::statistics::ToPrometheusFormat(statistics_storage_,
+                                                    statistics_request)
+            : utils::statistics::ToPrometheusFormatUntyped(
+                  statistics_storage_, statistics_request));
+  }
+
+  for (auto& chunk : chunks) {
+    stream.PushBodyChunk(std::move(chunk), deadline);
+  }
+}
+
 std::string ServerMonitor::GetResponseDataForLogging(const http::HttpRequest&,
                                                      request::RequestContext&,
                                                      const std::string&) const {
@@ -0,0 +1,266 @@
+#include <userver/server/handlers/tasks_top.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <components/manager.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_stats.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::chrono::seconds kSamplePeriod{1};
+
+using Clock = std::chrono::steady_clock;
+using Snapshots = std::vector<engine::impl::TaskStatsSnapshot>;
+
+enum class SortBy { kCpu, kQueue, kWait, kSwitches };
+
+SortBy ParseSortBy(const std::string& value) {
+  if (value.empty() || value == "cpu") return SortBy::kCpu;
+  if (value == "queue") return SortBy::kQueue;
+  if (value == "wait") return SortBy::kWait;
+  if (value == "switches") return SortBy::kSwitches;
+
+  throw ClientError(ExternalBody{
+      fmt::format("Unknown value '{}' of 'sort' URL parameter. Expected one of "
+                  "the following: cpu, queue, wait, switches",
+                  value)});
+}
+
+std::chrono::nanoseconds GetTotalWaitTime(
+    const engine::impl::TaskStatsSnapshot& snapshot) {
+  std::chrono::nanoseconds result{0};
+  for (const auto wait_time : snapshot.wait_time) result += wait_time;
+  return result;
+}
+
+std::uint64_t GetSortKey(const engine::impl::TaskStatsSnapshot& snapshot,
+                         SortBy sort_by) {
+  switch (sort_by) {
+    case SortBy::kCpu:
+      return snapshot.execution_time.count();
+    case SortBy::kQueue:
+      return snapshot.queue_wait_time.count();
+    case SortBy::kWait:
+      return GetTotalWaitTime(snapshot).count();
+    case SortBy::kSwitches:
+      return snapshot.context_switches;
+  }
+
+  UINVARIANT(false, "Unexpected SortBy");
+}
+
+std::int64_t ToMicroseconds(std::chrono::nanoseconds duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+formats::json::ValueBuilder FormatSnapshot(
+    const engine::impl::TaskStatsSnapshot& snapshot,
+    std::chrono::nanoseconds period) {
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  result["name"] = snapshot.name;
+  result["tasks"] = snapshot.tasks;
+  result["context-switches"] = snapshot.context_switches;
+  result["execution-us"] = ToMicroseconds(snapshot.execution_time);
+  // Like in `top`, 100 stands for a single fully busy worker thread
+  result["cpu-percent"] =
+      period.count() > 0
+          ? 100.0 * snapshot.execution_time.count() / period.count()
+          : 0.0;
+  result["queue-wait-us"] = ToMicroseconds(snapshot.queue_wait_time);
+
+  formats::json::ValueBuilder wait_json(formats::json::Type::kObject);
+  for (std::size_t i = 0; i < engine::impl::kTaskWaitKindsCount; ++i) {
+    const auto kind = static_cast<engine::impl::TaskWaitKind>(i);
+    wait_json[std::string{ToString(kind)}] =
+        ToMicroseconds(snapshot.wait_time[i]);
+  }
+  result["wait-us"] = std::move(wait_json);
+  return result;
+}
+
+}  // namespace
+
+class TasksTop::Impl final {
+ public:
+  Impl(const components::Manager::TaskProcessorsMap& task_processors,
+       std::chrono::seconds window, std::size_t top)
+      : task_processors_(task_processors), window_(window), top_(top) {
+    sampler_.Start(
+        "tasks-top",
+        utils::PeriodicTask::Settings{kSamplePeriod, utils::Flags<Flags>{},
+                                      logging::Level::kTrace},
+        [this] { TakeSample(); });
+  }
+
+  ~Impl() { sampler_.Stop(); }
+
+  formats::json::Value Handle(const http::HttpRequest& request) const;
+
+ private:
+  using Flags = utils::PeriodicTask::Flags;
+
+  struct Sample final {
+    Clock::time_point time;
+    std::unordered_map<std::string, Snapshots> task_processors;
+  };
+
+  Sample MakeSample() const;
+  void TakeSample();
+
+  const components::Manager::TaskProcessorsMap& task_processors_;
+  const std::chrono::seconds window_;
+  const std::size_t top_;
+  concurrent::Variable<std::deque<Sample>> samples_;
+  utils::PeriodicTask sampler_;
+};
+
+TasksTop::Impl::Sample TasksTop::Impl::MakeSample() const {
+  Sample sample;
+  sample.time = Clock::now();
+  for (const auto& [name, task_processor] : task_processors_) {
+    const auto& task_stats = task_processor->GetTaskStats();
+    if (!task_stats.IsEnabled()) continue;
+    sample.task_processors.emplace(name, task_stats.GetSnapshots());
+  }
+  return sample;
+}
+
+void TasksTop::Impl::TakeSample() {
+  auto sample = MakeSample();
+  const auto window_start = sample.time - window_;
+
+  auto samples = samples_.Lock();
+  samples->push_back(std::move(sample));
+  // The oldest sample is kept at or before the start of the window
+  while (samples->size() > 1 && (*samples)[1].time <= window_start) {
+    samples->pop_front();
+  }
+}
+
+formats::json::Value TasksTop::Impl::Handle(
+    const http::HttpRequest& request) const {
+  const auto& task_processor_name = request.GetArg("task_processor");
+  const auto sort_by = ParseSortBy(request.GetArg("sort"));
+  std::size_t top = top_;
+  if (const auto& top_arg = request.GetArg("top"); !top_arg.empty()) {
+    try {
+      top = utils::FromString<std::size_t>(top_arg);
+    } catch (const std::exception& ex) {
+      throw ClientError(ExternalBody{
+          fmt::format("Invalid 'top' URL parameter: {}", ex.what())});
+    }
+  }
+
+  auto current = MakeSample();
+  if (!task_processor_name.empty() &&
+      !current.task_processors.count(task_processor_name)) {
+    throw ClientError(ExternalBody{fmt::format(
+        "Task processor '{}' does not exist or has no 'task-stats' enabled",
+        task_processor_name)});
+  }
+
+  Sample base;
+  {
+    const auto samples = samples_.Lock();
+    if (!samples->empty()) base = samples->front();
+  }
+  if (base.task_processors.empty()) base.time = current.time;
+  const auto period = current.time - base.time;
+
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  result["window-ms"] =
+      std::chrono::duration_cast<std::chrono::milliseconds>(period).count();
+
+  formats::json::ValueBuilder task_processors_json(
+      formats::json::Type::kObject);
+  for (auto& [name, snapshots] : current.task_processors) {
+    if (!task_processor_name.empty() && name != task_processor_name) continue;
+
+    const auto base_it = base.task_processors.find(name);
+    if (base_it != base.task_processors.end()) {
+      std::unordered_map<std::string_view,
+                         const engine::impl::TaskStatsSnapshot*>
+          base_by_name;
+      for (const auto& snapshot : base_it->second) {
+        base_by_name.emplace(snapshot.name, &snapshot);
+      }
+      for (auto& snapshot : snapshots) {
+        const auto it = base_by_name.find(snapshot.name);
+        if (it != base_by_name.end()) snapshot -= *it->second;
+      }
+    }
+
+    const auto count = std::min(top, snapshots.size());
+    std::partial_sort(snapshots.begin(), snapshots.begin() + count,
+                      snapshots.end(), [sort_by](const auto& l, const auto& r) {
+                        return GetSortKey(l, sort_by) > GetSortKey(r, sort_by);
+                      });
+
+    formats::json::ValueBuilder tasks_json(formats::json::Type::kArray);
+    for (std::size_t i = 0; i < count; ++i) {
+      tasks_json.PushBack(FormatSnapshot(snapshots[i], period));
+    }
+    task_processors_json[name] = std::move(tasks_json);
+  }
+  result["task-processors"] = std::move(task_processors_json);
+
+  return result.ExtractValue();
+}
+
+TasksTop::TasksTop(const components::ComponentConfig& config,
+                   const components::ComponentContext& component_context)
+    : HttpHandlerJsonBase(config, component_context, /* is_monitor = */ true),
+      impl_(std::make_unique<Impl>(
+          component_context.GetManager().GetTaskProcessorsMap(),
+          config["window"].As<std::chrono::seconds>(60),
+          config["top"].As<std::size_t>(20))) {}
+
+TasksTop::~TasksTop() = default;
+
+formats::json::Value TasksTop::HandleRequestJsonThrow(
+    const http::HttpRequest& request, const formats::json::Value&,
+    request::RequestContext&) const {
+  return impl_->Handle(request);
+}
+
+yaml_config::Schema TasksTop::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerJsonBase>(R"(
+type: object
+description: handler-tasks-top config
+additionalProperties: false
+properties:
+    window:
+        type: string
+        description: the time span to report the statistics for
+        defaultDescription: 60s
+    top:
+        type: integer
+        description: the default number of task names per task processor
+        defaultDescription: 20
+        minimum: 1
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
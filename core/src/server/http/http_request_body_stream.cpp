@@ -0,0 +1,92 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+
+#include "http_request_body_stream_producer.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+std::string Decompress(compression::gzip::StreamDecompressor& decompressor,
+                       std::string_view data, bool is_last) {
+  try {
+    return is_last ? decompressor.Finish() : decompressor.Decompress(data);
+  } catch (const compression::TooBigError&) {
+    throw handlers::ClientError(handlers::HandlerErrorCode::kPayloadTooLarge);
+  } catch (const std::exception& e) {
+    throw handlers::RequestParseError(handlers::InternalMessage{
+        std::string{"Failed to decompress request body: "} + e.what()});
+  }
+}
+
+}  // namespace
+
+RequestBodyStream::RequestBodyStream(std::unique_ptr<Impl>&& impl)
+    : impl_(std::move(impl)) {}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream& RequestBodyStream::operator=(RequestBodyStream&&) noexcept =
+    default;
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+std::optional<std::string> RequestBodyStream::ReadChunk(
+    engine::Deadline deadline) {
+  auto& impl = *impl_;
+  std::string chunk;
+  while (true) {
+    if (!impl.consumer.Pop(chunk, deadline)) {
+      const auto status = impl.status->load();
+      // the last chunk may have been pushed right before the status was set
+      if (!impl.consumer.PopNoblock(chunk)) {
+        switch (status) {
+          case RequestBodyStatus::kInProgress:
+            if (engine::current_task::ShouldCancel()) {
+              throw engine::WaitInterruptedException(
+                  engine::current_task::CancellationReason());
+            }
+            throw handlers::ClientError(handlers::InternalMessage{
+                "Request body was not received before the deadline"});
+          case RequestBodyStatus::kTooLarge:
+            throw handlers::ClientError(
+                handlers::HandlerErrorCode::kPayloadTooLarge);
+          case RequestBodyStatus::kAborted:
+            throw handlers::ClientError(handlers::InternalMessage{
+                "Request body was not received completely"});
+          case RequestBodyStatus::kComplete:
+            break;
+        }
+
+        if (!impl.decompressor) return std::nullopt;
+        auto tail = Decompress(*impl.decompressor, {}, /*is_last=*/true);
+        impl.decompressor.reset();
+        if (tail.empty()) return std::nullopt;
+        return tail;
+      }
+    }
+
+    if (!impl.decompressor) return chunk;
+    auto decompressed =
+        Decompress(*impl.decompressor, chunk, /*is_last=*/false);
+    // the decompressor may need more data to produce the output
+    if (!decompressed.empty()) return decompressed;
+  }
+}
+
+std::string RequestBodyStream::ReadAll(engine::Deadline deadline) {
+  std::string body;
+  while (auto chunk = ReadChunk(deadline)) {
+    body += *chunk;
+  }
+  return body;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
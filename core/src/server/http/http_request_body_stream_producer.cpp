@@ -0,0 +1,68 @@
+#include "http_request_body_stream_producer.hpp"
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Body bytes received but not read by the handler yet, the connection is not
+// read while the queue is full
+constexpr size_t kMaxBufferedBodySize = 128 * 1024;
+
+}  // namespace
+
+RequestBodyStreamProducer::RequestBodyStreamProducer(
+    std::optional<RequestBodyStream>& stream,
+    std::optional<size_t> max_decompressed_size)
+    : status_(std::make_shared<std::atomic<RequestBodyStatus>>(
+          RequestBodyStatus::kInProgress)) {
+  const auto queue = RequestBodyQueue::Create(kMaxBufferedBodySize);
+  producer_.emplace(queue->GetProducer());
+
+  auto impl = std::make_unique<RequestBodyStream::Impl>(
+      RequestBodyStream::Impl{queue->GetConsumer(), status_, std::nullopt});
+  if (max_decompressed_size) {
+    impl->decompressor.emplace(*max_decompressed_size);
+  }
+  stream.emplace(std::move(impl));
+}
+
+RequestBodyStreamProducer::~RequestBodyStreamProducer() {
+  if (producer_) Finish(RequestBodyStatus::kAborted);
+}
+
+void RequestBodyStreamProducer::Push(std::string_view data) {
+  UASSERT(producer_);
+  const auto queue = producer_->Queue();
+  while (!data.empty()) {
+    if (queue->NoMoreConsumers()) {
+      // the handler has finished without reading the whole body
+      return;
+    }
+
+    const auto chunk = data.substr(0, kMaxBufferedBodySize);
+    if (producer_->Push(std::string{chunk})) {
+      data.remove_prefix(chunk.size());
+    } else if (engine::current_task::ShouldCancel()) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+  }
+}
+
+void RequestBodyStreamProducer::Finish(RequestBodyStatus status) {
+  UASSERT(producer_);
+  UASSERT(status != RequestBodyStatus::kInProgress);
+  // the status is set before the consumer is woken up by the producer death
+  status_->store(status);
+  producer_.reset();
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <compression/gzip.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+enum class RequestBodyStatus {
+  kInProgress,
+  kComplete,
+  kTooLarge,
+  kAborted,
+};
+
+using RequestBodyQueue = concurrent::StringStreamQueue;
+
+struct RequestBodyStream::Impl {
+  RequestBodyQueue::Consumer consumer;
+  std::shared_ptr<std::atomic<RequestBodyStatus>> status;
+  std::optional<compression::gzip::StreamDecompressor> decompressor;
+};
+
+/// Pushes the request body received by the connection to RequestBodyStream
+class RequestBodyStreamProducer final {
+ public:
+  /// Creates the producer and its stream. If `max_decompressed_size` is set,
+  /// the stream decompresses gzip'ed body.
+  RequestBodyStreamProducer(std::optional<RequestBodyStream>& stream,
+                            std::optional<size_t> max_decompressed_size);
+
+  RequestBodyStreamProducer(RequestBodyStreamProducer&&) = delete;
+  RequestBodyStreamProducer& operator=(RequestBodyStreamProducer&&) = delete;
+
+  /// Marks the body as not received completely unless Finish() was called
+  ~RequestBodyStreamProducer();
+
+  /// Waits for the stream to have room for the data. The data is dropped if
+  /// the stream is destroyed.
+  /// @throws engine::WaitInterruptedException
+  void Push(std::string_view data);
+
+  void Finish(RequestBodyStatus status);
+
+ private:
+  std::optional<RequestBodyQueue::Producer> producer_;
+  std::shared_ptr<std::atomic<RequestBodyStatus>> status_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
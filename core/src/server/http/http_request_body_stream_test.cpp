@@ -0,0 +1,146 @@
+#include <userver/utest/utest.hpp>
+
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <server/http/http_request_body_stream_producer.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxSize = 1024 * 1024;
+
+std::string Compress(std::string_view data) {
+  namespace bio = boost::iostreams;
+
+  std::string compressed;
+  {
+    bio::filtering_ostream stream;
+    stream.push(bio::gzip_compressor());
+    stream.push(bio::back_inserter(compressed));
+    stream.write(data.data(), data.size());
+  }
+  return compressed;
+}
+
+std::string MakeBody(std::size_t size) {
+  std::string body;
+  body.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    body += static_cast<char>('a' + i % 7);
+  }
+  return body;
+}
+
+}  // namespace
+
+UTEST(HttpRequestBodyStream, Chunks) {
+  std::optional<server::http::RequestBodyStream> stream;
+  server::http::RequestBodyStreamProducer producer{stream, std::nullopt};
+  ASSERT_TRUE(stream);
+
+  producer.Push("first");
+  producer.Push("second");
+  producer.Finish(server::http::RequestBodyStatus::kComplete);
+
+  EXPECT_EQ(stream->ReadChunk(), "first");
+  EXPECT_EQ(stream->ReadChunk(), "second");
+  EXPECT_EQ(stream->ReadChunk(), std::nullopt);
+  EXPECT_EQ(stream->ReadChunk(), std::nullopt);
+}
+
+UTEST_MT(HttpRequestBodyStream, Backpressure, 2) {
+  const auto body = MakeBody(kMaxSize);
+
+  std::optional<server::http::RequestBodyStream> stream;
+  server::http::RequestBodyStreamProducer producer{stream, std::nullopt};
+
+  // blocks till the body is read
+  auto task = engine::AsyncNoSpan([&] {
+    for (std::size_t i = 0; i < body.size(); i += 1000) {
+      producer.Push(std::string_view{body}.substr(i, 1000));
+    }
+    producer.Finish(server::http::RequestBodyStatus::kComplete);
+  });
+
+  EXPECT_EQ(stream->ReadAll(), body);
+  task.Get();
+}
+
+UTEST(HttpRequestBodyStream, Gzip) {
+  const auto body = MakeBody(100000);
+  const auto compressed = Compress(body);
+
+  std::optional<server::http::RequestBodyStream> stream;
+  server::http::RequestBodyStreamProducer producer{stream, kMaxSize};
+
+  auto task = engine::AsyncNoSpan([&] {
+    for (std::size_t i = 0; i < compressed.size(); i += 100) {
+      producer.Push(std::string_view{compressed}.substr(i, 100));
+    }
+    producer.Finish(server::http::RequestBodyStatus::kComplete);
+  });
+
+  EXPECT_EQ(stream->ReadAll(), body);
+  task.Get();
+}
+
+UTEST(HttpRequestBodyStream, GzipTooLarge) {
+  const auto compressed = Compress(MakeBody(kMaxSize));
+
+  std::optional<server::http::RequestBodyStream> stream;
+  server::http::RequestBodyStreamProducer producer{stream, kMaxSize / 2};
+  auto task = engine::AsyncNoSpan([&] {
+    producer.Push(compressed);
+    producer.Finish(server::http::RequestBodyStatus::kComplete);
+  });
+
+  EXPECT_THROW(stream->ReadAll(), server::handlers::ClientError);
+  task.Get();
+}
+
+UTEST(HttpRequestBodyStream, Errors) {
+  std::optional<server::http::RequestBodyStream> stream;
+  {
+    server::http::RequestBodyStreamProducer producer{stream, std::nullopt};
+    producer.Push("data");
+    // the connection is closed before the whole body is received
+  }
+  EXPECT_EQ(stream->ReadChunk(), "data");
+  EXPECT_THROW(stream->ReadChunk(), server::handlers::ClientError);
+
+  std::optional<server::http::RequestBodyStream> too_large_stream;
+  server::http::RequestBodyStreamProducer producer{too_large_stream,
+                                                   std::nullopt};
+  // not received before the deadline
+  EXPECT_THROW(too_large_stream->ReadChunk(engine::Deadline::FromDuration(
+                   std::chrono::milliseconds{10})),
+               server::handlers::ClientError);
+
+  producer.Finish(server::http::RequestBodyStatus::kTooLarge);
+  EXPECT_THROW(too_large_stream->ReadChunk(), server::handlers::ClientError);
+}
+
+UTEST_MT(HttpRequestBodyStream, NotRead, 2) {
+  std::optional<server::http::RequestBodyStream> stream;
+  server::http::RequestBodyStreamProducer producer{stream, std::nullopt};
+
+  // blocks while the body is not read
+  auto task = engine::AsyncNoSpan([&] { producer.Push(MakeBody(kMaxSize)); });
+  task.WaitFor(std::chrono::milliseconds{50});
+  EXPECT_FALSE(task.IsFinished());
+
+  // the stream is closed once the handler task is done, the rest of the body
+  // is dropped
+  stream.reset();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  ASSERT_TRUE(task.IsFinished());
+  UEXPECT_NO_THROW(task.Get());
+  producer.Finish(server::http::RequestBodyStatus::kComplete);
+}
+
+USERVER_NAMESPACE_END
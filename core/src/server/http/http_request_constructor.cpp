@@ -1,7 +1,5 @@
 #include "http_request_constructor.hpp"
 
-#include <algorithm>
-
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -17,11 +15,6 @@ namespace server::http {
 
 namespace {
 
-inline void Strip(const char*& begin, const char*& end) {
-  while (begin < end && isspace(*begin)) ++begin;
-  while (begin < end && isspace(end[-1])) --end;
-}
-
 void StripDuplicateStartingSlashes(std::string& s) {
   if (s.empty() || s[0] != '/') return;
 
@@ -113,6 +106,9 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    is_body_streamed_ = handler_config.request_body_stream;
+    // the handler decompresses the body only if it is enabled in its config
+    decompress_body_stream_ = handler_config.decompress_request;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -159,14 +155,57 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
+  if (body_stream_producer_) {
+    body_stream_producer_->Push({data, size});
+    return;
+  }
   request_->request_body_.append(data, size);
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
+  UASSERT(!body_stream_producer_);
   request_->is_final_ = is_final;
 }
 
+std::shared_ptr<request::RequestBase>
+HttpRequestConstructor::StartBodyStream() {
+  UASSERT(is_body_streamed_);
+  UASSERT(!body_stream_producer_);
+
+  FinalizeImpl();
+  if (status_ != Status::kOk) {
+    // the error response is sent after the body is received
+    return nullptr;
+  }
+
+  std::optional<size_t> max_decompressed_size;
+  if (decompress_body_stream_ &&
+      request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding) ==
+          "gzip") {
+    max_decompressed_size = config_.max_request_size;
+  }
+  body_stream_producer_.emplace(request_->body_stream_, max_decompressed_size);
+  request_->is_body_streamed_ = true;
+
+  CheckStatus();
+  return request_;
+}
+
+void HttpRequestConstructor::SetBodyComplete() { is_body_complete_ = true; }
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
+  if (body_stream_producer_) {
+    if (is_body_complete_) {
+      body_stream_producer_->Finish(RequestBodyStatus::kComplete);
+    } else if (status_ == Status::kRequestTooLarge) {
+      body_stream_producer_->Finish(RequestBodyStatus::kTooLarge);
+    } else {
+      body_stream_producer_->Finish(RequestBodyStatus::kAborted);
+    }
+    body_stream_producer_.reset();
+    return nullptr;
+  }
+
   LOG_TRACE() << "method=" << request_->GetMethodStr()
               << " orig_method=" << request_->GetOrigMethodStr();
 
@@ -189,11 +228,12 @@ void HttpRequestConstructor::FinalizeImpl() {
   }
 
   try {
-    ParseArgs(parsed_url_);
-    if (config_.parse_args_from_body) {
-      if (!config_.decompress_request || !request_->IsBodyCompressed())
-        ParseArgs(request_->request_body_.data(),
-                  request_->request_body_.size());
+    ValidateArgs(parsed_url_);
+    if (config_.parse_args_from_body && !is_body_streamed_) {
+      if (!config_.decompress_request || !request_->IsBodyCompressed()) {
+        USERVER_NAMESPACE::http::parser::ValidateArgs(request_->request_body_);
+        request_->parse_args_from_body_ = true;
+      }
     }
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't parse args: " << ex;
@@ -201,26 +241,11 @@ void HttpRequestConstructor::FinalizeImpl() {
     return;
   }
 
-  UASSERT(std::all_of(request_->request_args_.begin(),
-                      request_->request_args_.end(),
-                      [](const auto& arg) { return !arg.second.empty(); }));
-
-  LOG_TRACE() << "request_args:" << request_->request_args_;
   LOG_TRACE() << "headers:" << request_->headers_;
 
-  try {
-    ParseCookies();
-  } catch (const std::exception& ex) {
-    LOG_WARNING() << "can't parse cookies: " << ex;
-    SetStatus(Status::kParseCookiesError);
-    return;
-  }
-
-  LOG_TRACE() << "cookies:" << request_->cookies_;
-
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  if (!is_body_streamed_ && IsMultipartFormDataContentType(content_type)) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -228,20 +253,16 @@ void HttpRequestConstructor::FinalizeImpl() {
   }
 }
 
-void HttpRequestConstructor::ParseArgs(const http_parser_url& url) {
+void HttpRequestConstructor::ValidateArgs(const http_parser_url& url) {
   if (url.field_set & (1 << http_parser_url_fields::UF_QUERY)) {
     const auto& str_info = url.field_data[http_parser_url_fields::UF_QUERY];
-    ParseArgs(request_->url_.data() + str_info.off, str_info.len);
-    LOG_TRACE() << "query="
-                << request_->url_.substr(str_info.off, str_info.len);
+    request_->query_ =
+        std::string_view{request_->url_}.substr(str_info.off, str_info.len);
+    USERVER_NAMESPACE::http::parser::ValidateArgs(request_->query_);
+    LOG_TRACE() << "query=" << request_->query_;
   }
 }
 
-void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
-  return USERVER_NAMESPACE::http::parser::ParseArgs(
-      std::string_view(data, size), request_->request_args_);
-}
-
 void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
 
@@ -259,50 +280,6 @@ void HttpRequestConstructor::AddHeader() {
   header_value_.clear();
 }
 
-void HttpRequestConstructor::ParseCookies() {
-  const std::string& cookie =
-      request_->GetHeader(USERVER_NAMESPACE::http::headers::kCookie);
-  const char* data = cookie.data();
-  size_t size = cookie.size();
-  const char* end = data + size;
-  const char* key_begin = data;
-  const char* key_end = data;
-  bool parse_key = true;
-  for (const char* ptr = data; ptr <= end; ++ptr) {
-    if (ptr == end || *ptr == ';') {
-      const char* value_begin = nullptr;
-      const char* value_end = nullptr;
-      if (parse_key) {
-        key_end = ptr;
-        value_begin = value_end = ptr;
-      } else {
-        value_begin = key_end + 1;
-        value_end = ptr;
-        Strip(value_begin, value_end);
-        if (value_begin + 2 <= value_end && *value_begin == '"' &&
-            value_end[-1] == '"') {
-          ++value_begin;
-          --value_end;
-        }
-      }
-      Strip(key_begin, key_end);
-      if (key_begin < key_end) {
-        request_->cookies_.emplace(std::piecewise_construct,
-                                   std::tie(key_begin, key_end),
-                                   std::tie(value_begin, value_end));
-      }
-      parse_key = true;
-      key_begin = ptr + 1;
-      continue;
-    }
-    if (*ptr == '=' && parse_key) {
-      parse_key = false;
-      key_end = ptr;
-      continue;
-    }
-  }
-}
-
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) {
   status_ = status;
 }
@@ -386,11 +363,6 @@ void HttpRequestConstructor::CheckStatus() const {
       request_->GetHttpResponse().SetData("invalid args");
       request_->GetHttpResponse().SetReady();
       break;
-    case Status::kParseCookiesError:
-      request_->SetResponseStatus(HttpStatus::kBadRequest);
-      request_->GetHttpResponse().SetData("invalid cookies");
-      request_->GetHttpResponse().SetReady();
-      break;
     case Status::kParseMultipartFormDataError:
       request_->SetResponseStatus(HttpStatus::kBadRequest);
       request_->GetHttpResponse().SetData(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <http_parser.h>
 
@@ -11,6 +12,7 @@
 #include <server/request/request_constructor.hpp>
 
 #include "handler_info_index.hpp"
+#include "http_request_body_stream_producer.hpp"
 #include "http_request_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -29,7 +31,6 @@ class HttpRequestConstructor final : public request::RequestConstructor {
     kHeadersTooLarge,
     kRequestTooLarge,
     kParseArgsError,
-    kParseCookiesError,
     kParseMultipartFormDataError,
   };
 
@@ -54,15 +55,25 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   void SetIsFinal(bool is_final);
 
+  /// Whether the handler reads the body while it is being received
+  bool IsBodyStreamed() const { return is_body_streamed_; }
+  bool IsBodyStreamStarted() const { return body_stream_producer_.has_value(); }
+
+  /// Returns the request to be passed to the handler before the body is
+  /// received, or nullptr if the request is to be finalized as usual, e.g. to
+  /// respond with an error.
+  std::shared_ptr<request::RequestBase> StartBodyStream();
+
+  void SetBodyComplete();
+
+  /// Returns nullptr if the request was already returned by StartBodyStream()
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
   void FinalizeImpl();
 
-  void ParseArgs(const http_parser_url& url);
-  void ParseArgs(const char* data, size_t size);
+  void ValidateArgs(const http_parser_url& url);
   void AddHeader();
-  void ParseCookies();
 
   void SetStatus(Status status);
   void AccountRequestSize(size_t size);
@@ -86,6 +97,11 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   bool url_parsed_ = false;
   Status status_ = Status::kOk;
 
+  bool is_body_streamed_ = false;
+  bool decompress_body_stream_ = false;
+  bool is_body_complete_ = false;
+  std::optional<RequestBodyStreamProducer> body_stream_producer_;
+
   std::shared_ptr<HttpRequestImpl> request_;
 };
 
@@ -1,12 +1,89 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/engine/run_standalone.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request.hpp>
+
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_parser.hpp>
+#include <utils/gbench_allocations.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
+constexpr std::string_view kRequest =
+    "GET /v1/handler?user_id=123&lang=en&filter=a%20b&page=2 HTTP/1.1\r\n"
+    "Host: localhost:8080\r\n"
+    "User-Agent: benchmark/1.0\r\n"
+    "Accept: application/json\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "X-YaRequestId: 0123456789abcdef0123456789abcdef\r\n"
+    "X-YaTraceId: fedcba9876543210fedcba9876543210\r\n"
+    "X-YaSpanId: 0123456789abcdef\r\n"
+    "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; "
+    "yandexuid=12345678901234567890; lang=en\r\n"
+    "\r\n";
+
+enum class Access {
+  kNothing,
+  kTwoHeaders,
+  kEverything,
+};
+
+template <typename Func>
+void RunParser(benchmark::State& state, Func&& on_request) {
+  static const server::http::HandlerInfoIndex kHandlerInfoIndex;
+  static constexpr server::request::HttpRequestConfig kRequestConfig{
+      /*.max_url_size = */ 8192,
+      /*.max_request_size = */ 1024 * 1024,
+      /*.max_headers_size = */ 65536,
+      /*.parse_args_from_body = */ false,
+      /*.testing_mode = */ true,
+      /*.decompress_request = */ false,
+  };
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter accounter;
+
+  engine::RunStandalone([&] {
+    server::http::HttpRequestParser parser(
+        kHandlerInfoIndex, kRequestConfig,
+        [&on_request](std::shared_ptr<server::request::RequestBase>&& request) {
+          auto& impl = static_cast<server::http::HttpRequestImpl&>(*request);
+          on_request(server::http::HttpRequest{impl});
+        },
+        stats, accounter);
+
+    const utils::impl::AllocationsCounter allocations{state};
+    for (auto _ : state) {
+      parser.Parse(kRequest.data(), kRequest.size());
+    }
+  });
+}
+
+void http_request_constructor_parse(benchmark::State& state) {
+  const auto access = static_cast<Access>(state.range(0));
+  RunParser(state, [access](const server::http::HttpRequest& request) {
+    switch (access) {
+      case Access::kNothing:
+        break;
+      case Access::kTwoHeaders:
+        benchmark::DoNotOptimize(
+            request.GetHeader(http::headers::kUserAgent));
+        benchmark::DoNotOptimize(
+            request.GetHeader(http::headers::kXYaRequestId));
+        break;
+      case Access::kEverything:
+        benchmark::DoNotOptimize(request.GetArg("user_id"));
+        benchmark::DoNotOptimize(request.GetCookie("session"));
+        benchmark::DoNotOptimize(
+            request.GetHeader(http::headers::kUserAgent));
+        break;
+    }
+  });
+}
+
 void http_request_constructor_url_decode(benchmark::State& state) {
   std::string tmp = "1";
   std::string input;
@@ -17,6 +94,10 @@ void http_request_constructor_url_decode(benchmark::State& state) {
     benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
 }  // namespace
+BENCHMARK(http_request_constructor_parse)
+    ->Arg(static_cast<int>(Access::kNothing))
+    ->Arg(static_cast<int>(Access::kTwoHeaders))
+    ->Arg(static_cast<int>(Access::kEverything));
 BENCHMARK(http_request_constructor_url_decode)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
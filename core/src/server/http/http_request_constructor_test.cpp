@@ -15,4 +15,19 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+TEST(HttpRequestConstructor, ValidateArgs) {
+  EXPECT_NO_THROW(http::parser::ValidateArgs(""));
+  EXPECT_NO_THROW(http::parser::ValidateArgs("a=Some+String%20x%30&b=&c"));
+  // ParseArgs skips the args without a value
+  EXPECT_NO_THROW(http::parser::ValidateArgs("a%zz&b=1"));
+
+  EXPECT_THROW(http::parser::ValidateArgs("a=%zz"), std::runtime_error);
+  EXPECT_THROW(http::parser::ValidateArgs("a%2=1"), std::runtime_error);
+  EXPECT_THROW(http::parser::ValidateArgs("a=1&b=%3"), std::runtime_error);
+
+  std::unordered_map<std::string, std::vector<std::string>, utils::StrCaseHash>
+      args;
+  EXPECT_THROW(http::parser::ParseArgs("a=1&b=%3", args), std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include "http_request_handler.hpp"
 
 #include <chrono>
+#include <optional>
 #include <stdexcept>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -33,6 +34,8 @@ engine::TaskWithResult<void> StartFailsafeTask(
   static handlers::HttpRequestStatistics dummy_statistics;
 
   http_request.SetHttpHandlerStatistics(dummy_statistics);
+  // The handler is not called, the rest of the body is discarded
+  http_request.CloseBodyStream();
 
   return engine::AsyncNoSpan([request = std::move(request), handler]() {
     request->SetTaskStartTime();
@@ -42,13 +45,35 @@ engine::TaskWithResult<void> StartFailsafeTask(
   });
 }
 
+// Closes the request body stream once the handler task is done, including the
+// case of the task cancelled before it has started. Otherwise the connection
+// waits for the body to be read while the request is alive.
+class BodyStreamCloser final {
+ public:
+  explicit BodyStreamCloser(std::shared_ptr<request::RequestBase> request)
+      : request_(std::move(request)) {}
+
+  BodyStreamCloser(BodyStreamCloser&&) noexcept = default;
+  BodyStreamCloser& operator=(BodyStreamCloser&&) = delete;
+
+  ~BodyStreamCloser() {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (request_) static_cast<HttpRequestImpl&>(*request_).CloseBodyStream();
+  }
+
+ private:
+  std::shared_ptr<request::RequestBase> request_;
+};
+
 }  // namespace
 
 HttpRequestHandler::HttpRequestHandler(
     const components::ComponentContext& component_context,
     const std::optional<std::string>& logger_access_component,
     const std::optional<std::string>& logger_access_tskv_component,
-    bool is_monitor, std::string server_name)
+    bool is_monitor, std::string server_name,
+    const std::optional<congestion_control::QueueSheddingConfig>&
+        queue_shedding)
     : add_handler_disabled_(false),
       is_monitor_(is_monitor),
       server_name_(std::move(server_name)),
@@ -58,6 +83,12 @@ HttpRequestHandler::HttpRequestHandler(
       config_source_(
           component_context.FindComponent<components::DynamicConfig>()
               .GetSource()) {
+  if (queue_shedding) {
+    queue_delay_shedder_ =
+        std::make_unique<congestion_control::QueueDelayShedder>(
+            *queue_shedding);
+  }
+
   auto& logging_component =
       component_context.FindComponent<components::Logging>();
 
@@ -100,6 +131,46 @@ constexpr dynamic_config::Key<ParseStreamApiEnabled> kStreamApiEnabled{};
 utils::statistics::MetricTag<std::atomic<size_t>> kCcStatusCodeIsCustom{
     "congestion-control.rps.is-custom-status-activated"};
 
+handlers::RequestCriticality GetCriticality(
+    const HttpRequestImpl& http_request,
+    const handlers::HttpHandlerBase& handler) {
+  const auto& header = http_request.GetHeader(
+      USERVER_NAMESPACE::http::headers::kXRequestCriticality);
+  if (!header.empty()) {
+    if (const auto criticality =
+            congestion_control::ParseRequestCriticality(header)) {
+      return *criticality;
+    }
+  }
+  return handler.GetConfig().criticality;
+}
+
+// Returns true if the request was shed and the response is already set
+bool ShedByQueueDelay(congestion_control::QueueDelayShedder& shedder,
+                      HttpRequestImpl& http_request,
+                      const handlers::HttpHandlerBase& handler) {
+  const auto now = std::chrono::steady_clock::now();
+  const auto sojourn = now - http_request.StartTime();
+  if (!shedder.ShouldShed(now, sojourn,
+                          GetCriticality(http_request, handler))) {
+    return false;
+  }
+
+  auto& http_response = http_request.GetHttpResponse();
+  SetThrottleReason(
+      http_response, "queue-delay",
+      std::string{
+          USERVER_NAMESPACE::http::headers::ratelimit_reason::kQueueDelay});
+  http_response.SetStatus(HttpStatus::kTooManyRequests);
+
+  LOG_LIMITED_WARNING()
+      << "Request throttled (queue delay "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(sojourn).count()
+      << "ms, limit via 'queue-shedding' of the server listener), url="
+      << http_request.GetUrl();
+  return true;
+}
+
 }  // namespace
 
 engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
@@ -179,12 +250,29 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     http_response.SetStreamBody();
   }
 
-  auto payload = [request = std::move(request), handler] {
+  auto* shedder = throttling_enabled ? queue_delay_shedder_.get() : nullptr;
+  std::optional<BodyStreamCloser> body_stream_closer;
+  if (http_request.IsBodyStreamed()) body_stream_closer.emplace(request);
+  auto payload = [request = std::move(request), handler, shedder,
+                  body_stream_closer = std::move(body_stream_closer)] {
     server::request::kTaskInheritedRequest.Set(
         std::static_pointer_cast<HttpRequestImpl>(request));
 
     request->SetTaskStartTime();
 
+    if (shedder) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      auto& http_request = static_cast<HttpRequestImpl&>(*request);
+      if (ShedByQueueDelay(*shedder, http_request, *handler)) {
+        request->SetResponseNotifyTime();
+        request->GetResponse().SetReady();
+        // The connection waits for the headers of a streamed response; the
+        // body stream was not started, so the status is sent without a body
+        request->GetResponse().SetHeadersEnd();
+        return;
+      }
+    }
+
     request::RequestContext context;
     handler->HandleRequest(*request, context);
 
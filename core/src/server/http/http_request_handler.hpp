@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include <server/congestion_control/queue_delay_shedder.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/mutex.hpp>
@@ -24,7 +25,9 @@ class HttpRequestHandler final : public RequestHandlerBase {
       const components::ComponentContext& component_context,
       const std::optional<std::string>& logger_access_component,
       const std::optional<std::string>& logger_access_tskv_component,
-      bool is_monitor, std::string server_name);
+      bool is_monitor, std::string server_name,
+      const std::optional<congestion_control::QueueSheddingConfig>&
+          queue_shedding = {});
 
   using NewRequestHook =
       std::function<void(std::shared_ptr<request::RequestBase>)>;
@@ -50,6 +53,12 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
+  // nullptr if the queue delay based shedding is disabled
+  const congestion_control::QueueDelayShedder* GetQueueDelayShedder()
+      const noexcept {
+    return queue_delay_shedder_.get();
+  }
+
  private:
   logging::LoggerPtr logger_access_;
   logging::LoggerPtr logger_access_tskv_;
@@ -69,6 +78,7 @@ class HttpRequestHandler final : public RequestHandlerBase {
   std::chrono::steady_clock::time_point cc_enabled_tp_;
   utils::statistics::MetricsStoragePtr metrics_;
   dynamic_config::Source config_source_;
+  std::unique_ptr<congestion_control::QueueDelayShedder> queue_delay_shedder_;
 };
 
 }  // namespace server::http
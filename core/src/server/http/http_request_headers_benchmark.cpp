@@ -3,6 +3,7 @@
 #include <server/http/http_request_constructor.hpp>
 #include <userver/http/predefined_header.hpp>
 
+#include <utils/gbench_allocations.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +32,7 @@ constexpr PredefinedHeader kHeadersArray[kHeadersCount] = {
 };
 
 void http_request_headers_insert(benchmark::State& state) {
+  const utils::impl::AllocationsCounter allocations{state};
   for (auto _ : state) {
     server::http::HttpRequest::HeadersMap map;
 
@@ -44,6 +46,7 @@ void http_request_headers_get(benchmark::State& state) {
   server::http::HttpRequest::HeadersMap map;
   for (const auto& header : kHeadersArray) map[header] = "1";
 
+  const utils::impl::AllocationsCounter allocations{state};
   std::size_t i = 0;
   for (auto _ : state) {
     if (++i == kHeadersCount) i = 0;
@@ -1,5 +1,9 @@
 #include "http_request_impl.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task.hpp>
@@ -9,6 +13,7 @@
 #include <userver/logging/logger.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
+#include <userver/utils/str_icase.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -67,6 +72,53 @@ std::string EscapeForAccessTskvLog(const std::string& str) {
 const std::string kEmptyString{};
 const std::vector<std::string> kEmptyVector{};
 
+inline void Strip(const char*& begin, const char*& end) {
+  while (begin < end && isspace(*begin)) ++begin;
+  while (begin < end && isspace(end[-1])) --end;
+}
+
+void ParseCookies(std::string_view cookie,
+                  server::http::HttpRequest::CookiesMap& cookies) {
+  const char* data = cookie.data();
+  size_t size = cookie.size();
+  const char* end = data + size;
+  const char* key_begin = data;
+  const char* key_end = data;
+  bool parse_key = true;
+  for (const char* ptr = data; ptr <= end; ++ptr) {
+    if (ptr == end || *ptr == ';') {
+      const char* value_begin = nullptr;
+      const char* value_end = nullptr;
+      if (parse_key) {
+        key_end = ptr;
+        value_begin = value_end = ptr;
+      } else {
+        value_begin = key_end + 1;
+        value_end = ptr;
+        Strip(value_begin, value_end);
+        if (value_begin + 2 <= value_end && *value_begin == '"' &&
+            value_end[-1] == '"') {
+          ++value_begin;
+          --value_end;
+        }
+      }
+      Strip(key_begin, key_end);
+      if (key_begin < key_end) {
+        cookies.emplace(std::piecewise_construct, std::tie(key_begin, key_end),
+                        std::tie(value_begin, value_end));
+      }
+      parse_key = true;
+      key_begin = ptr + 1;
+      continue;
+    }
+    if (*ptr == '=' && parse_key) {
+      parse_key = false;
+      key_end = ptr;
+      continue;
+    }
+  }
+}
+
 }  // namespace
 
 namespace server::http {
@@ -98,6 +150,7 @@ const std::string& HttpRequestImpl::GetHost() const {
 }
 
 const std::string& HttpRequestImpl::GetArg(const std::string& arg_name) const {
+  EnsureArgsParsed();
   auto it = request_args_.find(arg_name);
   if (it == request_args_.end()) return kEmptyString;
   return it->second.at(0);
@@ -105,19 +158,25 @@ const std::string& HttpRequestImpl::GetArg(const std::string& arg_name) const {
 
 const std::vector<std::string>& HttpRequestImpl::GetArgVector(
     const std::string& arg_name) const {
+  EnsureArgsParsed();
   auto it = request_args_.find(arg_name);
   if (it == request_args_.end()) return kEmptyVector;
   return it->second;
 }
 
 bool HttpRequestImpl::HasArg(const std::string& arg_name) const {
+  EnsureArgsParsed();
   auto it = request_args_.find(arg_name);
   return (it != request_args_.end());
 }
 
-size_t HttpRequestImpl::ArgCount() const { return request_args_.size(); }
+size_t HttpRequestImpl::ArgCount() const {
+  EnsureArgsParsed();
+  return request_args_.size();
+}
 
 std::vector<std::string> HttpRequestImpl::ArgNames() const {
+  EnsureArgsParsed();
   std::vector<std::string> res;
   res.reserve(request_args_.size());
   for (const auto& arg : request_args_) res.push_back(arg.first);
@@ -209,11 +268,19 @@ bool HttpRequestImpl::HasHeader(
 size_t HttpRequestImpl::HeaderCount() const { return headers_.size(); }
 
 void HttpRequestImpl::RemoveHeader(std::string_view header_name) {
+  if (utils::StrIcaseEqual{}(header_name,
+                             USERVER_NAMESPACE::http::headers::kCookie)) {
+    EnsureCookiesParsed();
+  }
   headers_.erase(header_name);
 }
 
 void HttpRequestImpl::RemoveHeader(
     const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name) {
+  if (utils::StrIcaseEqual{}(header_name,
+                             USERVER_NAMESPACE::http::headers::kCookie)) {
+    EnsureCookiesParsed();
+  }
   headers_.erase(header_name);
 }
 
@@ -227,30 +294,54 @@ const HttpRequest::HeadersMap& HttpRequestImpl::GetHeaders() const {
 
 const std::string& HttpRequestImpl::GetCookie(
     const std::string& cookie_name) const {
+  EnsureCookiesParsed();
   auto it = cookies_.find(cookie_name);
   if (it == cookies_.end()) return kEmptyString;
   return it->second;
 }
 
 bool HttpRequestImpl::HasCookie(const std::string& cookie_name) const {
+  EnsureCookiesParsed();
   return cookies_.count(cookie_name);
 }
 
-size_t HttpRequestImpl::CookieCount() const { return cookies_.size(); }
+size_t HttpRequestImpl::CookieCount() const {
+  EnsureCookiesParsed();
+  return cookies_.size();
+}
 
 HttpRequest::CookiesMapKeys HttpRequestImpl::GetCookieNames() const {
+  EnsureCookiesParsed();
   return HttpRequest::CookiesMapKeys{cookies_};
 }
 
 const HttpRequest::CookiesMap& HttpRequestImpl::GetCookies() const {
+  EnsureCookiesParsed();
   return cookies_;
 }
 
 void HttpRequestImpl::SetRequestBody(std::string body) {
+  // args of the previous body are not lost
+  if (parse_args_from_body_) EnsureArgsParsed();
   request_body_ = std::move(body);
 }
 
+RequestBodyStream& HttpRequestImpl::GetBodyStream() const {
+  if (!is_body_streamed_) {
+    throw std::logic_error(
+        "Request body is not streamed, set 'request-body-stream: true' in the "
+        "static config of the handler");
+  }
+  if (!body_stream_) {
+    throw std::logic_error("Request body stream is already closed");
+  }
+  return *body_stream_;
+}
+
+void HttpRequestImpl::CloseBodyStream() { body_stream_.reset(); }
+
 void HttpRequestImpl::ParseArgsFromBody() {
+  EnsureArgsParsed();
   USERVER_NAMESPACE::http::parser::ParseArgs(request_body_, request_args_);
 }
 
@@ -260,6 +351,24 @@ bool HttpRequestImpl::IsBodyCompressed() const {
   return !encoding.empty() && encoding != "identity";
 }
 
+void HttpRequestImpl::EnsureArgsParsed() const {
+  std::call_once(args_parsed_, [this] {
+    USERVER_NAMESPACE::http::parser::ParseArgs(query_, request_args_);
+    if (parse_args_from_body_) {
+      USERVER_NAMESPACE::http::parser::ParseArgs(request_body_, request_args_);
+    }
+    UASSERT(std::all_of(request_args_.begin(), request_args_.end(),
+                        [](const auto& arg) { return !arg.second.empty(); }));
+  });
+}
+
+void HttpRequestImpl::EnsureCookiesParsed() const {
+  std::call_once(cookies_parsed_, [this] {
+    ParseCookies(GetHeader(USERVER_NAMESPACE::http::headers::kCookie),
+                 cookies_);
+  });
+}
+
 void HttpRequestImpl::DoUpgrade(std::unique_ptr<engine::io::RwBase>&& socket,
                                 engine::io::Sockaddr&& peer_name) const {
   upgrade_websocket_cb_(std::move(socket), std::move(peer_name));
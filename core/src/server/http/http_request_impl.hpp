@@ -2,7 +2,10 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -86,6 +89,11 @@ class HttpRequestImpl final : public request::RequestBase {
 
   const std::string& RequestBody() const { return request_body_; }
   void SetRequestBody(std::string body);
+  bool IsBodyStreamed() const { return is_body_streamed_; }
+  RequestBodyStream& GetBodyStream() const;
+  // Called once the handler is done with the request, the connection discards
+  // the rest of the body instead of waiting for it to be read
+  void CloseBodyStream();
   void ParseArgsFromBody();
   void SetResponseStatus(HttpStatus status) const {
     response_.SetStatus(status);
@@ -141,6 +149,9 @@ class HttpRequestImpl final : public request::RequestBase {
   friend class HttpRequestConstructor;
 
  private:
+  void EnsureArgsParsed() const;
+  void EnsureCookiesParsed() const;
+
   // method_ = (orig_method_ == kHead ? kGet : orig_method_)
   HttpMethod method_{HttpMethod::kUnknown};
   HttpMethod orig_method_{HttpMethod::kUnknown};
@@ -149,8 +160,17 @@ class HttpRequestImpl final : public request::RequestBase {
   std::string url_;
   std::string request_path_;
   std::string request_body_;
+  // Set instead of request_body_ for handlers with `request-body-stream`
+  mutable std::optional<RequestBodyStream> body_stream_;
+  bool is_body_streamed_{false};
   std::string path_suffix_;
-  std::unordered_map<std::string, std::vector<std::string>, utils::StrCaseHash>
+  // Args are validated by HttpRequestConstructor, args and cookies are parsed
+  // on the first access as most of the handlers do not need them
+  std::string_view query_;
+  bool parse_args_from_body_{false};
+  mutable std::once_flag args_parsed_;
+  mutable std::unordered_map<std::string, std::vector<std::string>,
+                             utils::StrCaseHash>
       request_args_;
   std::unordered_map<std::string, std::vector<FormDataArg>, utils::StrCaseHash>
       form_data_args_;
@@ -158,7 +178,8 @@ class HttpRequestImpl final : public request::RequestBase {
   std::unordered_map<std::string, size_t, utils::StrCaseHash>
       path_args_by_name_index_;
   HttpRequest::HeadersMap headers_;
-  HttpRequest::CookiesMap cookies_;
+  mutable std::once_flag cookies_parsed_;
+  mutable HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
   UpgradeCallback upgrade_websocket_cb_;
 
@@ -181,6 +181,14 @@ int HttpRequestParser::OnHeadersCompleteImpl(http_parser* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+
+  if (request_constructor_->IsBodyStreamed()) {
+    request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+    // the handler is started before the body is received
+    if (auto request = request_constructor_->StartBodyStream()) {
+      on_new_request_cb_(std::move(request));
+    }
+  }
   return 0;
 }
 
@@ -203,7 +211,11 @@ int HttpRequestParser::OnMessageCompleteImpl(http_parser* p) {
   if (p->upgrade) {
     return -1;  // error
   }
-  request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+  if (request_constructor_->IsBodyStreamStarted()) {
+    request_constructor_->SetBodyComplete();
+  } else {
+    request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+  }
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
   if (!FinalizeRequest()) return -1;
@@ -243,9 +255,10 @@ bool HttpRequestParser::FinalizeRequest() {
 bool HttpRequestParser::FinalizeRequestImpl() {
   if (!request_constructor_) CreateRequestConstructor();
 
+  const bool is_body_streamed = request_constructor_->IsBodyStreamStarted();
   if (auto request = request_constructor_->Finalize()) {
     on_new_request_cb_(std::move(request));
-  } else {
+  } else if (!is_body_streamed) {
     LOG_ERROR() << "request is null after Finalize()";
     return false;
   }
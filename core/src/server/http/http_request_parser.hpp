@@ -33,6 +33,12 @@ class HttpRequestParser final : public request::RequestParser {
 
   bool Parse(const char* data, size_t size) override;
 
+  /// Whether the body of the request already passed to the handler is being
+  /// received
+  bool IsBodyStreaming() const {
+    return request_constructor_ && request_constructor_->IsBodyStreamStarted();
+  }
+
  private:
   static int OnMessageBegin(http_parser* p);
   static int OnUrl(http_parser* p, const char* data, size_t size);
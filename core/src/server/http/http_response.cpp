@@ -6,7 +6,10 @@
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/fs/opened_file.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -280,8 +283,11 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
   std::size_t sent_bytes{};
 
-  if (IsBodyStreamed() && GetData().empty()) {
+  // The body stream is waited for only if a handler has started it
+  if (IsBodyStreamed() && !body_stream_producer_ && GetData().empty()) {
     sent_bytes = SetBodyStreamed(socket, header);
+  } else if (body_file_ && GetData().empty()) {
+    sent_bytes = SendBodyFile(socket, header);
   } else {
     // e.g. a CustomHandlerException
     sent_bytes = SetBodyNotStreamed(socket, header);
@@ -356,6 +362,48 @@ std::size_t HttpResponse::SetBodyStreamed(engine::io::RwBase& socket,
   return sent_bytes;
 }
 
+std::size_t HttpResponse::SendBodyFile(engine::io::RwBase& socket,
+                                       std::string& header) {
+  UASSERT(body_file_offset_ + body_file_size_ <= body_file_->GetSize());
+  impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
+                     fmt::format(FMT_COMPILE("{}"), body_file_size_));
+  header.append(kCrlf);
+
+  if (request_.GetOrigMethod() == HttpMethod::kHead || body_file_size_ == 0) {
+    return socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+  }
+
+  const auto fd = body_file_->GetNative();
+  std::size_t sent_bytes = 0;
+  std::size_t sent_body_bytes = 0;
+  if (auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+    sent_bytes =
+        plain_socket->SendAll(header.data(), header.size(), engine::Deadline{});
+    sent_body_bytes = plain_socket->SendFile(
+        fd, body_file_offset_, body_file_size_, engine::Deadline{});
+  } else if (auto* tls = dynamic_cast<engine::io::TlsWrapper*>(&socket);
+             tls && tls->IsKernelTlsEnabled()) {
+    sent_bytes = tls->SendAll(header.data(), header.size(), engine::Deadline{});
+    sent_body_bytes = tls->SendFile(fd, body_file_offset_, body_file_size_,
+                                    engine::Deadline{});
+  } else {
+    // userspace encryption needs the data in memory anyway
+    const auto data =
+        body_file_->GetData().substr(body_file_offset_, body_file_size_);
+    return socket.WriteAll(
+        {{header.data(), header.size()}, {data.data(), data.size()}},
+        engine::Deadline{});
+  }
+
+  if (sent_body_bytes != body_file_size_) {
+    // the file was truncated, Content-Length is already sent
+    throw engine::io::IoException(
+        fmt::format("Sent {} bytes of the file instead of {}", sent_body_bytes,
+                    body_file_size_));
+  }
+  return sent_bytes + sent_body_bytes;
+}
+
 void SetThrottleReason(http::HttpResponse& http_response,
                        std::string log_reason, std::string http_header_reason) {
   http_response.SetHeader(
@@ -388,6 +436,15 @@ HttpResponse::Queue::Producer HttpResponse::GetBodyProducer() {
   return producer;
 }
 
+void HttpResponse::SetBodyFile(std::shared_ptr<const fs::OpenedFile> file,
+                               std::size_t offset, std::size_t size) {
+  UASSERT(file);
+  UASSERT(offset + size <= file->GetSize());
+  body_file_ = std::move(file);
+  body_file_offset_ = offset;
+  body_file_size_ = size;
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
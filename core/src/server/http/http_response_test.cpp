@@ -117,6 +117,40 @@ UTEST_P(HttpResponseBody, ForbiddenBody) {
 INSTANTIATE_UTEST_SUITE_P(HttpResponseForbiddenBody, HttpResponseBody,
                           testing::Values(100, 101, 150, 199, 304, 204));
 
+UTEST(HttpResponse, StreamedBodyNotStarted) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  // A request to a streaming handler shed before the handler is called
+  response.SetStreamBody();
+  response.SetStatus(server::http::HttpStatus::kTooManyRequests);
+  response.SetReady();
+  response.SetHeadersEnd();
+  ASSERT_TRUE(response.WaitForHeadersEnd());
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  const std::string_view reply{buffer.data(), reply_size};
+  constexpr std::string_view kExpectedHeader = "HTTP/1.1 429 ";
+  ASSERT_EQ(reply.substr(0, kExpectedHeader.size()), kExpectedHeader);
+  EXPECT_EQ(reply.find(http::headers::kTransferEncoding),
+            std::string_view::npos);
+  EXPECT_EQ(reply.substr(reply.size() - 4), "\r\n\r\n");
+  UEXPECT_NO_THROW(send_task.Get());
+}
+
 TEST(HttpResponse, GetHeaderDoesntThrow) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
@@ -165,7 +165,9 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
 
     std::vector<char> buf(config_.in_buffer_size);
     std::size_t last_bytes_read = 0;
-    while (is_accepting_requests_) {
+    // A request with streamed body is passed to the handler right after its
+    // headers, the body is read even if it is the last request
+    while (is_accepting_requests_ || request_parser.IsBodyStreaming()) {
       auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
       bool is_readable = true;
@@ -6,7 +6,18 @@ namespace server::net {
 
 EndpointInfo::EndpointInfo(const ListenerConfig& listener_config,
                            http::HttpRequestHandler& request_handler)
-    : listener_config(listener_config), request_handler(request_handler) {}
+    : listener_config(listener_config), request_handler(request_handler) {
+  if (listener_config.tls) {
+    engine::io::TlsServerSettings settings;
+    settings.cert = listener_config.tls_cert;
+    settings.key = listener_config.tls_private_key;
+    settings.session_cache_size = listener_config.tls_session_cache_size;
+    settings.session_timeout = listener_config.tls_session_timeout;
+    settings.session_tickets = listener_config.tls_session_tickets;
+    settings.kernel_tls = listener_config.tls_kernel_offload;
+    tls_context.emplace(settings);
+  }
+}
 
 std::string EndpointInfo::GetDescription() const {
   if (listener_config.unix_socket_path.empty())
@@ -24,6 +24,9 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
   config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
+  config.queue_shedding =
+      value["queue-shedding"]
+          .As<std::optional<congestion_control::QueueSheddingConfig>>();
 
   if (config.port != 0 && !config.unix_socket_path.empty())
     throw std::runtime_error(
@@ -56,6 +59,15 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   if (!pkey_pass_name.empty()) {
     config.tls_private_key_passphrase_name = pkey_pass_name;
   }
+  config.tls_session_cache_size = value["tls"]["session-cache-size"].As<size_t>(
+      config.tls_session_cache_size);
+  config.tls_session_timeout =
+      value["tls"]["session-timeout"].As<std::chrono::seconds>(
+          config.tls_session_timeout);
+  config.tls_session_tickets =
+      value["tls"]["session-tickets"].As<bool>(config.tls_session_tickets);
+  config.tls_kernel_offload =
+      value["tls"]["kernel-offload"].As<bool>(config.tls_kernel_offload);
 
   return config;
 }
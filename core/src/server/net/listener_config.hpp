@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -8,6 +9,7 @@
 #include <userver/server/request/request_config.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <server/congestion_control/queue_delay_shedder.hpp>
 #include "connection_config.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -23,12 +25,17 @@ struct ListenerConfig {
   size_t max_connections = 32768;
   std::optional<size_t> shards;
   std::string task_processor;
+  std::optional<congestion_control::QueueSheddingConfig> queue_shedding;
 
   bool tls{false};
   crypto::Certificate tls_cert;
   std::string tls_private_key_path;
   std::string tls_private_key_passphrase_name;
   crypto::PrivateKey tls_private_key;
+  size_t tls_session_cache_size{0};
+  std::chrono::seconds tls_session_timeout{300};
+  bool tls_session_tickets{true};
+  bool tls_kernel_offload{false};
 };
 
 ListenerConfig Parse(const yaml_config::YamlConfig& value,
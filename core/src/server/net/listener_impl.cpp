@@ -98,11 +98,10 @@ void ListenerImpl::SetupConnection(engine::io::Socket peer_socket) {
 
   std::unique_ptr<engine::io::RwBase> socket;
   auto remote_address = peer_socket.Getpeername();
-  if (endpoint_info_->listener_config.tls) {
+  if (endpoint_info_->tls_context) {
     socket = std::make_unique<engine::io::TlsWrapper>(
         engine::io::TlsWrapper::StartTlsServer(
-            std::move(peer_socket), endpoint_info_->listener_config.tls_cert,
-            endpoint_info_->listener_config.tls_private_key, {}));
+            std::move(peer_socket), *endpoint_info_->tls_context, {}));
   } else {
     socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
   }
@@ -56,7 +56,7 @@ void PortInfo::Init(const ServerConfig& config,
 
   request_handler_.emplace(component_context, config.logger_access,
                            config.logger_access_tskv, is_monitor,
-                           config.server_name);
+                           config.server_name, listener_config.queue_shedding);
 
   endpoint_info_ =
       std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
@@ -130,6 +130,7 @@ class ServerImpl final {
 
   RequestsView& GetRequestsView();
   void WriteTotalHandlerStatistics(utils::statistics::Writer& writer) const;
+  void WriteQueueSheddingStatistics(utils::statistics::Writer& writer) const;
 
   void SetRpsRatelimitStatusCode(http::HttpStatus status_code);
   void SetRpsRatelimit(std::optional<size_t> rps);
@@ -311,6 +312,17 @@ void ServerImpl::WriteTotalHandlerStatistics(
   writer = total;
 }
 
+void ServerImpl::WriteQueueSheddingStatistics(
+    utils::statistics::Writer& writer) const {
+  std::shared_lock lock{on_stop_mutex_};
+  if (is_stopping_) return;
+
+  UASSERT(main_port_info_.request_handler_);
+  const auto* shedder =
+      main_port_info_.request_handler_->GetQueueDelayShedder();
+  if (shedder) writer = *shedder;
+}
+
 void ServerImpl::SetRpsRatelimitStatusCode(http::HttpStatus status_code) {
   UASSERT(main_port_info_.request_handler_);
   main_port_info_.request_handler_->SetRpsRatelimitStatusCode(status_code);
@@ -347,6 +359,10 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     request_stats["processed"] = server_stats.requests_processed_count;
     request_stats["parsing"] = server_stats.parser_stats.parsing_request_count;
   }
+
+  if (auto shedding_stats = writer["queue-shedding"]) {
+    pimpl->WriteQueueSheddingStatistics(shedding_stats);
+  }
 }
 
 void Server::WriteTotalHandlerStatistics(
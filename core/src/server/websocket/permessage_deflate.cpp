@@ -0,0 +1,244 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <stdexcept>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// Empty stored block, deflate output of each message ends with it after a
+// Z_SYNC_FLUSH and it is removed from the payload
+constexpr std::array<char, 4> kMessageTail{0x00, 0x00, static_cast<char>(0xff),
+                                           static_cast<char>(0xff)};
+
+// zlib does not support window of 256 bytes for raw deflate
+constexpr int kMinWindowBits = 9;
+
+constexpr std::size_t kMinOutputBufferSize = 1024;
+
+std::string_view Trim(std::string_view str) {
+  const auto begin = str.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(" \t");
+  return str.substr(begin, end - begin + 1);
+}
+
+// Splits "a; b; c" and calls `f(part)` for every part
+template <typename Func>
+void ForEachPart(std::string_view str, char delimiter, Func&& f) {
+  while (true) {
+    const auto pos = str.find(delimiter);
+    f(Trim(str.substr(0, pos)));
+    if (pos == std::string_view::npos) return;
+    str.remove_prefix(pos + 1);
+  }
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  int result = 0;
+  const auto [ptr, ec] =
+      std::from_chars(value.data(), value.data() + value.size(), result);
+  if (ec != std::errc{} || ptr != value.data() + value.size()) {
+    return std::nullopt;
+  }
+  if (result < 8 || result > kMaxWindowBits) return std::nullopt;
+  return result;
+}
+
+std::optional<DeflateSettings> ParseOffer(std::string_view offer,
+                                          const Config& config) {
+  bool is_first = true;
+  bool is_valid = true;
+  DeflateSettings settings;
+  bool has_client_no_context_takeover = false;
+  bool has_client_max_window_bits = false;
+
+  ForEachPart(offer, ';', [&](std::string_view part) {
+    if (std::exchange(is_first, false)) {
+      is_valid = part == kExtensionName;
+      return;
+    }
+    if (!is_valid) return;
+
+    const auto eq_pos = part.find('=');
+    const auto name = Trim(part.substr(0, eq_pos));
+    const auto value = eq_pos == std::string_view::npos
+                           ? std::optional<std::string_view>{}
+                           : Trim(part.substr(eq_pos + 1));
+
+    // RFC 7692: an offer with a duplicate or unknown parameter is declined
+    if (name == "server_no_context_takeover" && !value &&
+        !settings.server_no_context_takeover) {
+      settings.server_no_context_takeover = true;
+    } else if (name == "client_no_context_takeover" && !value &&
+               !has_client_no_context_takeover) {
+      has_client_no_context_takeover = true;
+    } else if (name == "server_max_window_bits" && value &&
+               !settings.has_server_max_window_bits) {
+      const auto bits = ParseWindowBits(*value);
+      if (!bits || *bits < kMinWindowBits) {
+        is_valid = false;
+        return;
+      }
+      settings.server_max_window_bits = *bits;
+      settings.has_server_max_window_bits = true;
+    } else if (name == "client_max_window_bits" &&
+               !has_client_max_window_bits) {
+      // messages are decompressed with the max window, which fits any
+      if (value && !ParseWindowBits(*value)) is_valid = false;
+      has_client_max_window_bits = true;
+    } else {
+      is_valid = false;
+    }
+  });
+
+  if (!is_valid) return std::nullopt;
+
+  settings.server_no_context_takeover |= config.server_no_context_takeover;
+  settings.client_no_context_takeover =
+      has_client_no_context_takeover || config.client_no_context_takeover;
+  return settings;
+}
+
+void CheckZlibResult(int result, const char* operation) {
+  if (result != Z_OK && result != Z_BUF_ERROR) {
+    throw std::runtime_error(std::string{"zlib "} + operation +
+                             " failed with code " + std::to_string(result));
+  }
+}
+
+}  // namespace
+
+std::optional<DeflateSettings> NegotiatePermessageDeflate(
+    std::string_view extensions_header, const Config& config) {
+  std::optional<DeflateSettings> result;
+  ForEachPart(extensions_header, ',', [&](std::string_view offer) {
+    if (!result) result = ParseOffer(offer, config);
+  });
+  return result;
+}
+
+std::string ToResponseHeader(const DeflateSettings& settings) {
+  std::string result{kExtensionName};
+  if (settings.server_no_context_takeover) {
+    result += "; server_no_context_takeover";
+  }
+  if (settings.client_no_context_takeover) {
+    result += "; client_no_context_takeover";
+  }
+  if (settings.has_server_max_window_bits) {
+    result += "; server_max_window_bits=";
+    result += std::to_string(settings.server_max_window_bits);
+  }
+  return result;
+}
+
+Deflater::Deflater(int window_bits, bool no_context_takeover)
+    : stream_(std::make_unique<z_stream>()),
+      no_context_takeover_(no_context_takeover) {
+  UASSERT(window_bits >= kMinWindowBits && window_bits <= kMaxWindowBits);
+  // negative window bits stand for raw deflate without zlib header
+  CheckZlibResult(deflateInit2(stream_.get(), Z_DEFAULT_COMPRESSION,
+                               Z_DEFLATED, -window_bits, 8,
+                               Z_DEFAULT_STRATEGY),
+                  "deflateInit2");
+}
+
+Deflater::~Deflater() { deflateEnd(stream_.get()); }
+
+std::string Deflater::Compress(utils::impl::Span<const std::byte> data) {
+  std::string result;
+  result.resize(deflateBound(stream_.get(), data.size()) +
+                kMinOutputBufferSize);
+
+  auto& stream = *stream_;
+  // zlib does not modify the input
+  stream.next_in =
+      reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  stream.avail_in = data.size();
+  std::size_t size = 0;
+  do {
+    if (size == result.size()) result.resize(result.size() * 2);
+    stream.next_out = reinterpret_cast<Bytef*>(result.data() + size);
+    stream.avail_out = result.size() - size;
+    CheckZlibResult(deflate(&stream, Z_SYNC_FLUSH), "deflate");
+    size = result.size() - stream.avail_out;
+  } while (stream.avail_out == 0);
+
+  UASSERT(size >= kMessageTail.size());
+  result.resize(size - kMessageTail.size());
+  if (no_context_takeover_) Reset();
+  return result;
+}
+
+void Deflater::Reset() {
+  CheckZlibResult(deflateReset(stream_.get()), "deflateReset");
+}
+
+Inflater::Inflater(bool no_context_takeover)
+    : stream_(std::make_unique<z_stream>()),
+      no_context_takeover_(no_context_takeover) {
+  CheckZlibResult(inflateInit2(stream_.get(), -kMaxWindowBits),
+                  "inflateInit2");
+}
+
+Inflater::~Inflater() { inflateEnd(stream_.get()); }
+
+CloseStatus Inflater::Decompress(std::string_view compressed,
+                                 std::string& message, std::size_t max_size) {
+  auto& stream = *stream_;
+  std::size_t size = 0;
+  message.resize(std::min(
+      max_size, std::max(compressed.size() * 2, kMinOutputBufferSize)));
+
+  bool is_stream_end = false;
+  const std::string_view tail{kMessageTail.data(), kMessageTail.size()};
+  for (const auto input : {compressed, tail}) {
+    // zlib does not modify the input
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = input.size();
+    while (!is_stream_end) {
+      if (size == message.size()) {
+        if (size == max_size) return CloseStatus::kTooBigData;
+        message.resize(std::min(max_size, size * 2));
+      }
+      stream.next_out = reinterpret_cast<Bytef*>(message.data() + size);
+      stream.avail_out = message.size() - size;
+      const auto result = inflate(&stream, Z_SYNC_FLUSH);
+      size = message.size() - stream.avail_out;
+
+      // the client may end the deflate stream with BFINAL block
+      is_stream_end = result == Z_STREAM_END;
+      if (result != Z_OK && result != Z_BUF_ERROR && !is_stream_end) {
+        return CloseStatus::kBadMessageData;
+      }
+      // the whole input is consumed and all the output is flushed
+      if (stream.avail_in == 0 && stream.avail_out != 0) break;
+    }
+  }
+
+  message.resize(size);
+  if (no_context_takeover_ || is_stream_end) {
+    CheckZlibResult(inflateReset(stream_.get()), "inflateReset");
+  }
+  return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
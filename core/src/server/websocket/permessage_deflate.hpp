@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/impl/span.hpp>
+
+struct z_stream_s;
+
+USERVER_NAMESPACE_BEGIN
+
+/// permessage-deflate WebSocket extension
+/// https://datatracker.ietf.org/doc/html/rfc7692
+namespace server::websocket::impl {
+
+inline constexpr int kMaxWindowBits = 15;
+
+/// Negotiated parameters of the extension
+struct DeflateSettings {
+  bool server_no_context_takeover{false};
+  bool client_no_context_takeover{false};
+  int server_max_window_bits{kMaxWindowBits};
+  bool has_server_max_window_bits{false};
+};
+
+/// Chooses the first acceptable offer of the client
+/// `Sec-WebSocket-Extensions` header
+std::optional<DeflateSettings> NegotiatePermessageDeflate(
+    std::string_view extensions_header, const Config& config);
+
+/// `Sec-WebSocket-Extensions` response header value
+std::string ToResponseHeader(const DeflateSettings& settings);
+
+/// Compresses messages sent by the server
+class Deflater final {
+ public:
+  Deflater(int window_bits, bool no_context_takeover);
+
+  Deflater(const Deflater&) = delete;
+  Deflater& operator=(const Deflater&) = delete;
+  ~Deflater();
+
+  /// Compresses the whole message, the result is a payload of frames with RSV1
+  std::string Compress(utils::impl::Span<const std::byte> data);
+
+  /// The next message does not refer to the previously compressed data
+  void Reset();
+
+ private:
+  std::unique_ptr<z_stream_s> stream_;
+  const bool no_context_takeover_;
+};
+
+/// Decompresses messages received from the client
+class Inflater final {
+ public:
+  explicit Inflater(bool no_context_takeover);
+
+  Inflater(const Inflater&) = delete;
+  Inflater& operator=(const Inflater&) = delete;
+  ~Inflater();
+
+  /// Decompresses the payload of the whole message
+  /// @returns CloseStatus::kNone on success, the status to close the
+  /// connection with otherwise
+  CloseStatus Decompress(std::string_view compressed, std::string& message,
+                         std::size_t max_size);
+
+ private:
+  std::unique_ptr<z_stream_s> stream_;
+  const bool no_context_takeover_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
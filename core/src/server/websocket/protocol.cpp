@@ -1,5 +1,11 @@
 #include <server/websocket/protocol.hpp>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <cstdlib>
 #include <cstring>
 
@@ -37,21 +43,6 @@ utils::impl::Span<T> MakeSpan(T* ptr, size_t count) {
 
 using utils::impl::Span;
 
-union Mask32 {
-  uint32_t mask32 = 0;
-  uint8_t mask8[4];
-};
-
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-  auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-  while (len >= sizeof(uint32_t)) {
-    *(dest32++) ^= mask.mask32;
-    len -= sizeof(uint32_t);
-  }
-  auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-  for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
-}
-
 template <class T, class V>
 void PushRaw(const T& value, V& data) {
   const auto* valBytes = reinterpret_cast<const char*>(&value);
@@ -60,10 +51,43 @@ void PushRaw(const T& value, V& data) {
 
 }  // namespace
 
+void XorMaskInplace(char* data, std::size_t size, std::uint32_t mask) noexcept {
+  // The mask repeats every 4 bytes and all the blocks below are multiples of
+  // 4 bytes, so the mask is applied from the same offset to each of them
+  std::size_t i = 0;
+#ifdef __AVX2__
+  const auto mask256 = _mm256_set1_epi32(static_cast<int>(mask));
+  for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+    auto* block = reinterpret_cast<__m256i*>(data + i);
+    _mm256_storeu_si256(block,
+                        _mm256_xor_si256(_mm256_loadu_si256(block), mask256));
+  }
+#endif
+#ifdef __SSE2__
+  const auto mask128 = _mm_set1_epi32(static_cast<int>(mask));
+  for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+    auto* block = reinterpret_cast<__m128i*>(data + i);
+    _mm_storeu_si128(block, _mm_xor_si128(_mm_loadu_si128(block), mask128));
+  }
+#endif
+
+  const std::uint64_t mask64 = (std::uint64_t{mask} << 32) | mask;
+  for (; i + sizeof(mask64) <= size; i += sizeof(mask64)) {
+    std::uint64_t block = 0;
+    std::memcpy(&block, data + i, sizeof(block));
+    block ^= mask64;
+    std::memcpy(data + i, &block, sizeof(block));
+  }
+
+  char mask8[sizeof(mask)];
+  std::memcpy(mask8, &mask, sizeof(mask));
+  for (; i < size; ++i) data[i] ^= mask8[i % sizeof(mask)];
+}
+
 namespace frames {
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     Span<const std::byte> data, bool is_text, Continuation is_continuation,
-    Final is_final) {
+    Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -76,15 +100,18 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
   if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_compressed == Compressed::kYes) hdr->bits.reserved = kRsv1;
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
-  } else if (data.size() <= INT16_MAX) {
+  } else if (data.size() <= UINT16_MAX) {
     hdr->bits.payloadLen = 126;
-    PushRaw(boost::endian::native_to_big(data.size()), frame);
+    PushRaw(boost::endian::native_to_big(static_cast<uint16_t>(data.size())),
+            frame);
   } else {
     hdr->bits.payloadLen = 127;
-    PushRaw(boost::endian::native_to_big(data.size()), frame);
+    PushRaw(boost::endian::native_to_big(static_cast<uint64_t>(data.size())),
+            frame);
   }
   return frame;
 }
@@ -157,8 +184,17 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
   RecvExactly(io, AsWritableBytes(MakeSpan(&hdr, 1)), {});
   if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-  const bool isDataFrame =
-      (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+  const bool isDataFrame = hdr.bits.opcode == kText ||
+                           hdr.bits.opcode == kBinary ||
+                           hdr.bits.opcode == kContinuation;
+  if (hdr.bits.reserved & ~kRsv1) return CloseStatus::kProtocolError;
+  if (hdr.bits.reserved == kRsv1) {
+    // RSV1 is set only on the first frame of a compressed message
+    if (!frame.is_deflate_enabled || !isDataFrame ||
+        hdr.bits.opcode == kContinuation) {
+      return CloseStatus::kProtocolError;
+    }
+  }
   if (hdr.bits.payloadLen <= 125) {
     payload_len = hdr.bits.payloadLen;
   } else if (hdr.bits.payloadLen == 126) {
@@ -181,7 +217,7 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
   if (payload_len + frame.payload->size() > max_payload_size)
     return CloseStatus::kTooBigData;
 
-  Mask32 mask;
+  uint32_t mask = 0;
   if (hdr.bits.mask) RecvExactly(io, AsWritableBytes(MakeSpan(&mask, 1)), {});
   if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
@@ -200,9 +236,9 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                 {});
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-    if (mask.mask32)
-      XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()),
-                     frame.payload->size(), mask);
+    if (mask)
+      XorMaskInplace(frame.payload->data() + newPayloadOffset, payload_len,
+                     mask);
   }
   char opcode = hdr.bits.opcode;
   char fin = hdr.bits.fin;
@@ -221,9 +257,11 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
             *(reinterpret_cast<CloseStatusInt const*>(frame.payload->data())));
       break;
     case kText:
-      frame.is_text = true;
-      [[fallthrough]];
     case kBinary:
+      frame.is_text = opcode == kText;
+      frame.is_compressed = hdr.bits.reserved == kRsv1;
+      frame.waiting_continuation = !fin;
+      break;
     case kContinuation:
       frame.waiting_continuation = !fin;
       break;
@@ -10,6 +10,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/impl/span.hpp>
 
+#include <server/websocket/permessage_deflate.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::websocket::impl {
@@ -60,6 +62,9 @@ union WSHeader {
 
 static_assert(sizeof(WSHeader) == 2);
 
+// WSHeader::bits::reserved value with RSV1 set
+constexpr inline unsigned char kRsv1 = 0x4;
+
 constexpr inline unsigned int kMaxFrameHeaderSize =
     sizeof(WSHeader) + sizeof(uint64_t);
 
@@ -75,9 +80,16 @@ enum class Final {
   kNo,
 };
 
+/// RSV1 bit of the first frame of a permessage-deflate compressed message
+enum class Compressed {
+  kYes,
+  kNo,
+};
+
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::impl::Span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final);
+    Continuation is_continuation, Final is_final,
+    Compressed is_compressed = Compressed::kNo);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(
     WSOpcodes opcode, utils::impl::Span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
@@ -88,12 +100,18 @@ const std::array<char, sizeof(WSHeader)>& CloseFrame();
 
 std::string WebsocketSecAnswer(std::string_view sec_key);
 
+/// Applies the masking key of the frame read from the wire to its payload
+void XorMaskInplace(char* data, std::size_t size, std::uint32_t mask) noexcept;
+
 struct FrameParserState {
   bool closed = false;
   bool ping_received = false;
   bool pong_received = false;
   bool waiting_continuation = false;
   bool is_text = false;
+  // permessage-deflate is negotiated and the current message is compressed
+  bool is_deflate_enabled = false;
+  bool is_compressed = false;
   CloseStatusInt remote_close_status = 0;
 
   std::string* payload = nullptr;
@@ -102,6 +120,11 @@ struct FrameParserState {
 CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                         unsigned max_payload_size, std::size_t& payload_len);
 
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateSettings>& deflate_settings);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
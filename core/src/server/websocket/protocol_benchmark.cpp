@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <server/websocket/protocol.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void websocket_unmask_benchmark(benchmark::State& state) {
+  std::string payload(state.range(0), 'x');
+  for (auto _ : state) {
+    server::websocket::impl::XorMaskInplace(payload.data(), payload.size(),
+                                            0x12345678);
+    benchmark::DoNotOptimize(payload.data());
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(websocket_unmask_benchmark)->RangeMultiplier(8)->Range(8, 1 << 20);
+
+void websocket_deflate_benchmark(benchmark::State& state) {
+  std::string payload;
+  for (int i = 0; i < state.range(0); ++i) {
+    payload += std::to_string(i % 100);
+  }
+  const utils::impl::Span<const std::byte> data{
+      reinterpret_cast<const std::byte*>(payload.data()),
+      reinterpret_cast<const std::byte*>(payload.data() + payload.size())};
+
+  server::websocket::impl::Deflater deflater{
+      server::websocket::impl::kMaxWindowBits, false};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(deflater.Compress(data));
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(websocket_deflate_benchmark)->Range(64, 64 << 10);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,155 @@
+#include <server/websocket/protocol.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl::test {
+
+namespace {
+
+std::string MakeMessage(std::size_t size) {
+  std::string message;
+  message.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    message += static_cast<char>('a' + i % 23);
+  }
+  return message;
+}
+
+utils::impl::Span<const std::byte> AsBytes(std::string_view data) {
+  return {reinterpret_cast<const std::byte*>(data.data()),
+          reinterpret_cast<const std::byte*>(data.data() + data.size())};
+}
+
+}  // namespace
+
+TEST(WebsocketProtocol, XorMaskInplace) {
+  const std::uint32_t mask = 0x12345678;
+  char mask_bytes[sizeof(mask)];
+  std::memcpy(mask_bytes, &mask, sizeof(mask));
+
+  for (std::size_t size = 0; size < 200; ++size) {
+    const auto original = MakeMessage(size + 3);
+    auto masked = original;
+    // unaligned data
+    XorMaskInplace(masked.data() + 3, size, mask);
+
+    EXPECT_EQ(masked.substr(0, 3), original.substr(0, 3));
+    for (std::size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(masked[i + 3], original[i + 3] ^ mask_bytes[i % sizeof(mask)])
+          << "size=" << size << " i=" << i;
+    }
+
+    XorMaskInplace(masked.data() + 3, size, mask);
+    EXPECT_EQ(masked, original);
+  }
+}
+
+TEST(WebsocketProtocol, DataFrameHeaderLength) {
+  for (const std::size_t size : {125, 126, 65535, 65536}) {
+    const auto message = MakeMessage(size);
+    const auto header = frames::DataFrameHeader(
+        AsBytes(message), true, frames::Continuation::kNo, frames::Final::kYes);
+    EXPECT_EQ(header.size(), size <= 125     ? 2
+                             : size <= 65535 ? 4
+                                             : 10)
+        << size;
+  }
+}
+
+TEST(WebsocketPermessageDeflate, Negotiate) {
+  const Config config;
+  EXPECT_FALSE(NegotiatePermessageDeflate("", config));
+  EXPECT_FALSE(NegotiatePermessageDeflate("x-webkit-deflate-frame", config));
+  EXPECT_FALSE(NegotiatePermessageDeflate(
+      "permessage-deflate; server_no_context_takeover; "
+      "server_no_context_takeover",
+      config));
+  EXPECT_FALSE(
+      NegotiatePermessageDeflate("permessage-deflate; unknown", config));
+
+  auto settings = NegotiatePermessageDeflate(
+      "permessage-deflate; server_max_window_bits=8, "
+      "permessage-deflate; client_max_window_bits; "
+      "client_no_context_takeover",
+      config);
+  ASSERT_TRUE(settings);
+  EXPECT_FALSE(settings->server_no_context_takeover);
+  EXPECT_TRUE(settings->client_no_context_takeover);
+  EXPECT_FALSE(settings->has_server_max_window_bits);
+  EXPECT_EQ(ToResponseHeader(*settings),
+            "permessage-deflate; client_no_context_takeover");
+
+  settings = NegotiatePermessageDeflate(
+      "permessage-deflate;server_max_window_bits=10", config);
+  ASSERT_TRUE(settings);
+  EXPECT_EQ(settings->server_max_window_bits, 10);
+  EXPECT_EQ(ToResponseHeader(*settings),
+            "permessage-deflate; server_max_window_bits=10");
+
+  Config no_context_config;
+  no_context_config.server_no_context_takeover = true;
+  settings =
+      NegotiatePermessageDeflate("permessage-deflate", no_context_config);
+  ASSERT_TRUE(settings);
+  EXPECT_EQ(ToResponseHeader(*settings),
+            "permessage-deflate; server_no_context_takeover");
+}
+
+TEST(WebsocketPermessageDeflate, Roundtrip) {
+  for (const bool no_context_takeover : {false, true}) {
+    Deflater deflater{kMaxWindowBits, no_context_takeover};
+    Inflater inflater{no_context_takeover};
+
+    std::string decompressed;
+    for (std::size_t i = 0; i < 10; ++i) {
+      const auto message = MakeMessage(i * 10000);
+      const auto compressed = deflater.Compress(AsBytes(message));
+      if (!message.empty()) EXPECT_LT(compressed.size(), message.size());
+
+      ASSERT_EQ(inflater.Decompress(compressed, decompressed, 1000000),
+                CloseStatus::kNone);
+      EXPECT_EQ(decompressed, message);
+    }
+  }
+}
+
+TEST(WebsocketPermessageDeflate, SharedFrame) {
+  // a message compressed without context is decompressed by an inflater
+  // which has the context of previous messages
+  Deflater deflater{kMaxWindowBits, false};
+  Deflater shared_deflater{kMaxWindowBits, true};
+  Inflater inflater{false};
+
+  std::string decompressed;
+  const auto message = MakeMessage(1000);
+  for (auto* current : {&deflater, &shared_deflater, &deflater}) {
+    ASSERT_EQ(inflater.Decompress(current->Compress(AsBytes(message)),
+                                  decompressed, 10000),
+              CloseStatus::kNone);
+    EXPECT_EQ(decompressed, message);
+    if (current == &shared_deflater) deflater.Reset();
+  }
+}
+
+TEST(WebsocketPermessageDeflate, Errors) {
+  Deflater deflater{kMaxWindowBits, true};
+  Inflater inflater{true};
+
+  std::string decompressed;
+  const auto compressed = deflater.Compress(AsBytes(MakeMessage(10000)));
+  EXPECT_EQ(inflater.Decompress(compressed, decompressed, 9999),
+            CloseStatus::kTooBigData);
+
+  Inflater broken_inflater{true};
+  EXPECT_EQ(broken_inflater.Decompress("\xff\xff\xff\xff", decompressed, 9999),
+            CloseStatus::kBadMessageData);
+}
+
+}  // namespace server::websocket::impl::test
+
+USERVER_NAMESPACE_END
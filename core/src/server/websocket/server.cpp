@@ -1,6 +1,7 @@
 #include <userver/server/websocket/server.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/concurrent/lazy_value.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/async.hpp>
@@ -32,16 +33,68 @@ Span<const std::byte> MakeBinarySpan(Span<const char> span) {
           reinterpret_cast<const std::byte*>(span.data() + span.size())};
 }
 
+std::string EncodeFrame(Span<const std::byte> payload, bool is_text,
+                        impl::frames::Compressed is_compressed) {
+  const auto header = impl::frames::DataFrameHeader(
+      payload, is_text, impl::frames::Continuation::kNo,
+      impl::frames::Final::kYes, is_compressed);
+
+  std::string frame;
+  frame.reserve(header.size() + payload.size());
+  frame.append(header.data(), header.size());
+  frame.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+  return frame;
+}
+
 }  // namespace
 
+namespace impl {
+
+struct PreparedMessageData final {
+  PreparedMessageData(std::string_view data, bool is_text)
+      : frame(EncodeFrame(MakeBinarySpan(data), is_text,
+                          frames::Compressed::kNo)),
+        payload_size(data.size()),
+        is_text(is_text),
+        compressed_frame([this] {
+          // Compressed without a context, so the frame may be sent to any
+          // connection regardless of its previous messages
+          Deflater deflater{kMaxWindowBits, /*no_context_takeover=*/true};
+          const auto compressed = deflater.Compress(GetPayload());
+          return EncodeFrame(MakeBinarySpan(compressed), this->is_text,
+                             frames::Compressed::kYes);
+        }) {}
+
+  Span<const std::byte> GetPayload() const {
+    return MakeBinarySpan(std::string_view{frame}.substr(frame.size() -
+                                                          payload_size));
+  }
+
+  const std::string frame;
+  const std::size_t payload_size;
+  const bool is_text;
+  // Compressed on the first send to a connection with permessage-deflate
+  mutable concurrent::LazyValue<std::string> compressed_frame;
+};
+
+}  // namespace impl
+
 Config Parse(const yaml_config::YamlConfig& config,
              formats::parse::To<Config>) {
   return {
       config["max-remote-payload"].As<unsigned>(65536),
       config["fragment-size"].As<unsigned>(65536),
+      config["permessage-deflate"].As<bool>(false),
+      config["server-no-context-takeover"].As<bool>(false),
+      config["client-no-context-takeover"].As<bool>(false),
   };
 }
 
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text)
+    : data_(std::make_shared<impl::PreparedMessageData>(data, is_text)) {}
+
+std::size_t PreparedMessage::GetSize() const { return data_->payload_size; }
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
  public:
  private:
@@ -67,11 +120,24 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // permessage-deflate state is created on the first use, as many connections
+  // may receive only prepared messages
+  const std::optional<impl::DeflateSettings> deflate_settings_;
+  std::unique_ptr<impl::Deflater> deflater_;
+  std::unique_ptr<impl::Inflater> inflater_;
+  std::string decompressed_;
+
  public:
-  WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
-                          const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+  WebSocketConnectionImpl(
+      std::unique_ptr<engine::io::RwBase> io_,
+      const engine::io::Sockaddr& remote_addr, const Config& server_config,
+      const std::optional<impl::DeflateSettings>& deflate_settings)
+      : io(std::move(io_)),
+        remote_addr_(remote_addr),
+        config(server_config),
+        deflate_settings_(deflate_settings) {
+    frame_.is_deflate_enabled = deflate_settings_.has_value();
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
@@ -81,6 +147,16 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     stats_.msg_sent++;
     stats_.bytes_sent += message.data.size();
 
+    std::string compressed;
+    auto is_compressed = impl::frames::Compressed::kNo;
+    if (deflate_settings_ && message.data.size() > 0 &&
+        (message.opcode == impl::WSOpcodes::kText ||
+         message.opcode == impl::WSOpcodes::kBinary)) {
+      compressed = GetDeflater().Compress(message.data);
+      message.data = MakeBinarySpan(compressed);
+      is_compressed = impl::frames::Compressed::kYes;
+    }
+
     std::unique_lock lock(write_mutex_);
 
     LOG_TRACE() << "Write message " << message.data.size() << " bytes";
@@ -105,19 +181,40 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
                     impl::frames::DataFrameHeader(
                         dataToSend.first(config.fragment_size),
                         message.opcode == impl::WSOpcodes::kText, continuation,
-                        impl::frames::Final::kNo),
+                        impl::frames::Final::kNo, is_compressed),
                     dataToSend.first(config.fragment_size));
         continuation = impl::frames::Continuation::kYes;
+        // RSV1 is set only on the first frame of a message
+        is_compressed = impl::frames::Compressed::kNo;
         dataToSend = dataToSend.last(dataToSend.size() - config.fragment_size);
       }
       SendExactly(*io,
                   impl::frames::DataFrameHeader(
                       dataToSend, message.opcode == impl::WSOpcodes::kText,
-                      continuation, impl::frames::Final::kYes),
+                      continuation, impl::frames::Final::kYes, is_compressed),
                   dataToSend);
     }
   }
 
+  impl::Deflater& GetDeflater() {
+    UASSERT(deflate_settings_);
+    if (!deflater_) {
+      deflater_ = std::make_unique<impl::Deflater>(
+          deflate_settings_->server_max_window_bits,
+          deflate_settings_->server_no_context_takeover);
+    }
+    return *deflater_;
+  }
+
+  impl::Inflater& GetInflater() {
+    UASSERT(deflate_settings_);
+    if (!inflater_) {
+      inflater_ = std::make_unique<impl::Inflater>(
+          deflate_settings_->client_no_context_takeover);
+    }
+    return *inflater_;
+  }
+
   void Send(const Message& message) override {
     MessageExtended mext{
         MakeBinarySpan(message.data),
@@ -136,6 +233,35 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     SendExtended(mext);
   }
 
+  void SendPrepared(const PreparedMessage& message) override {
+    const auto& data = *message.data_;
+    if (deflate_settings_ &&
+        deflate_settings_->server_max_window_bits != impl::kMaxWindowBits) {
+      // The shared frame may refer further than the client window
+      MessageExtended mext{
+          data.GetPayload(),
+          data.is_text ? impl::WSOpcodes::kText : impl::WSOpcodes::kBinary,
+          {}};
+      SendExtended(mext);
+      return;
+    }
+
+    const auto& frame =
+        deflate_settings_ ? data.compressed_frame() : data.frame;
+    if (deflater_ && !deflate_settings_->server_no_context_takeover) {
+      // The client decompresses the shared frame with the context of this
+      // connection, so the next messages may not refer to the data before it
+      deflater_->Reset();
+    }
+
+    stats_.msg_sent++;
+    stats_.bytes_sent += data.payload_size;
+
+    std::unique_lock lock(write_mutex_);
+    LOG_TRACE() << "Write prepared message " << data.payload_size << " bytes";
+    SendExactly(*io, frame, {});
+  }
+
   void Recv(Message& msg) override {
     msg.data.resize(0);  // do not call .clear() to keep the allocated memory
     frame_.payload = &msg.data;
@@ -181,6 +307,19 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          status_raw = GetInflater().Decompress(msg.data, decompressed_,
+                                                config.max_remote_payload);
+          if (status_raw != CloseStatus::kNone) {
+            MessageExtended close_msg{{}, impl::WSOpcodes::kClose, status_raw};
+            SendExtended(close_msg);
+            msg = CloseMessage(status_raw);
+            return;
+          }
+          // keeps the allocated memory of both strings
+          msg.data.swap(decompressed_);
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -223,8 +362,16 @@ WebSocketConnection::~WebSocketConnection() = default;
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             std::nullopt);
+}
+
+std::shared_ptr<WebSocketConnection> impl::MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateSettings>& deflate_settings) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate_settings);
 }
 
 }  // namespace server::websocket
@@ -63,6 +63,18 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
   if (!HandleHandshake(request, response, context)) return "";
 
+  std::optional<impl::DeflateSettings> deflate_settings;
+  if (config_.permessage_deflate) {
+    deflate_settings = impl::NegotiatePermessageDeflate(
+        request.GetHeader(
+            USERVER_NAMESPACE::http::headers::kWebsocketExtensions),
+        config_);
+  }
+  if (deflate_settings) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+                       impl::ToResponseHeader(*deflate_settings));
+  }
+
   response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
   response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
   response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -72,11 +84,12 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
+       deflate_settings,
        this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = impl::MakeWebSocket(std::move(socket), std::move(peer_name),
+                                      config_, deflate_settings);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -112,6 +125,18 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: boolean
+        description: accept permessage-deflate extension offered by clients
+        defaultDescription: false
+    server-no-context-takeover:
+        type: boolean
+        description: compress each sent message independently
+        defaultDescription: false
+    client-no-context-takeover:
+        type: boolean
+        description: require clients to compress each message independently
+        defaultDescription: false
 )");
 }
 
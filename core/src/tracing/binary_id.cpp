@@ -0,0 +1,34 @@
+#include <tracing/binary_id.hpp>
+
+#include <cstring>
+#include <random>
+
+#include <userver/utils/boost_uuid4.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+TraceId GenerateTraceId() {
+  const auto uuid = utils::generators::GenerateBoostUuid();
+
+  TraceId::Bytes bytes;
+  static_assert(sizeof(uuid.data) == std::tuple_size_v<TraceId::Bytes>);
+  std::memcpy(bytes.data(), uuid.data, bytes.size());
+  return TraceId{bytes};
+}
+
+SpanId GenerateSpanId() {
+  std::uniform_int_distribution<std::uint64_t> dist;
+  const auto random_value = dist(utils::DefaultRandom());
+
+  SpanId::Bytes bytes;
+  static_assert(sizeof(random_value) == std::tuple_size_v<SpanId::Bytes>);
+  std::memcpy(bytes.data(), &random_value, bytes.size());
+  return SpanId{bytes};
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// Fixed size trace/span identifier.
+///
+/// Identifiers generated by userver are kept in binary form only and are
+/// formatted as lowercase hex on demand into a caller provided buffer, so
+/// neither creating nor copying them allocates. Identifiers received from the
+/// outside that are not a lowercase hex of the right length are kept verbatim.
+template <std::size_t Size>
+class BinaryId final {
+ public:
+  using Bytes = std::array<std::uint8_t, Size>;
+  using HexBuffer = std::array<char, Size * 2>;
+
+  BinaryId() noexcept = default;
+
+  explicit BinaryId(const Bytes& bytes) noexcept
+      : bytes_(bytes), kind_(Kind::kBinary) {}
+
+  explicit BinaryId(std::string&& id) noexcept {
+    if (id.empty()) return;
+
+    if (ParseHex(id, bytes_)) {
+      kind_ = Kind::kBinary;
+    } else {
+      kind_ = Kind::kString;
+      string_ = std::move(id);
+    }
+  }
+
+  bool IsEmpty() const noexcept { return kind_ == Kind::kEmpty; }
+
+  bool IsBinary() const noexcept { return kind_ == Kind::kBinary; }
+
+  const Bytes& GetBytes() const noexcept {
+    UASSERT(IsBinary());
+    return bytes_;
+  }
+
+  /// Formats the id, `buffer` is used for binary ids and must outlive the
+  /// result.
+  std::string_view Format(HexBuffer& buffer) const noexcept {
+    if (kind_ != Kind::kBinary) return string_;
+
+    static constexpr std::string_view kXdigits = "0123456789abcdef";
+    auto* out = buffer.data();
+    for (const auto byte : bytes_) {
+      *(out++) = kXdigits[byte >> 4];
+      *(out++) = kXdigits[byte & 0xf];
+    }
+    return {buffer.data(), buffer.size()};
+  }
+
+  std::string ToString() const {
+    HexBuffer buffer;
+    return std::string{Format(buffer)};
+  }
+
+ private:
+  enum class Kind : std::uint8_t { kEmpty, kBinary, kString };
+
+  static int FromLowerHexChar(char c) noexcept {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  // Only the canonical lowercase form is accepted, so that Format() returns
+  // exactly what was received.
+  static bool ParseHex(std::string_view id, Bytes& bytes) noexcept {
+    if (id.size() != Size * 2) return false;
+
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto high = FromLowerHexChar(id[i * 2]);
+      const auto low = FromLowerHexChar(id[i * 2 + 1]);
+      if (high < 0 || low < 0) return false;
+      bytes[i] = static_cast<std::uint8_t>((high << 4) | low);
+    }
+    return true;
+  }
+
+  Bytes bytes_{};
+  Kind kind_{Kind::kEmpty};
+  std::string string_;
+};
+
+/// 128-bit trace id, compatible with OpenTelemetry
+using TraceId = BinaryId<16>;
+
+/// 64-bit span id, compatible with OpenTelemetry
+using SpanId = BinaryId<8>;
+
+TraceId GenerateTraceId();
+
+SpanId GenerateSpanId();
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <tracing/binary_id.hpp>
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <tracing/otlp_encoder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kTraceIdHex = "0123456789abcdef0123456789abcdef";
+constexpr std::string_view kSpanIdHex = "fedcba9876543210";
+
+}  // namespace
+
+TEST(TracingBinaryId, Empty) {
+  const tracing::impl::SpanId id;
+  EXPECT_TRUE(id.IsEmpty());
+  EXPECT_FALSE(id.IsBinary());
+  EXPECT_EQ(id.ToString(), "");
+}
+
+TEST(TracingBinaryId, HexRoundtrip) {
+  const tracing::impl::TraceId id{std::string{kTraceIdHex}};
+  ASSERT_TRUE(id.IsBinary());
+  EXPECT_EQ(id.GetBytes()[0], 0x01);
+  EXPECT_EQ(id.GetBytes()[15], 0xef);
+  EXPECT_EQ(id.ToString(), kTraceIdHex);
+
+  tracing::impl::TraceId::HexBuffer buffer;
+  EXPECT_EQ(tracing::impl::TraceId{id.GetBytes()}.Format(buffer), kTraceIdHex);
+}
+
+TEST(TracingBinaryId, KeepsForeignIdsVerbatim) {
+  for (const std::string_view foreign :
+       {"1234567890-trace-id", "0123456789ABCDEF", "0123456789abcde",
+        "0123456789abcdefg"}) {
+    const tracing::impl::SpanId id{std::string{foreign}};
+    EXPECT_FALSE(id.IsEmpty());
+    EXPECT_FALSE(id.IsBinary()) << foreign;
+    EXPECT_EQ(id.ToString(), foreign);
+  }
+}
+
+TEST(TracingBinaryId, Copy) {
+  const tracing::impl::SpanId id{std::string{kSpanIdHex}};
+  const auto copy = id;
+  EXPECT_TRUE(copy.IsBinary());
+  EXPECT_EQ(copy.ToString(), kSpanIdHex);
+}
+
+TEST(TracingBinaryId, Generate) {
+  const auto trace_id = tracing::impl::GenerateTraceId();
+  const auto span_id = tracing::impl::GenerateSpanId();
+  EXPECT_TRUE(trace_id.IsBinary());
+  EXPECT_TRUE(span_id.IsBinary());
+  EXPECT_EQ(trace_id.ToString().size(), 32);
+  EXPECT_EQ(span_id.ToString().size(), 16);
+  EXPECT_NE(span_id.ToString(), tracing::impl::GenerateSpanId().ToString());
+}
+
+TEST(TracingOtlpEncoder, DelimitedRequest) {
+  tracing::impl::ExportedSpan span;
+  span.trace_id = tracing::impl::TraceId{std::string{kTraceIdHex}};
+  span.span_id = tracing::impl::SpanId{std::string{kSpanIdHex}};
+  span.name = "span-name";
+  span.start_time = std::chrono::system_clock::time_point{};
+  span.end_time = span.start_time + std::chrono::milliseconds{1};
+  span.tags.emplace_back("meta_code", 200);
+
+  std::vector<tracing::impl::ExportedSpan> spans;
+  spans.push_back(std::move(span));
+
+  std::string output = "prefix";
+  tracing::impl::otlp::AppendExportRequest(output, "service", spans);
+
+  ASSERT_GT(output.size(), 8);
+  EXPECT_EQ(output.substr(0, 6), "prefix");
+
+  // Varint size of the request and then its single 'resource_spans' field
+  const auto request_size = static_cast<std::uint8_t>(output[6]);
+  ASSERT_LT(request_size, 0x80);
+  EXPECT_EQ(output.size(), 7 + request_size);
+  EXPECT_EQ(output[7], '\x0a');
+
+  EXPECT_NE(output.find("service.name"), std::string::npos);
+  EXPECT_NE(output.find("span-name"), std::string::npos);
+  EXPECT_NE(output.find("meta_code"), std::string::npos);
+
+  // Ids are written in binary form, with the length prefix
+  const std::string trace_id_field =
+      "\x0a\x10\x01\x23\x45\x67\x89\xab\xcd\xef\x01\x23\x45\x67\x89\xab\xcd\xef";
+  EXPECT_NE(output.find(trace_id_field), std::string::npos);
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
 
+namespace {
+
+constexpr std::string_view kSampled = "1";
+constexpr std::string_view kNotSampled = "0";
+
+}  // namespace
+
 bool DefaultTracingManager::TryFillSpanBuilderFromRequest(
     const server::http::HttpRequest& request, SpanBuilder& span_builder) const {
   const auto& trace_id = request.GetHeader(http::headers::kXYaTraceId);
@@ -17,6 +24,13 @@ bool DefaultTracingManager::TryFillSpanBuilderFromRequest(
   const auto& parent_link = request.GetHeader(http::headers::kXYaRequestId);
   if (!parent_link.empty()) span_builder.SetParentLink(parent_link);
 
+  const auto& sampled = request.GetHeader(http::headers::kXYaTraceSampled);
+  if (sampled == kSampled) {
+    span_builder.SetSampled(true);
+  } else if (sampled == kNotSampled) {
+    span_builder.SetSampled(false);
+  }
+
   return true;
 }
 
@@ -26,6 +40,12 @@ void DefaultTracingManager::FillRequestWithTracingContext(
   request.SetHeader(http::headers::kXYaRequestId, span.GetLink());
   request.SetHeader(http::headers::kXYaTraceId, span.GetTraceId());
   request.SetHeader(http::headers::kXYaSpanId, span.GetSpanId());
+
+  const auto sampling_decision = span.GetSamplingDecision();
+  if (sampling_decision) {
+    request.SetHeader(http::headers::kXYaTraceSampled,
+                      *sampling_decision ? kSampled : kNotSampled);
+  }
 }
 
 void DefaultTracingManager::FillResponseWithTracingContext(
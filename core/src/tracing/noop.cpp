@@ -25,9 +25,11 @@ class NoopTracer final : public Tracer {
 
 void NoopTracer::LogSpanContextTo(const Span::Impl& span,
                                   logging::impl::TagWriter writer) const {
-  writer.PutTag(kTraceIdName, span.GetTraceId());
-  writer.PutTag(kSpanIdName, span.GetSpanId());
-  writer.PutTag(kParentIdName, span.GetParentId());
+  impl::TraceId::HexBuffer trace_id_buffer;
+  impl::SpanId::HexBuffer span_id_buffer;
+  writer.PutTag(kTraceIdName, span.GetTraceIdRaw().Format(trace_id_buffer));
+  writer.PutTag(kSpanIdName, span.GetSpanIdRaw().Format(span_id_buffer));
+  writer.PutTag(kParentIdName, span.GetParentIdRaw().Format(span_id_buffer));
 }
 
 tracing::TracerPtr MakeNoopTracer(const std::string& service_name) {
@@ -0,0 +1,256 @@
+#include <tracing/otlp_encoder.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/overloaded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl::otlp {
+
+namespace {
+
+// Field numbers from opentelemetry/proto/{collector/trace,trace,common,resource}
+namespace fields {
+
+constexpr int kRequestResourceSpans = 1;
+
+constexpr int kResourceSpansResource = 1;
+constexpr int kResourceSpansScopeSpans = 2;
+
+constexpr int kResourceAttributes = 1;
+
+constexpr int kScopeSpansScope = 1;
+constexpr int kScopeSpansSpans = 2;
+
+constexpr int kScopeName = 1;
+
+constexpr int kSpanTraceId = 1;
+constexpr int kSpanSpanId = 2;
+constexpr int kSpanParentSpanId = 4;
+constexpr int kSpanName = 5;
+constexpr int kSpanStartTime = 7;
+constexpr int kSpanEndTime = 8;
+constexpr int kSpanAttributes = 9;
+constexpr int kSpanStatus = 15;
+
+constexpr int kStatusCode = 3;
+
+constexpr int kKeyValueKey = 1;
+constexpr int kKeyValueValue = 2;
+
+constexpr int kAnyValueString = 1;
+constexpr int kAnyValueInt = 3;
+constexpr int kAnyValueDouble = 4;
+
+}  // namespace fields
+
+enum WireType : std::uint8_t {
+  kVarint = 0,
+  kFixed64 = 1,
+  kLengthDelimited = 2,
+};
+
+constexpr std::uint64_t kStatusCodeError = 2;
+constexpr std::string_view kServiceNameKey = "service.name";
+constexpr std::string_view kScopeName = "userver";
+
+class ProtoWriter final {
+ public:
+  explicit ProtoWriter(std::string& output) : output_(output) {}
+
+  void Varint(int field, std::uint64_t value) {
+    Tag(field, kVarint);
+    RawVarint(value);
+  }
+
+  void Fixed64(int field, std::uint64_t value) {
+    Tag(field, kFixed64);
+    char buffer[sizeof(value)];
+    for (auto& c : buffer) {
+      c = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    output_.append(buffer, sizeof(buffer));
+  }
+
+  void Double(int field, double value) {
+    std::uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(bits));
+    Fixed64(field, bits);
+  }
+
+  void Bytes(int field, std::string_view value) {
+    Tag(field, kLengthDelimited);
+    RawVarint(value.size());
+    output_.append(value);
+  }
+
+  /// Writes a nested message filled by `func`
+  template <typename Func>
+  void Message(int field, Func&& func) {
+    Tag(field, kLengthDelimited);
+    const auto body_start = output_.size();
+    func();
+    PrependSize(body_start);
+  }
+
+  /// Writes a varint size of everything written since `body_start` before it
+  void PrependSize(std::size_t body_start) {
+    const auto body_size = output_.size() - body_start;
+
+    char buffer[10];
+    std::size_t size = 0;
+    auto value = body_size;
+    do {
+      buffer[size++] =
+          static_cast<char>((value & 0x7f) | (value > 0x7f ? 0x80 : 0));
+      value >>= 7;
+    } while (value != 0);
+
+    output_.insert(body_start, buffer, size);
+  }
+
+ private:
+  void Tag(int field, WireType type) {
+    RawVarint((static_cast<std::uint64_t>(field) << 3) | type);
+  }
+
+  void RawVarint(std::uint64_t value) {
+    while (value > 0x7f) {
+      output_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    output_.push_back(static_cast<char>(value));
+  }
+
+  std::string& output_;
+};
+
+template <std::size_t Size>
+std::string_view ToBytes(const BinaryId<Size>& id,
+                         typename BinaryId<Size>::Bytes& buffer) {
+  if (id.IsEmpty()) return {};
+
+  if (id.IsBinary()) {
+    buffer = id.GetBytes();
+  } else {
+    // OpenTelemetry requires fixed size ids. Ids received from the outside in
+    // some other format are hashed (FNV-1a), so that spans of the same trace
+    // still share the trace id.
+    constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+    std::uint64_t hash = 14695981039346656037ULL;
+    typename BinaryId<Size>::HexBuffer unused;
+    for (const char c : id.Format(unused)) {
+      hash ^= static_cast<std::uint8_t>(c);
+      hash *= kFnvPrime;
+    }
+    for (auto& byte : buffer) {
+      byte = static_cast<std::uint8_t>(hash >> 56);
+      hash *= kFnvPrime;
+    }
+  }
+  return {reinterpret_cast<const char*>(buffer.data()), buffer.size()};
+}
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void WriteAnyValue(ProtoWriter& writer, const logging::LogExtra::Value& value) {
+  std::visit(
+      utils::Overloaded{
+          [&writer](const std::string& v) {
+            writer.Bytes(fields::kAnyValueString, v);
+          },
+          [&writer](float v) { writer.Double(fields::kAnyValueDouble, v); },
+          [&writer](double v) { writer.Double(fields::kAnyValueDouble, v); },
+          [&writer](auto v) {
+            static_assert(std::is_integral_v<decltype(v)>);
+            writer.Varint(fields::kAnyValueInt, static_cast<std::uint64_t>(
+                                                    static_cast<long long>(v)));
+          },
+      },
+      value);
+}
+
+void WriteKeyValue(ProtoWriter& writer, int field, std::string_view key,
+                   const logging::LogExtra::Value& value) {
+  writer.Message(field, [&] {
+    writer.Bytes(fields::kKeyValueKey, key);
+    writer.Message(fields::kKeyValueValue,
+                   [&] { WriteAnyValue(writer, value); });
+  });
+}
+
+bool IsError(const logging::LogExtra::Value& value) {
+  return std::visit(
+      utils::Overloaded{
+          [](const std::string& v) { return v == "true" || v == "1"; },
+          [](auto v) { return v != 0; },
+      },
+      value);
+}
+
+void WriteSpan(ProtoWriter& writer, const ExportedSpan& span) {
+  TraceId::Bytes trace_id;
+  SpanId::Bytes span_id;
+  writer.Bytes(fields::kSpanTraceId, ToBytes(span.trace_id, trace_id));
+  writer.Bytes(fields::kSpanSpanId, ToBytes(span.span_id, span_id));
+  if (!span.parent_id.IsEmpty()) {
+    writer.Bytes(fields::kSpanParentSpanId, ToBytes(span.parent_id, span_id));
+  }
+  writer.Bytes(fields::kSpanName, span.name);
+  writer.Fixed64(fields::kSpanStartTime, ToUnixNano(span.start_time));
+  writer.Fixed64(fields::kSpanEndTime, ToUnixNano(span.end_time));
+
+  bool is_error = false;
+  for (const auto& [key, value] : span.tags) {
+    if (key == kErrorFlag) {
+      is_error = IsError(value);
+      continue;
+    }
+    WriteKeyValue(writer, fields::kSpanAttributes, key, value);
+  }
+
+  if (is_error) {
+    writer.Message(fields::kSpanStatus, [&] {
+      writer.Varint(fields::kStatusCode, kStatusCodeError);
+    });
+  }
+}
+
+}  // namespace
+
+void AppendExportRequest(std::string& output, std::string_view service_name,
+                         const std::vector<ExportedSpan>& spans) {
+  const auto request_start = output.size();
+  ProtoWriter writer{output};
+
+  writer.Message(fields::kRequestResourceSpans, [&] {
+    writer.Message(fields::kResourceSpansResource, [&] {
+      WriteKeyValue(writer, fields::kResourceAttributes, kServiceNameKey,
+                    std::string{service_name});
+    });
+    writer.Message(fields::kResourceSpansScopeSpans, [&] {
+      writer.Message(fields::kScopeSpansScope, [&] {
+        writer.Bytes(fields::kScopeName, kScopeName);
+      });
+      for (const auto& span : spans) {
+        writer.Message(fields::kScopeSpansSpans,
+                       [&] { WriteSpan(writer, span); });
+      }
+    });
+  });
+
+  writer.PrependSize(request_start);
+}
+
+}  // namespace tracing::impl::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tracing/span_exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl::otlp {
+
+/// Appends an opentelemetry.proto.collector.trace.v1.ExportTraceServiceRequest
+/// with all the `spans` to `output`, prefixed with its varint encoded size
+/// (the usual protobuf delimited format).
+void AppendExportRequest(std::string& output, std::string_view service_name,
+                         const std::vector<ExportedSpan>& spans);
+
+}  // namespace tracing::impl::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,266 @@
+#include <userver/tracing/otlp_exporter_component.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <logging/impl/unix_socket_sink.hpp>
+#include <tracing/otlp_encoder.hpp>
+#include <tracing/span_exporter.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+enum class OutputMode { kFile, kUnixSocket };
+
+OutputMode Parse(const yaml_config::YamlConfig& value,
+                 formats::parse::To<OutputMode>) {
+  const auto mode = value.As<std::string>();
+  if (mode == "file") return OutputMode::kFile;
+  if (mode == "unix-socket") return OutputMode::kUnixSocket;
+  throw yaml_config::ParseException(
+      fmt::format("Unknown OTLP exporter mode '{}' at '{}'", mode,
+                  value.GetPath()));
+}
+
+struct ExporterSettings final {
+  std::string path;
+  OutputMode mode{OutputMode::kFile};
+  std::string service_name;
+  std::size_t max_queue_size{0};
+  std::size_t max_batch_size{0};
+  std::chrono::milliseconds flush_period{};
+};
+
+ExporterSettings ParseSettings(const components::ComponentConfig& config) {
+  ExporterSettings settings;
+  settings.path = config["path"].As<std::string>();
+  settings.mode = config["mode"].As<OutputMode>(OutputMode::kFile);
+  settings.service_name =
+      config["service-name"].As<std::string>("unknown_service");
+  settings.max_queue_size = config["max-queue-size"].As<std::size_t>(65536);
+  settings.max_batch_size = config["max-batch-size"].As<std::size_t>(1024);
+  settings.flush_period =
+      config["flush-period"].As<std::chrono::milliseconds>(1000);
+
+  if (settings.max_batch_size == 0) {
+    throw std::runtime_error("'max-batch-size' should be positive");
+  }
+  return settings;
+}
+
+using SpansQueue = concurrent::NonFifoMpscQueue<impl::ExportedSpan>;
+
+}  // namespace
+
+class OtlpExporter::Impl final : public impl::SpanExporter {
+ public:
+  explicit Impl(ExporterSettings&& settings)
+      : settings_(std::move(settings)),
+        queue_(SpansQueue::Create(settings_.max_queue_size)),
+        producer_(queue_->GetMultiProducer()),
+        consumer_(queue_->GetConsumer()) {
+    batch_.reserve(settings_.max_batch_size);
+  }
+
+  void Export(impl::ExportedSpan&& span) noexcept override {
+    if (!producer_.PushNoblock(std::move(span))) {
+      ++dropped_;
+    }
+  }
+
+  void Start(engine::TaskProcessor& fs_task_processor) {
+    task_ = engine::CriticalAsyncNoSpan(fs_task_processor, [this] { Run(); });
+  }
+
+  void Stop() noexcept {
+    if (task_.IsValid()) task_.SyncCancel();
+  }
+
+  void WriteStatistics(utils::statistics::Writer& writer) const {
+    writer["exported"] = exported_.load();
+    writer["dropped"] = dropped_.load();
+    writer["batches"] = batches_.load();
+    writer["errors"] = errors_.load();
+    writer["queue-size"] = queue_->GetSizeApproximate();
+  }
+
+ private:
+  void Run() {
+    while (!engine::current_task::ShouldCancel()) {
+      const auto deadline =
+          engine::Deadline::FromDuration(settings_.flush_period);
+      impl::ExportedSpan span;
+      while (batch_.size() < settings_.max_batch_size &&
+             consumer_.Pop(span, deadline)) {
+        batch_.push_back(std::move(span));
+      }
+      Flush();
+    }
+
+    // Export whatever was finished before the shutdown
+    impl::ExportedSpan span;
+    while (consumer_.PopNoblock(span)) {
+      batch_.push_back(std::move(span));
+      if (batch_.size() >= settings_.max_batch_size) Flush();
+    }
+    Flush();
+  }
+
+  void Flush() {
+    if (batch_.empty()) return;
+
+    buffer_.clear();
+    impl::otlp::AppendExportRequest(buffer_, settings_.service_name, batch_);
+    const auto spans_count = batch_.size();
+    batch_.clear();
+
+    try {
+      Write(buffer_);
+      exported_ += spans_count;
+      ++batches_;
+    } catch (const std::exception& e) {
+      dropped_ += spans_count;
+      ++errors_;
+      LOG_LIMITED_WARNING() << "Failed to export " << spans_count
+                            << " spans to '" << settings_.path << "': " << e;
+    }
+  }
+
+  void Write(std::string_view data) {
+    switch (settings_.mode) {
+      case OutputMode::kFile:
+        if (!file_) {
+          file_ = fs::blocking::FileDescriptor::Open(
+              settings_.path,
+              {fs::blocking::OpenFlag::kWrite,
+               fs::blocking::OpenFlag::kCreateIfNotExists,
+               fs::blocking::OpenFlag::kAppend});
+        }
+        file_->Write(data);
+        return;
+
+      case OutputMode::kUnixSocket:
+        if (!socket_) {
+          socket_.emplace();
+          try {
+            socket_->connect(settings_.path);
+          } catch (const std::exception&) {
+            socket_.reset();
+            throw;
+          }
+        }
+        try {
+          socket_->send(data);
+        } catch (const std::exception&) {
+          // The socket is already closed, reconnect on the next batch
+          socket_.reset();
+          throw;
+        }
+        return;
+    }
+  }
+
+  const ExporterSettings settings_;
+  const std::shared_ptr<SpansQueue> queue_;
+  const SpansQueue::MultiProducer producer_;
+  const SpansQueue::Consumer consumer_;
+
+  std::vector<impl::ExportedSpan> batch_;
+  std::string buffer_;
+  std::optional<fs::blocking::FileDescriptor> file_;
+  std::optional<logging::impl::UnixSocketClient> socket_;
+
+  std::atomic<std::uint64_t> exported_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> batches_{0};
+  std::atomic<std::uint64_t> errors_{0};
+
+  engine::TaskWithResult<void> task_;
+};
+
+OtlpExporter::OtlpExporter(const components::ComponentConfig& config,
+                           const components::ComponentContext& context)
+    : components::LoggableComponentBase(config, context),
+      impl_(std::make_shared<Impl>(ParseSettings(config))) {
+  impl_->Start(context.GetTaskProcessor(
+      config["fs-task-processor"].As<std::string>("fs-task-processor")));
+  impl::SetSpanExporter(impl_);
+
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "tracing.otlp-exporter",
+      [this](utils::statistics::Writer& writer) {
+        impl_->WriteStatistics(writer);
+      });
+}
+
+OtlpExporter::~OtlpExporter() {
+  statistics_holder_.Unregister();
+  impl::SetSpanExporter(nullptr);
+  impl_->Stop();
+}
+
+yaml_config::Schema OtlpExporter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: exports finished spans in the OpenTelemetry protobuf format
+additionalProperties: false
+properties:
+    path:
+        type: string
+        description: path to the output file or to the unix socket
+    mode:
+        type: string
+        description: where to write the batches of spans
+        defaultDescription: file
+        enum:
+          - file
+          - unix-socket
+    service-name:
+        type: string
+        description: value of the 'service.name' resource attribute
+        defaultDescription: unknown_service
+    max-queue-size:
+        type: integer
+        description: max count of spans waiting for the export, spans over the limit are dropped
+        defaultDescription: 65536
+        minimum: 1
+    max-batch-size:
+        type: integer
+        description: max count of spans in a single ExportTraceServiceRequest
+        defaultDescription: 1024
+        minimum: 1
+    flush-period:
+        type: string
+        description: max time a span waits in the queue before being exported
+        defaultDescription: 1s
+    fs-task-processor:
+        type: string
+        description: task processor for the blocking writes
+        defaultDescription: fs-task-processor
+)");
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,190 @@
+#include <tracing/sampling.hpp>
+
+#include <tuple>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+HeadSamplingSettings ParseHeadSampling(const formats::json::Value& value,
+                                       const HeadSamplingSettings& defaults) {
+  HeadSamplingSettings result;
+  result.rate = value["head-sampling-rate"].As<double>(defaults.rate);
+  result.max_per_second = value["max-sampled-traces-per-second"].As<std::size_t>(
+      defaults.max_per_second);
+
+  if (result.rate < 0 || result.rate > 1) {
+    throw std::runtime_error("'head-sampling-rate' should be in [0, 1] range");
+  }
+  return result;
+}
+
+class HeadSampler final {
+ public:
+  explicit HeadSampler(const HeadSamplingSettings& settings)
+      : rate_(settings.rate), budget_(MakeBudget(settings.max_per_second)) {}
+
+  bool Sample() const {
+    if (rate_ <= 0) return false;
+    if (rate_ < 1 && utils::RandRange(1.0) >= rate_) return false;
+    return budget_.Obtain();
+  }
+
+ private:
+  static utils::TokenBucket MakeBudget(std::size_t max_per_second) {
+    if (max_per_second == 0) return utils::TokenBucket::MakeUnbounded();
+
+    using Duration = utils::TokenBucket::Duration;
+    return utils::TokenBucket{
+        max_per_second,
+        {1, std::chrono::duration_cast<Duration>(std::chrono::seconds{1}) /
+                max_per_second}};
+  }
+
+  double rate_;
+  // TokenBucket is thread-safe
+  mutable utils::TokenBucket budget_;
+};
+
+struct Sampler final {
+  Sampler() : head(HeadSamplingSettings{}) {}
+
+  explicit Sampler(const SamplingConfig& config)
+      : head(config.head), tail(config.tail) {
+    for (const auto& [name, settings] : config.handlers) {
+      handlers.emplace(std::piecewise_construct, std::forward_as_tuple(name),
+                       std::forward_as_tuple(settings));
+    }
+  }
+
+  HeadSampler head;
+  utils::impl::TransparentMap<std::string, HeadSampler> handlers;
+  TailSamplingSettings tail;
+};
+
+auto& GlobalSampler() {
+  static rcu::Variable<Sampler> sampler{};
+  return sampler;
+}
+
+}  // namespace
+
+SamplingConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<SamplingConfig>) {
+  SamplingConfig result;
+  result.head = ParseHeadSampling(value, {});
+
+  const auto& handlers = value["handlers"];
+  if (!handlers.IsMissing()) {
+    for (auto it = handlers.begin(); it != handlers.end(); ++it) {
+      result.handlers.emplace(it.GetName(),
+                              ParseHeadSampling(*it, result.head));
+    }
+  }
+
+  const auto& tail = value["tail-sampling"];
+  result.tail.enabled = tail["enabled"].As<bool>(false);
+  result.tail.slow_threshold = std::chrono::milliseconds{
+      tail["slow-threshold-ms"].As<std::int64_t>(
+          result.tail.slow_threshold.count())};
+  result.tail.max_buffered_spans = tail["max-buffered-spans"].As<std::size_t>(
+      result.tail.max_buffered_spans);
+
+  return result;
+}
+
+namespace impl {
+
+TailSamplingBuffer::TailSamplingBuffer(const TailSamplingSettings& settings)
+    : slow_threshold_(settings.slow_threshold),
+      max_records_(settings.max_buffered_spans) {}
+
+void TailSamplingBuffer::Write(logging::impl::LoggerBase& logger,
+                               logging::Level level, std::string_view record) {
+  {
+    std::lock_guard lock{mutex_};
+    switch (state_) {
+      case State::kBuffering:
+        if (records_.size() < max_records_) {
+          records_.emplace_back(level, record);
+        }
+        return;
+      case State::kDropped:
+        return;
+      case State::kKept:
+        break;
+    }
+  }
+
+  logger.Log(level, record);
+}
+
+void TailSamplingBuffer::Finish(logging::impl::LoggerBase& logger,
+                                bool is_slow) {
+  const bool keep = is_slow || is_failed_;
+  std::vector<std::pair<logging::Level, std::string>> records;
+  {
+    std::lock_guard lock{mutex_};
+    if (state_ != State::kBuffering) return;
+    state_ = keep ? State::kKept : State::kDropped;
+    records.swap(records_);
+  }
+
+  if (!keep) return;
+  for (const auto& [level, record] : records) {
+    logger.Log(level, record);
+  }
+}
+
+TailSamplingLogger::TailSamplingLogger(TailSamplingBuffer& buffer,
+                                       logging::impl::LoggerBase& target)
+    : LoggerBase(target.GetFormat()), buffer_(buffer), target_(target) {
+  SetLevel(target.GetLevel());
+}
+
+void TailSamplingLogger::Log(logging::Level level, std::string_view msg) {
+  buffer_.Write(target_, level, msg);
+}
+
+void TailSamplingLogger::PrependCommonTags(
+    logging::impl::TagWriter writer) const {
+  target_.PrependCommonTags(writer);
+}
+
+bool TailSamplingLogger::ShouldLog(logging::Level level) const noexcept {
+  return target_.ShouldLog(level);
+}
+
+void SetSamplingConfig(const SamplingConfig& config) {
+  GlobalSampler().Assign(Sampler{config});
+}
+
+bool MakeHeadSamplingDecision(std::string_view handler_name) {
+  const auto sampler = GlobalSampler().Read();
+
+  const auto* handler_sampler =
+      utils::impl::FindTransparentOrNullptr(sampler->handlers, handler_name);
+  return handler_sampler ? handler_sampler->Sample() : sampler->head.Sample();
+}
+
+std::shared_ptr<TailSamplingBuffer> MakeTailSamplingBuffer() {
+  const auto sampler = GlobalSampler().Read();
+  if (!sampler->tail.enabled) return {};
+  return std::make_shared<TailSamplingBuffer>(sampler->tail);
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
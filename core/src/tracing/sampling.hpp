@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace tracing {
+
+struct HeadSamplingSettings {
+  /// Share of the new traces that are logged, from 0 to 1
+  double rate{1.0};
+  /// Max count of the sampled traces per second, 0 for unlimited
+  std::size_t max_per_second{0};
+};
+
+struct TailSamplingSettings {
+  bool enabled{false};
+  std::chrono::milliseconds slow_threshold{1000};
+  std::size_t max_buffered_spans{1000};
+};
+
+/// Parsed USERVER_TRACING_SAMPLING dynamic config
+struct SamplingConfig {
+  HeadSamplingSettings head;
+  std::unordered_map<std::string, HeadSamplingSettings> handlers;
+  TailSamplingSettings tail;
+};
+
+SamplingConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<SamplingConfig>);
+
+namespace impl {
+
+enum class SamplingDecision : std::uint8_t {
+  /// Spans that are not a part of a handled request, always logged
+  kUndecided,
+  kSampled,
+  kNotSampled,
+};
+
+/// Buffers log records of the spans of a request that was not sampled by
+/// the head sampling, until the request finishes and it is known whether
+/// the request was slow or failed.
+class TailSamplingBuffer final {
+ public:
+  explicit TailSamplingBuffer(const TailSamplingSettings& settings);
+
+  std::chrono::milliseconds GetSlowThreshold() const noexcept {
+    return slow_threshold_;
+  }
+
+  /// Stores the record, or writes it to `logger` if the request was already
+  /// decided to be kept
+  void Write(logging::impl::LoggerBase& logger, logging::Level level,
+             std::string_view record);
+
+  /// Marks the request as failed, so that its spans are kept
+  void MarkFailed() noexcept { is_failed_ = true; }
+
+  /// Writes the buffered records to `logger` if the request was slow or
+  /// failed, drops them otherwise. Records written after this call follow the
+  /// same decision.
+  void Finish(logging::impl::LoggerBase& logger, bool is_slow);
+
+ private:
+  enum class State : std::uint8_t { kBuffering, kKept, kDropped };
+
+  const std::chrono::milliseconds slow_threshold_;
+  const std::size_t max_records_;
+  std::atomic<bool> is_failed_{false};
+  std::mutex mutex_;
+  State state_{State::kBuffering};
+  std::vector<std::pair<logging::Level, std::string>> records_;
+};
+
+/// Logger that redirects all the records into TailSamplingBuffer, formats
+/// them exactly as `target` would.
+class TailSamplingLogger final : public logging::impl::LoggerBase {
+ public:
+  TailSamplingLogger(TailSamplingBuffer& buffer,
+                     logging::impl::LoggerBase& target);
+
+  void Log(logging::Level level, std::string_view msg) override;
+
+  void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+  bool ShouldLog(logging::Level level) const noexcept override;
+
+ private:
+  TailSamplingBuffer& buffer_;
+  logging::impl::LoggerBase& target_;
+};
+
+void SetSamplingConfig(const SamplingConfig& config);
+
+/// Head sampling decision for a new trace started by `handler_name`
+bool MakeHeadSamplingDecision(std::string_view handler_name);
+
+/// @returns buffer for a new not sampled request if tail sampling is enabled
+std::shared_ptr<TailSamplingBuffer> MakeTailSamplingBuffer();
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
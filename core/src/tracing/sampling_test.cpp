@@ -0,0 +1,130 @@
+#include <tracing/sampling.hpp>
+
+#include <logging/logging_test.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class TracingSampling : public LoggingTest {
+ protected:
+  static void SetConfig(std::string_view json) {
+    tracing::impl::SetSamplingConfig(
+        formats::json::FromString(json).As<tracing::SamplingConfig>());
+  }
+
+  ~TracingSampling() override { tracing::impl::SetSamplingConfig({}); }
+
+  static tracing::Span MakeRequestSpan(std::string_view handler_name) {
+    tracing::SpanBuilder builder{"http/request"};
+    builder.MakeSamplingDecision(handler_name);
+    return std::move(builder).Build();
+  }
+};
+
+}  // namespace
+
+TEST(TracingSamplingConfig, Parse) {
+  const auto config = formats::json::FromString(R"({
+    "head-sampling-rate": 0.5,
+    "max-sampled-traces-per-second": 10,
+    "handlers": {"handler-ping": {"head-sampling-rate": 0}},
+    "tail-sampling": {"enabled": true, "slow-threshold-ms": 200}
+  })")
+                          .As<tracing::SamplingConfig>();
+
+  EXPECT_EQ(config.head.rate, 0.5);
+  EXPECT_EQ(config.head.max_per_second, 10);
+  ASSERT_EQ(config.handlers.count("handler-ping"), 1);
+  EXPECT_EQ(config.handlers.at("handler-ping").rate, 0);
+  EXPECT_EQ(config.handlers.at("handler-ping").max_per_second, 10);
+  EXPECT_TRUE(config.tail.enabled);
+  EXPECT_EQ(config.tail.slow_threshold, std::chrono::milliseconds{200});
+  EXPECT_EQ(config.tail.max_buffered_spans, 1000);
+
+  EXPECT_ANY_THROW(formats::json::FromString(R"({"head-sampling-rate": 2})")
+                       .As<tracing::SamplingConfig>());
+}
+
+UTEST_F(TracingSampling, NotSampledIsNotLogged) {
+  SetConfig(R"({"head-sampling-rate": 0})");
+  {
+    auto span = MakeRequestSpan("handler");
+    EXPECT_EQ(span.GetSamplingDecision(), false);
+    EXPECT_FALSE(span.ShouldLogDefault());
+
+    auto child = span.CreateChild("child");
+    EXPECT_EQ(child.GetSamplingDecision(), false);
+  }
+  EXPECT_FALSE(LoggedTextContains("stopwatch_name="));
+
+  {
+    tracing::Span span{"not_a_request"};
+    EXPECT_EQ(span.GetSamplingDecision(), std::nullopt);
+  }
+  EXPECT_TRUE(LoggedTextContains("stopwatch_name=not_a_request"));
+}
+
+UTEST_F(TracingSampling, PerHandlerRateAndBudget) {
+  SetConfig(R"({
+    "head-sampling-rate": 0,
+    "handlers": {"handler-budget": {
+      "head-sampling-rate": 1, "max-sampled-traces-per-second": 1
+    }}
+  })");
+
+  EXPECT_EQ(MakeRequestSpan("handler-other").GetSamplingDecision(), false);
+  EXPECT_EQ(MakeRequestSpan("handler-budget").GetSamplingDecision(), true);
+  EXPECT_EQ(MakeRequestSpan("handler-budget").GetSamplingDecision(), false);
+}
+
+UTEST_F(TracingSampling, ReceivedDecisionWins) {
+  SetConfig(R"({"head-sampling-rate": 0})");
+
+  tracing::SpanBuilder builder{"http/request"};
+  builder.SetSampled(true);
+  builder.MakeSamplingDecision("handler");
+  EXPECT_EQ(std::move(builder).Build().GetSamplingDecision(), true);
+}
+
+UTEST_F(TracingSampling, TailKeepsFailedRequests) {
+  SetConfig(R"({
+    "head-sampling-rate": 0,
+    "tail-sampling": {"enabled": true, "slow-threshold-ms": 100000}
+  })");
+
+  {
+    auto span = MakeRequestSpan("handler");
+    EXPECT_TRUE(span.ShouldLogDefault());
+    { auto child = span.CreateChild("ok_child"); }
+  }
+  EXPECT_FALSE(LoggedTextContains("stopwatch_name="));
+
+  {
+    auto span = MakeRequestSpan("handler");
+    {
+      auto child = span.CreateChild("failed_child");
+      child.AddTag(tracing::kErrorFlag, true);
+    }
+    EXPECT_FALSE(LoggedTextContains("stopwatch_name="));
+  }
+  EXPECT_TRUE(LoggedTextContains("stopwatch_name=failed_child"));
+  EXPECT_TRUE(LoggedTextContains("stopwatch_name=http/request"));
+}
+
+UTEST_F(TracingSampling, TailKeepsSlowRequests) {
+  SetConfig(R"({
+    "head-sampling-rate": 0,
+    "tail-sampling": {"enabled": true, "slow-threshold-ms": 0}
+  })");
+
+  { auto span = MakeRequestSpan("handler"); }
+  EXPECT_TRUE(LoggedTextContains("stopwatch_name=http/request"));
+}
+
+USERVER_NAMESPACE_END
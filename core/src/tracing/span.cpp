@@ -2,19 +2,21 @@
 
 #include <type_traits>
 
+#include <boost/container/small_vector.hpp>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <engine/task/cpu_profiler.hpp>
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <tracing/span_exporter.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/encoding/hex.hpp>
-#include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 #include <utils/internal_tag.hpp>
 
@@ -65,12 +67,23 @@ std::string_view StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
-  std::uniform_int_distribution<std::uint64_t> dist;
-  auto random_value = dist(utils::DefaultRandom());
+// Tags the CPU profiler samples of the current task with its outermost and
+// innermost spans
+void UpdateCpuProfilerTags() noexcept {
+  if (!engine::impl::IsCpuProfilerActive()) return;
 
-  static_assert(sizeof(random_value) == 8);
-  return utils::encoding::ToHex(&random_value, 8);
+  auto* current = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (current == nullptr) return;
+
+  const auto* spans_ptr =
+      current->HasLocalStorage() ? task_local_spans.GetOptional() : nullptr;
+  if (!spans_ptr || spans_ptr->empty()) {
+    engine::impl::SetCurrentCpuProfilerTags(nullptr, nullptr);
+    return;
+  }
+  engine::impl::SetCurrentCpuProfilerTags(
+      engine::impl::InternCpuProfilerName(spans_ptr->front().GetName()),
+      engine::impl::InternCpuProfilerName(spans_ptr->back().GetName()));
 }
 
 }  // namespace
@@ -90,28 +103,82 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
-      span_id_(GenerateSpanId()),
+      trace_id_(parent ? parent->trace_id_ : impl::GenerateTraceId()),
+      span_id_(impl::GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
       source_location_(source_location) {
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    sampling_decision_ = parent->sampling_decision_;
+    tail_sampling_ = parent->tail_sampling_;
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
-    return;
+  const bool is_tail_sampling_slow =
+      is_tail_sampling_root_ &&
+      std::chrono::steady_clock::now() - start_steady_time_ >=
+          tail_sampling_->GetSlowThreshold();
+  if (tail_sampling_ && HasErrorTag()) tail_sampling_->MarkFailed();
+
+  if (ShouldLog()) {
+    auto& logger = logging::GetDefaultLogger();
+    if (sampling_decision_ == impl::SamplingDecision::kNotSampled) {
+      // ShouldLog() guarantees that tail_sampling_ is set
+      impl::TailSamplingLogger tail_sampling_logger{*tail_sampling_, logger};
+      std::move(*this).LogInto(tail_sampling_logger);
+    } else {
+      std::move(*this).LogInto(logger);
+    }
+  }
+
+  if (is_tail_sampling_root_) {
+    tail_sampling_->Finish(logging::GetDefaultLogger(), is_tail_sampling_slow);
+  }
+
+  if (impl::HasSpanExporter() && ShouldExport()) {
+    std::move(*this).Export();
   }
 
-  {
-    const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
-                          source_location_};
-    std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+  if (is_linked() && engine::impl::IsCpuProfilerActive()) {
+    unlink();
+    UpdateCpuProfilerTags();
+  }
+}
+
+void Span::Impl::LogInto(logging::impl::LoggerBase& logger) && {
+  const DetachLocalSpansScope ignore_local_span;
+  logging::LogHelper lh{logger, log_level_, source_location_};
+  std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+}
+
+bool Span::Impl::HasErrorTag() const {
+  const auto is_error = [](const logging::LogExtra& log_extra) {
+    return std::visit(
+        [](const auto& value) {
+          if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
+            return value != 0;
+          } else {
+            return false;
+          }
+        },
+        log_extra.GetValue(kErrorFlag));
+  };
+  return is_error(log_extra_inheritable_) ||
+         (log_extra_local_ && is_error(*log_extra_local_));
+}
+
+void Span::Impl::SetSamplingDecision(bool sampled) {
+  sampling_decision_ = sampled ? impl::SamplingDecision::kSampled
+                               : impl::SamplingDecision::kNotSampled;
+  if (!sampled) {
+    tail_sampling_ = impl::MakeTailSamplingBuffer();
+    is_tail_sampling_root_ = static_cast<bool>(tail_sampling_);
+  } else {
+    tail_sampling_.reset();
+    is_tail_sampling_root_ = false;
   }
 }
 
@@ -144,23 +211,56 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   LogOpenTracing();
 }
 
+void Span::Impl::Export() && {
+  const auto duration = std::chrono::steady_clock::now() - start_steady_time_;
+
+  impl::ExportedSpan exported;
+  exported.trace_id = std::move(trace_id_);
+  exported.span_id = std::move(span_id_);
+  exported.parent_id = std::move(parent_id_);
+  exported.name = name_;
+  exported.start_time = start_system_time_;
+  exported.end_time =
+      start_system_time_ +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          duration);
+
+  // PutIntoLogger() has already merged local tags if the span was logged
+  if (log_extra_local_) {
+    log_extra_inheritable_.Extend(std::move(*log_extra_local_));
+    log_extra_local_.reset();
+  }
+  logging::LogExtra::Map& tags = *log_extra_inheritable_.extra_;
+  exported.tags.reserve(tags.size());
+  for (logging::LogExtra::MapItem& item : tags) {
+    exported.tags.emplace_back(std::move(item.first),
+                               std::move(item.second.GetValue()));
+  }
+
+  impl::ExportSpan(std::move(exported));
+}
+
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
 }
 
-void Span::Impl::DetachFromCoroStack() { unlink(); }
+void Span::Impl::DetachFromCoroStack() {
+  unlink();
+  UpdateCpuProfilerTags();
+}
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
   task_local_spans->push_back(*this);
+  UpdateCpuProfilerTags();
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::SpanId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
-    return parent->GetSpanId();
+    return parent->span_id_;
   }
 
   const auto* spans_ptr = task_local_spans.GetOptional();
@@ -173,9 +273,9 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   // orphaned. It's still possible for chaining to break in case parent span
   // becomes non-loggable after child span is created, but that we can't control
   for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-    if (current->GetParentId().empty() /* won't find better candidate */ ||
+    if (current->parent_id_.IsEmpty() /* won't find better candidate */ ||
         current->ShouldLog()) {
-      return current->GetSpanId();
+      return current->span_id_;
     }
     if (current == spans_ptr->begin()) break;
   };
@@ -183,13 +283,23 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   return {};
 }
 
+bool Span::Impl::ShouldExport() const {
+  // Unlike ShouldLog(), does not depend on the default logger level. Spans
+  // kept by the tail sampling are not exported.
+  return !is_no_log_span_ && log_level_ != logging::Level::kNone &&
+         local_log_level_.value_or(logging::Level::kTrace) <= log_level_ &&
+         sampling_decision_ != impl::SamplingDecision::kNotSampled;
+}
+
 bool Span::Impl::ShouldLog() const {
   /* We must honour default log level, but use span's level from ourselves,
    * not the previous span's.
    */
   return logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
                                         log_level_) &&
-         local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
+         local_log_level_.value_or(logging::Level::kTrace) <= log_level_ &&
+         (sampling_decision_ != impl::SamplingDecision::kNotSampled ||
+          tail_sampling_);
 }
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
@@ -225,7 +335,7 @@ Span::Span(std::string name, ReferenceType reference_type,
                           source_location),
              Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}) {
   AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (pimpl_->parent_id_.IsEmpty()) {
     SetLink(utils::generators::GenerateUuid());
   }
   pimpl_->span_ = this;
@@ -378,6 +488,18 @@ void Span::LogTo(logging::impl::TagWriter writer) const& {
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+std::optional<bool> Span::GetSamplingDecision() const noexcept {
+  switch (pimpl_->GetSamplingDecision()) {
+    case impl::SamplingDecision::kSampled:
+      return true;
+    case impl::SamplingDecision::kNotSampled:
+      return false;
+    case impl::SamplingDecision::kUndecided:
+      break;
+  }
+  return std::nullopt;
+}
+
 void Span::DetachFromCoroStack() {
   if (pimpl_) pimpl_->DetachFromCoroStack();
 }
@@ -388,11 +510,11 @@ std::chrono::system_clock::time_point Span::GetStartSystemTime() const {
   return pimpl_->start_system_time_;
 }
 
-const std::string& Span::GetTraceId() const { return pimpl_->GetTraceId(); }
+std::string Span::GetTraceId() const { return pimpl_->GetTraceId(); }
 
-const std::string& Span::GetSpanId() const { return pimpl_->GetSpanId(); }
+std::string Span::GetSpanId() const { return pimpl_->GetSpanId(); }
 
-const std::string& Span::GetParentId() const { return pimpl_->GetParentId(); }
+std::string Span::GetParentId() const { return pimpl_->GetParentId(); }
 
 ScopeTime::Duration Span::GetTotalDuration(
     const std::string& scope_name) const {
@@ -448,4 +570,12 @@ logging::LogHelper& operator<<(logging::LogHelper& lh,
 
 }  // namespace tracing
 
+namespace engine::impl {
+
+void UpdateCurrentCpuProfilerTags() noexcept {
+  tracing::UpdateCpuProfilerTags();
+}
+
+}  // namespace engine::impl
+
 USERVER_NAMESPACE_END
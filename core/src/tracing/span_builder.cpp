@@ -1,5 +1,6 @@
 #include <userver/tracing/span_builder.hpp>
 
+#include <tracing/sampling.hpp>
 #include <tracing/span_impl.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
@@ -16,7 +17,7 @@ SpanBuilder::SpanBuilder(std::string name,
                           logging::Level::kInfo, location),
              Span::OptionalDeleter{Span::OptionalDeleter::ShouldDelete()}) {
   pimpl_->AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (pimpl_->GetParentIdRaw().IsEmpty()) {
     AddTagFrozen(kLinkTag, utils::generators::GenerateUuid());
   }
 }
@@ -33,7 +34,7 @@ void SpanBuilder::SetTraceId(std::string trace_id) {
   pimpl_->SetTraceId(std::move(trace_id));
 }
 
-const std::string& SpanBuilder::GetTraceId() const noexcept {
+std::string SpanBuilder::GetTraceId() const {
   return pimpl_->GetTraceId();
 }
 
@@ -53,6 +54,17 @@ void SpanBuilder::SetParentLink(std::string parent_link) {
   AddTagFrozen(kParentLinkTag, std::move(parent_link));
 }
 
+void SpanBuilder::SetSampled(bool sampled) {
+  pimpl_->SetSamplingDecision(sampled);
+}
+
+void SpanBuilder::MakeSamplingDecision(std::string_view handler_name) {
+  if (pimpl_->GetSamplingDecision() != impl::SamplingDecision::kUndecided) {
+    return;
+  }
+  pimpl_->SetSamplingDecision(impl::MakeHeadSamplingDecision(handler_name));
+}
+
 Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
 
 }  // namespace tracing
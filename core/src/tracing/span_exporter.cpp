@@ -0,0 +1,40 @@
+#include <tracing/span_exporter.hpp>
+
+#include <atomic>
+
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+std::atomic<bool> has_span_exporter{false};
+
+auto& GlobalSpanExporter() {
+  static rcu::Variable<std::shared_ptr<SpanExporter>> exporter;
+  return exporter;
+}
+
+}  // namespace
+
+SpanExporter::~SpanExporter() = default;
+
+bool HasSpanExporter() noexcept {
+  return has_span_exporter.load(std::memory_order_relaxed);
+}
+
+void ExportSpan(ExportedSpan&& span) noexcept {
+  const auto exporter = GlobalSpanExporter().Read();
+  if (*exporter) (*exporter)->Export(std::move(span));
+}
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+  has_span_exporter = static_cast<bool>(exporter);
+  GlobalSpanExporter().Assign(std::move(exporter));
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
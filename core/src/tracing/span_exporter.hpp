@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/logging/log_extra.hpp>
+
+#include <tracing/binary_id.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// Snapshot of a finished tracing::Span
+struct ExportedSpan final {
+  TraceId trace_id;
+  SpanId span_id;
+  SpanId parent_id;
+  std::string name;
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::system_clock::time_point end_time;
+  std::vector<logging::LogExtra::Pair> tags;
+};
+
+/// Receives all the finished spans, bypassing the logging
+class SpanExporter {
+ public:
+  virtual ~SpanExporter();
+
+  /// Called from the Span destructor, must neither block nor throw
+  virtual void Export(ExportedSpan&& span) noexcept = 0;
+};
+
+/// Cheap check that is done for each span before preparing ExportedSpan
+bool HasSpanExporter() noexcept;
+
+void ExportSpan(ExportedSpan&& span) noexcept;
+
+/// Installs the global span exporter, pass nullptr to uninstall
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
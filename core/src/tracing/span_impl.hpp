@@ -18,6 +18,8 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/binary_id.hpp>
+#include <tracing/sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -45,6 +47,8 @@ class Span::Impl
 
   ~Impl();
 
+  const std::string& GetName() const noexcept { return name_; }
+
   impl::TimeStorage& GetTimeStorage() { return time_storage_; }
   const impl::TimeStorage& GetTimeStorage() const { return time_storage_; }
 
@@ -54,20 +58,34 @@ class Span::Impl
   // Add the context of this Span a non-Span-specific log record
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
+  std::string GetTraceId() const { return trace_id_.ToString(); }
+  std::string GetSpanId() const { return span_id_.ToString(); }
+  std::string GetParentId() const { return parent_id_.ToString(); }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  const impl::TraceId& GetTraceIdRaw() const noexcept { return trace_id_; }
+  const impl::SpanId& GetSpanIdRaw() const noexcept { return span_id_; }
+  const impl::SpanId& GetParentIdRaw() const noexcept { return parent_id_; }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-  void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
-  void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+  void SetTraceId(std::string&& id) noexcept {
+    trace_id_ = impl::TraceId{std::move(id)};
+  }
+  void SetSpanId(std::string&& id) noexcept {
+    span_id_ = impl::SpanId{std::move(id)};
+  }
+  void SetParentId(std::string&& id) noexcept {
+    parent_id_ = impl::SpanId{std::move(id)};
+  }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  impl::SamplingDecision GetSamplingDecision() const noexcept {
+    return sampling_decision_;
+  }
+
+  /// Sets the head sampling decision for the trace of a handled request,
+  /// starts tail sampling for not sampled requests if it is enabled.
+  void SetSamplingDecision(bool sampled);
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
@@ -77,8 +95,14 @@ class Span::Impl
   static void AddOpentracingTags(formats::json::StringBuilder& output,
                                  const logging::LogExtra& input);
 
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  void Export() &&;
+
+  void LogInto(logging::impl::LoggerBase& logger) &&;
+  bool HasErrorTag() const;
+
+  static impl::SpanId GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
+  bool ShouldExport() const;
 
   const std::string name_;
   const bool is_no_log_span_;
@@ -96,12 +120,17 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  impl::TraceId trace_id_;
+  impl::SpanId span_id_;
+  impl::SpanId parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  impl::SamplingDecision sampling_decision_{impl::SamplingDecision::kUndecided};
+  // Set for not sampled requests if tail sampling is enabled
+  std::shared_ptr<impl::TailSamplingBuffer> tail_sampling_;
+  bool is_tail_sampling_root_{false};
+
   friend class Span;
   friend class SpanBuilder;
 };
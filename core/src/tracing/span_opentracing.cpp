@@ -104,9 +104,11 @@ void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
   if (tracer_) {
     writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
-  writer.PutTag(jaeger::kParentId, parent_id_);
-  writer.PutTag(jaeger::kSpanId, span_id_);
+  impl::TraceId::HexBuffer trace_id_buffer;
+  impl::SpanId::HexBuffer span_id_buffer;
+  writer.PutTag(jaeger::kTraceId, trace_id_.Format(trace_id_buffer));
+  writer.PutTag(jaeger::kParentId, parent_id_.Format(span_id_buffer));
+  writer.PutTag(jaeger::kSpanId, span_id_.Format(span_id_buffer));
   writer.PutTag(jaeger::kStartTime, start_time);
   writer.PutTag(jaeger::kStartTimeMillis, start_time / 1000);
   writer.PutTag(jaeger::kDuration, duration_microseconds);
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <tracing/otlp_encoder.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/null_logger.hpp>
 #include <userver/tracing/noop.hpp>
@@ -55,6 +56,55 @@ void tracing_opentracing_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_opentracing_ctr);
 
+void tracing_child_span_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeNoopTracer("test_service");
+    auto parent = tracer->CreateSpanWithoutParent("parent");
+
+    for (auto _ : state)
+      benchmark::DoNotOptimize(parent.CreateChild("name"));
+  });
+}
+BENCHMARK(tracing_child_span_ctr);
+
+void tracing_id_generate(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tracing::impl::GenerateTraceId());
+  }
+}
+BENCHMARK(tracing_id_generate);
+
+void tracing_id_format(benchmark::State& state) {
+  const auto id = tracing::impl::GenerateTraceId();
+  tracing::impl::TraceId::HexBuffer buffer;
+
+  for (auto _ : state) benchmark::DoNotOptimize(id.Format(buffer));
+}
+BENCHMARK(tracing_id_format);
+
+void tracing_otlp_encode(benchmark::State& state) {
+  std::vector<tracing::impl::ExportedSpan> spans(state.range(0));
+  for (auto& span : spans) {
+    span.trace_id = tracing::impl::GenerateTraceId();
+    span.span_id = tracing::impl::GenerateSpanId();
+    span.parent_id = tracing::impl::GenerateSpanId();
+    span.name = "name";
+    span.start_time = std::chrono::system_clock::now();
+    span.end_time = span.start_time;
+    span.tags.emplace_back("meta_code", 200);
+    span.tags.emplace_back("http.url", "http://example.com/example");
+  }
+
+  std::string output;
+  for (auto _ : state) {
+    output.clear();
+    tracing::impl::otlp::AppendExportRequest(output, "test_service", spans);
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * spans.size());
+}
+BENCHMARK(tracing_otlp_encode)->Range(1, 1024);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/async.hpp>
 
+#include <engine/task/task_stats.hpp>
 #include <tracing/span_impl.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/tracing/span.hpp>
@@ -32,6 +33,7 @@ void SpanWrapCall::DoBeforeInvoke() {
   engine::impl::task_local::GetCurrentStorage().InitializeFrom(
       std::move(pimpl_->storage_));
   pimpl_->span_.AttachToCoroStack();
+  engine::impl::SetCurrentTaskStatsName(pimpl_->span_impl_.GetName());
 }
 
 SpanWrapCall::~SpanWrapCall() = default;
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// Count of the operator new calls made by the current thread. Available only
+// in the benchmark binary, that replaces the global operator new.
+std::uint64_t GetThreadAllocationsCount() noexcept;
+
+// Reports the average count of allocations per benchmark iteration as the
+// `allocs` counter
+class AllocationsCounter final {
+ public:
+  explicit AllocationsCounter(benchmark::State& state)
+      : state_(state), start_(GetThreadAllocationsCount()) {}
+
+  AllocationsCounter(const AllocationsCounter&) = delete;
+  AllocationsCounter& operator=(const AllocationsCounter&) = delete;
+
+  ~AllocationsCounter() {
+    state_.counters["allocs"] = benchmark::Counter(
+        static_cast<double>(GetThreadAllocationsCount() - start_),
+        benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  benchmark::State& state_;
+  const std::uint64_t start_;
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
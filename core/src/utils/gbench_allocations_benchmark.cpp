@@ -0,0 +1,36 @@
+#include <utils/gbench_allocations.hpp>
+
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new of the benchmark binary to count the
+// allocations. The other forms of operator new call this one.
+
+namespace {
+
+thread_local std::uint64_t allocations_count = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++allocations_count;
+  if (size == 0) size = 1;
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+std::uint64_t GetThreadAllocationsCount() noexcept {
+  return allocations_count;
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
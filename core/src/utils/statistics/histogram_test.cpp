@@ -0,0 +1,130 @@
+#include <userver/utils/statistics/histogram.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using SmallHistogram = utils::statistics::Histogram<1, 3>;
+
+}  // namespace
+
+TEST(Histogram, BucketLayout) {
+  namespace histogram = utils::statistics::impl::histogram;
+  constexpr std::size_t kPrecisionBits = 2;
+
+  std::size_t prev_index = 0;
+  for (std::uint64_t value = 0; value < (1 << 16); ++value) {
+    const auto index = histogram::GetBucketIndex(value, kPrecisionBits);
+    ASSERT_TRUE(index == prev_index || index == prev_index + 1) << value;
+    prev_index = index;
+
+    const auto upper_bound =
+        histogram::GetBucketUpperBound(index, kPrecisionBits);
+    ASSERT_GE(upper_bound, value);
+    ASSERT_LE(upper_bound - value, value >> kPrecisionBits) << value;
+    if (index != 0) {
+      ASSERT_LT(histogram::GetBucketUpperBound(index - 1, kPrecisionBits),
+                value);
+    }
+  }
+
+  EXPECT_EQ(histogram::GetBucketIndex((1 << 16) - 1, kPrecisionBits) + 1,
+            histogram::GetBucketCount(kPrecisionBits, 16));
+}
+
+TEST(Histogram, Account) {
+  SmallHistogram histogram;
+  EXPECT_EQ(histogram.GetTotalCount(), 0);
+  EXPECT_EQ(histogram.GetPercentile(50), 0);
+
+  histogram.Account(1);
+  histogram.Account(4);
+  histogram.Account(5);
+  histogram.Account(100);
+
+  const auto view = histogram.GetView();
+  ASSERT_EQ(view.GetBucketCount(), 6);
+  const std::uint64_t expected_bounds[] = {0, 1, 2, 3, 5, 7};
+  const std::uint64_t expected_values[] = {0, 1, 0, 0, 2, 0};
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    EXPECT_EQ(view.GetUpperBoundAt(i), expected_bounds[i]);
+    EXPECT_EQ(view.GetValueAt(i), expected_values[i]);
+  }
+  EXPECT_EQ(view.GetValueAtInf(), 1);
+  EXPECT_EQ(view.GetSum(), 110);
+  EXPECT_EQ(view.GetTotalCount(), 4);
+
+  EXPECT_EQ(histogram.GetPercentile(0), 1);
+  EXPECT_EQ(histogram.GetPercentile(50), 5);
+  EXPECT_EQ(histogram.GetPercentile(100), 8);
+}
+
+TEST(Histogram, CopyAddReset) {
+  SmallHistogram first;
+  first.Account(2, 3);
+
+  SmallHistogram second = first;
+  second.Account(6);
+  EXPECT_EQ(second.GetTotalCount(), 4);
+  EXPECT_EQ(first.GetTotalCount(), 3);
+  EXPECT_NE(first.GetView(), second.GetView());
+
+  first.Add(second);
+  EXPECT_EQ(first.GetView().GetValueAt(2), 6);
+  EXPECT_EQ(first.GetView().GetValueAt(5), 1);
+  EXPECT_EQ(first.GetView().GetSum(), 18);
+
+  first.Reset();
+  EXPECT_EQ(first.GetView(), SmallHistogram{}.GetView());
+}
+
+TEST(Histogram, RecentPeriod) {
+  utils::statistics::RecentPeriod<SmallHistogram, SmallHistogram> timings;
+  timings.GetCurrentCounter().Account(1);
+  timings.GetCurrentCounter().Account(3);
+
+  const auto result = timings.GetStatsForPeriod(
+      utils::statistics::RecentPeriod<SmallHistogram,
+                                      SmallHistogram>::Duration::min(),
+      true);
+  EXPECT_EQ(result.GetTotalCount(), 2);
+  EXPECT_EQ(result.GetView().GetSum(), 4);
+}
+
+UTEST(Histogram, Snapshot) {
+  SmallHistogram histogram;
+  histogram.Account(3);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) {
+        writer["hist"] = histogram;
+      });
+
+  const utils::statistics::Snapshot snapshot{storage, "test"};
+  const auto metric = snapshot.SingleMetric("hist");
+  ASSERT_TRUE(metric.IsHistogram());
+  EXPECT_EQ(metric.AsHistogram(), histogram.GetView());
+
+  histogram.Account(3);
+  EXPECT_EQ(metric.AsHistogram().GetValueAt(3), 1);
+}
+
+TEST(Histogram, MetricValue) {
+  SmallHistogram histogram;
+  histogram.Account(3);
+  const utils::statistics::MetricValue metric{histogram.GetView()};
+
+  EXPECT_TRUE(metric.IsHistogram());
+  EXPECT_FALSE(metric.IsRate());
+  EXPECT_THROW(metric.AsInt(), std::exception);
+  // RawType visitors are not given a histogram
+  EXPECT_THROW(metric.Visit([](const auto&) {}), std::exception);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#include <userver/utils/statistics/histogram_view.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+std::uint64_t HistogramView::GetUpperBoundAt(std::size_t index) const {
+  UASSERT(index < bucket_count_);
+  return impl::histogram::GetBucketUpperBound(index, precision_bits_);
+}
+
+std::uint64_t HistogramView::GetValueAt(std::size_t index) const {
+  UASSERT(index < bucket_count_);
+  return values_[index].load(std::memory_order_relaxed);
+}
+
+std::uint64_t HistogramView::GetValueAtInf() const noexcept {
+  return values_[bucket_count_].load(std::memory_order_relaxed);
+}
+
+std::uint64_t HistogramView::GetSum() const noexcept {
+  return values_[bucket_count_ + 1].load(std::memory_order_relaxed);
+}
+
+std::uint64_t HistogramView::GetTotalCount() const noexcept {
+  std::uint64_t total = 0;
+  for (std::size_t i = 0; i <= bucket_count_; ++i) {
+    total += values_[i].load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+bool HistogramView::operator==(const HistogramView& other) const noexcept {
+  if (bucket_count_ != other.bucket_count_ ||
+      precision_bits_ != other.precision_bits_) {
+    return false;
+  }
+  for (std::size_t i = 0; i < bucket_count_ + 2; ++i) {
+    if (values_[i].load(std::memory_order_relaxed) !=
+        other.values_[i].load(std::memory_order_relaxed)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
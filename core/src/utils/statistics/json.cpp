@@ -20,11 +20,16 @@ class JsonFormat final : public utils::statistics::BaseFormatBuilder {
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
     formats::json::ValueBuilder node;
-    value.Visit([&node](const auto& v) { node["value"] = v; });
     node["labels"] = BuildLabels(labels);
-    node["type"] = value.Visit(utils::Overloaded{
-        [](const Rate&) -> std::string_view { return "RATE"; },
-        [](const auto&) -> std::string_view { return "GAUGE"; }});
+    if (value.IsHistogram()) {
+      node["value"] = BuildHistogram(value.AsHistogram());
+      node["type"] = "HIST";
+    } else {
+      value.Visit([&node](const auto& v) { node["value"] = v; });
+      node["type"] = value.Visit(utils::Overloaded{
+          [](const Rate&) -> std::string_view { return "RATE"; },
+          [](const auto&) -> std::string_view { return "GAUGE"; }});
+    }
 
     builder_[std::string{path}].PushBack(std::move(node));
   }
@@ -43,6 +48,22 @@ class JsonFormat final : public utils::statistics::BaseFormatBuilder {
     return result;
   }
 
+  static formats::json::ValueBuilder BuildHistogram(HistogramView histogram) {
+    formats::json::ValueBuilder bounds{formats::common::Type::kArray};
+    formats::json::ValueBuilder buckets{formats::common::Type::kArray};
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      bounds.PushBack(histogram.GetUpperBoundAt(i));
+      buckets.PushBack(histogram.GetValueAt(i));
+    }
+
+    formats::json::ValueBuilder result{formats::common::Type::kObject};
+    result["bounds"] = std::move(bounds);
+    result["buckets"] = std::move(buckets);
+    result["inf"] = histogram.GetValueAtInf();
+    result["sum"] = histogram.GetSum();
+    return result;
+  }
+
   formats::json::ValueBuilder builder_{formats::common::Type::kObject};
 };
 
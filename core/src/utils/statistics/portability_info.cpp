@@ -30,19 +30,21 @@ class PortabilityInfoCollector final
                     const MetricValue& value) override {
     const std::string path{path_view};
 
-    value.Visit([&, this](auto f) {
-      if constexpr (std::is_same_v<decltype(f), double>) {
-        if (std::isinf(f)) {
-          ReportError(info_[WarningCode::kInf], path, labels,
-                      "Value is +/-INF");
+    if (!value.IsHistogram()) {
+      value.Visit([&, this](auto f) {
+        if constexpr (std::is_same_v<decltype(f), double>) {
+          if (std::isinf(f)) {
+            ReportError(info_[WarningCode::kInf], path, labels,
+                        "Value is +/-INF");
+          }
+
+          if (std::isnan(f)) {
+            ReportError(info_[WarningCode::kNan], path, labels,
+                        "Value is +/-NAN");
+          }
         }
-
-        if (std::isnan(f)) {
-          ReportError(info_[WarningCode::kNan], path, labels,
-                      "Value is +/-NAN");
-        }
-      }
-    });
+      });
+    }
 
     static constexpr std::size_t kMaxLabelsPortableValue =
         impl::solomon::kMaxLabels;
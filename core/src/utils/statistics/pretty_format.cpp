@@ -42,9 +42,12 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       }
     }
 
-    const auto type = value.Visit(utils::Overloaded{
-        [](const Rate&) -> std::string_view { return "RATE"; },
-        [](const auto&) -> std::string_view { return "GAUGE"; }});
+    const auto type =
+        value.IsHistogram()
+            ? std::string_view{"HIST"}
+            : value.Visit(utils::Overloaded{
+                  [](const Rate&) -> std::string_view { return "RATE"; },
+                  [](const auto&) -> std::string_view { return "GAUGE"; }});
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("\t{}\t{}\n"), type,
                    value);
   }
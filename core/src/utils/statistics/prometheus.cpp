@@ -2,7 +2,8 @@
 
 #include <algorithm>
 #include <iterator>
-#include <unordered_map>
+#include <optional>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -20,8 +21,12 @@ namespace impl {
 
 namespace {
 
+// Series that were not written for that many serializations are evicted
+constexpr std::uint64_t kEvictAfterGenerations = 16;
+
 enum class Typed { kYes, kNo };
 
+// One-shot formatter that does not cache anything between the calls
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
@@ -29,7 +34,13 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
-    DumpMetricNameAndType(path, value);
+    const auto& name = GetMetricNameAndDumpType(path, value);
+    if (value.IsHistogram()) {
+      DumpHistogram(name, labels, value.AsHistogram());
+      return;
+    }
+
+    buf_.append(name);
     DumpLabels(labels);
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
@@ -37,31 +48,64 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
   std::string Release() { return fmt::to_string(buf_); }
 
  private:
-  void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
+  const std::string& GetMetricNameAndDumpType(std::string_view name,
+                                              const MetricValue& value) {
     if (const auto* const converted =
             utils::impl::FindTransparentOrNullptr(metrics_, name)) {
-      buf_.append(*converted);
-      return;
+      return *converted;
     }
 
     auto prometheus_name = impl::ToPrometheusName(name);
     DumpMetricType(prometheus_name, value);
-    buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+    return metrics_.emplace(name, std::move(prometheus_name)).first->second;
+  }
+
+  // Classic Prometheus histogram: cumulative `_bucket` series with the `le`
+  // label, then `_sum` and `_count`.
+  void DumpHistogram(std::string_view name,
+                     utils::statistics::LabelsSpan labels,
+                     HistogramView histogram) {
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      cumulative += histogram.GetValueAt(i);
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+      const fmt::format_int le{histogram.GetUpperBoundAt(i)};
+      DumpLabels(labels, std::string_view{le.data(), le.size()});
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"),
+                     cumulative);
+    }
+
+    cumulative += histogram.GetValueAtInf();
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+    DumpLabels(labels, "+Inf");
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), cumulative);
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_sum"), name);
+    DumpLabels(labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"),
+                   histogram.GetSum());
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_count"), name);
+    DumpLabels(labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), cumulative);
   }
 
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
                       [[maybe_unused]] const MetricValue& value) {
     if constexpr (IsTyped == Typed::kYes) {
-      const auto type = value.Visit(utils::Overloaded{
-          [](const Rate&) -> std::string_view { return "counter"; },
-          [](const auto&) -> std::string_view { return "gauge"; }});
+      const auto type =
+          value.IsHistogram()
+              ? std::string_view{"histogram"}
+              : value.Visit(utils::Overloaded{
+                    [](const Rate&) -> std::string_view { return "counter"; },
+                    [](const auto&) -> std::string_view { return "gauge"; }});
       fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"),
                      prometheus_name, type);
     }
   }
 
-  void DumpLabels(utils::statistics::LabelsSpan labels) {
+  void DumpLabels(utils::statistics::LabelsSpan labels,
+                  std::string_view histogram_le = {}) {
     buf_.push_back('{');
     bool sep = false;
     for (const auto& label : labels) {
@@ -76,6 +120,13 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       buf_.push_back('"');
       sep = true;
     }
+    if (!histogram_le.empty()) {
+      if (sep) {
+        buf_.push_back(',');
+      }
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""),
+                     histogram_le);
+    }
     buf_.push_back('}');
   }
 
@@ -117,6 +168,211 @@ std::string ToPrometheusLabel(std::string_view name) {
 
 }  // namespace impl
 
+class PrometheusSerializer::Impl final : public BaseFormatBuilder {
+ public:
+  explicit Impl(Settings settings) : settings_(settings) {}
+
+  // `chunks` is nullptr to write the whole output into the buffer
+  void Serialize(const Storage& statistics, const Request& request,
+                 std::size_t chunk_size, std::vector<std::string>* chunks) {
+    ++generation_;
+    buf_.clear();
+    chunk_size_ = chunk_size;
+    chunks_ = chunks;
+
+    statistics.VisitMetrics(*this, request);
+    if (chunks_ && buf_.size() != 0) FlushChunk();
+    chunks_ = nullptr;
+
+    if (generation_ % impl::kEvictAfterGenerations == 0) EvictStaleSeries();
+  }
+
+  std::string_view GetBuffer() const noexcept {
+    return {buf_.data(), buf_.size()};
+  }
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    auto& series = GetSeries(path, labels);
+    const bool seen_in_previous = series.seen_generation + 1 == generation_;
+    series.seen_generation = generation_;
+
+    if (settings_.skip_unchanged && !value.IsHistogram()) {
+      if (seen_in_previous && series.last_value == value) return;
+      series.last_value = value;
+    }
+
+    DumpMetricType(*series.name, value);
+    if (value.IsHistogram()) {
+      DumpHistogram(series, value.AsHistogram());
+    } else {
+      DumpSeriesPrefix(series, {});
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"), value);
+    }
+
+    if (chunks_ && buf_.size() >= chunk_size_) FlushChunk();
+  }
+
+ private:
+  struct Name final {
+    std::string prometheus_name;
+    std::uint64_t type_generation{0};
+  };
+
+  struct Series final {
+    Name* name{nullptr};
+    // `label="value",...` without the braces
+    std::string labels;
+    std::optional<MetricValue> last_value;
+    std::uint64_t seen_generation{0};
+  };
+
+  Series& GetSeries(std::string_view path, LabelsSpan labels) {
+    // Path and labels can not contain '\0', so the key is unambiguous
+    key_.clear();
+    key_.append(path);
+    for (const auto& label : labels) {
+      key_.push_back('\0');
+      key_.append(label.Name());
+      key_.push_back('\0');
+      key_.append(label.Value());
+    }
+
+    if (auto* series = utils::impl::FindTransparentOrNullptr(series_, key_)) {
+      return *series;
+    }
+
+    Series series;
+    series.name = &GetName(path);
+    for (const auto& label : labels) {
+      if (!series.labels.empty()) {
+        series.labels.push_back(',');
+      }
+      series.labels.append(impl::ToPrometheusLabel(label.Name()));
+      series.labels.append("=\"");
+      const auto& value = label.Value();
+      std::replace_copy(value.cbegin(), value.cend(),
+                        std::back_inserter(series.labels), '"', '\'');
+      series.labels.push_back('"');
+    }
+    return series_.emplace(key_, std::move(series)).first->second;
+  }
+
+  Name& GetName(std::string_view path) {
+    if (auto* name = utils::impl::FindTransparentOrNullptr(names_, path)) {
+      return *name;
+    }
+    return names_.emplace(path, Name{impl::ToPrometheusName(path), 0})
+        .first->second;
+  }
+
+  void DumpMetricType(Name& name, const MetricValue& value) {
+    if (!settings_.typed || name.type_generation == generation_) return;
+    name.type_generation = generation_;
+
+    const auto type =
+        value.IsHistogram()
+            ? std::string_view{"histogram"}
+            : value.Visit(utils::Overloaded{
+                  [](const Rate&) -> std::string_view { return "counter"; },
+                  [](const auto&) -> std::string_view { return "gauge"; }});
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"),
+                   name.prometheus_name, type);
+  }
+
+  // Writes `name<suffix>{labels` without the closing brace
+  void DumpSeriesPrefix(const Series& series, std::string_view suffix) {
+    buf_.append(series.name->prometheus_name);
+    buf_.append(suffix);
+    buf_.push_back('{');
+    buf_.append(series.labels);
+  }
+
+  // Classic Prometheus histogram: cumulative `_bucket` series with the `le`
+  // label, then `_sum` and `_count`.
+  void DumpHistogram(const Series& series, HistogramView histogram) {
+    const std::string_view le_separator = series.labels.empty() ? "" : ",";
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      cumulative += histogram.GetValueAt(i);
+      DumpSeriesPrefix(series, "_bucket");
+      fmt::format_to(std::back_inserter(buf_),
+                     FMT_COMPILE("{}le=\"{}\"}} {}\n"), le_separator,
+                     histogram.GetUpperBoundAt(i), cumulative);
+    }
+
+    cumulative += histogram.GetValueAtInf();
+    DumpSeriesPrefix(series, "_bucket");
+    fmt::format_to(std::back_inserter(buf_),
+                   FMT_COMPILE("{}le=\"+Inf\"}} {}\n"), le_separator,
+                   cumulative);
+
+    DumpSeriesPrefix(series, "_sum");
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"),
+                   histogram.GetSum());
+
+    DumpSeriesPrefix(series, "_count");
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"),
+                   cumulative);
+  }
+
+  void FlushChunk() {
+    chunks_->emplace_back(buf_.data(), buf_.size());
+    buf_.clear();
+  }
+
+  void EvictStaleSeries() {
+    for (auto it = series_.begin(); it != series_.end();) {
+      if (it->second.seen_generation + impl::kEvictAfterGenerations <
+          generation_) {
+        it = series_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    // Names are few and cheap, they are kept as long as the serializer lives
+  }
+
+  const Settings settings_;
+  std::uint64_t generation_{0};
+
+  fmt::memory_buffer buf_;
+  std::size_t chunk_size_{0};
+  std::vector<std::string>* chunks_{nullptr};
+
+  std::string key_;
+  utils::impl::TransparentMap<std::string, Name> names_;
+  utils::impl::TransparentMap<std::string, Series> series_;
+};
+
+PrometheusSerializer::PrometheusSerializer()
+    : PrometheusSerializer(Settings{}) {}
+
+PrometheusSerializer::PrometheusSerializer(Settings settings)
+    : impl_(std::make_unique<Impl>(settings)) {}
+
+PrometheusSerializer::PrometheusSerializer(PrometheusSerializer&&) noexcept =
+    default;
+
+PrometheusSerializer& PrometheusSerializer::operator=(
+    PrometheusSerializer&&) noexcept = default;
+
+PrometheusSerializer::~PrometheusSerializer() = default;
+
+std::string_view PrometheusSerializer::Serialize(const Storage& statistics,
+                                                 const Request& request) {
+  impl_->Serialize(statistics, request, 0, nullptr);
+  return impl_->GetBuffer();
+}
+
+std::vector<std::string> PrometheusSerializer::SerializeChunks(
+    const Storage& statistics, const Request& request, std::size_t chunk_size) {
+  std::vector<std::string> chunks;
+  impl_->Serialize(statistics, request, chunk_size, &chunks);
+  return chunks;
+}
+
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request) {
   impl::FormatBuilder<impl::Typed::kYes> builder{};
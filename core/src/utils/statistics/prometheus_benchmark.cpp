@@ -0,0 +1,92 @@
+#include <userver/utils/statistics/prometheus.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSeriesPerMetric = 1000;
+constexpr std::size_t kMetrics = 100;
+
+std::vector<std::string> MakeLabelValues() {
+  std::vector<std::string> result;
+  result.reserve(kSeriesPerMetric);
+  for (std::size_t i = 0; i < kSeriesPerMetric; ++i) {
+    result.push_back("label-value-" + std::to_string(i));
+  }
+  return result;
+}
+
+// kMetrics * kSeriesPerMetric series total
+utils::statistics::Entry RegisterSyntheticWriter(
+    utils::statistics::Storage& storage,
+    const std::vector<std::string>& label_values) {
+  return storage.RegisterWriter(
+      "bench", [&label_values](utils::statistics::Writer& writer) {
+        for (std::size_t metric = 0; metric < kMetrics; ++metric) {
+          auto metric_writer = writer["metric-" + std::to_string(metric)];
+          for (std::size_t i = 0; i < label_values.size(); ++i) {
+            metric_writer.ValueWithLabels(
+                i, {{"instance", "host"}, {"series", label_values[i]}});
+          }
+        }
+      });
+}
+
+void prometheus_format_oneshot(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto label_values = MakeLabelValues();
+    utils::statistics::Storage storage;
+    auto holder = RegisterSyntheticWriter(storage, label_values);
+    const auto request = utils::statistics::Request::MakeWithPrefix({});
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          utils::statistics::ToPrometheusFormat(storage, request));
+    }
+  });
+}
+BENCHMARK(prometheus_format_oneshot)->Unit(benchmark::kMillisecond);
+
+void prometheus_serializer_reused(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto label_values = MakeLabelValues();
+    utils::statistics::Storage storage;
+    auto holder = RegisterSyntheticWriter(storage, label_values);
+    const auto request = utils::statistics::Request::MakeWithPrefix({});
+
+    utils::statistics::PrometheusSerializer serializer;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(serializer.Serialize(storage, request));
+    }
+  });
+}
+BENCHMARK(prometheus_serializer_reused)->Unit(benchmark::kMillisecond);
+
+void prometheus_serializer_chunked(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto label_values = MakeLabelValues();
+    utils::statistics::Storage storage;
+    auto holder = RegisterSyntheticWriter(storage, label_values);
+    const auto request = utils::statistics::Request::MakeWithPrefix({});
+
+    utils::statistics::PrometheusSerializer serializer;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          serializer.SerializeChunks(storage, request, 64 * 1024));
+    }
+  });
+}
+BENCHMARK(prometheus_serializer_chunked)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
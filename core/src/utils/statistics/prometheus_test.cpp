@@ -5,6 +5,7 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
@@ -413,6 +414,78 @@ child{application="processing"} 8
   }
 }
 
+UTEST(MetricsPrometheus, Histogram) {
+  utils::statistics::Histogram<1, 3> histogram;
+  histogram.Account(1);
+  histogram.Account(4);
+  histogram.Account(5);
+  histogram.Account(100);
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "test", [&](Writer& writer) {
+        writer["hist"].ValueWithLabels(histogram, {"label", "value"});
+      });
+
+  constexpr std::string_view expected = R"(
+# TYPE test_hist histogram
+test_hist_bucket{application="processing",label="value",le="0"} 0
+test_hist_bucket{application="processing",label="value",le="1"} 1
+test_hist_bucket{application="processing",label="value",le="2"} 1
+test_hist_bucket{application="processing",label="value",le="3"} 1
+test_hist_bucket{application="processing",label="value",le="5"} 3
+test_hist_bucket{application="processing",label="value",le="7"} 3
+test_hist_bucket{application="processing",label="value",le="+Inf"} 4
+test_hist_sum{application="processing",label="value"} 110
+test_hist_count{application="processing",label="value"} 4
+)";
+  TestToMetricsPrometheus(statistics_storage, expected.substr(1));
+}
+
+UTEST(MetricsPrometheus, SerializerReuse) {
+  int value = 1;
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "test", [&](Writer& writer) {
+        writer["changing"] = value;
+        writer["constant"].ValueWithLabels(42, {"label", "value"});
+      });
+  const auto request = Request::MakeWithPrefix({});
+
+  PrometheusSerializer serializer;
+  EXPECT_EQ(serializer.Serialize(statistics_storage, request),
+            ToPrometheusFormat(statistics_storage, request));
+  value = 2;
+  EXPECT_EQ(serializer.Serialize(statistics_storage, request),
+            ToPrometheusFormat(statistics_storage, request));
+
+  const auto chunks =
+      serializer.SerializeChunks(statistics_storage, request, 1);
+  EXPECT_EQ(chunks.size(), 2);
+  std::string chunked;
+  for (const auto& chunk : chunks) chunked += chunk;
+  EXPECT_EQ(chunked, ToPrometheusFormat(statistics_storage, request));
+}
+
+UTEST(MetricsPrometheus, SerializerSkipUnchanged) {
+  int value = 1;
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "test", [&](Writer& writer) {
+        writer["changing"] = value;
+        writer["constant"] = 42;
+      });
+  const auto request = Request::MakeWithPrefix({});
+
+  PrometheusSerializer serializer{{/*typed=*/false, /*skip_unchanged=*/true}};
+  EXPECT_EQ(serializer.Serialize(statistics_storage, request),
+            "test_changing{} 1\ntest_constant{} 42\n");
+
+  value = 2;
+  EXPECT_EQ(serializer.Serialize(statistics_storage, request),
+            "test_changing{} 2\n");
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
 #include <utils/statistics/solomon_limits.hpp>
@@ -29,6 +30,15 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
     formats::json::StringBuilder::ObjectGuard guard{builder_};
     builder_.Key("labels");
     DumpLabels(path, labels);
+
+    if (value.IsHistogram()) {
+      builder_.Key("hist");
+      DumpHistogram(value.AsHistogram());
+      builder_.Key("type");
+      builder_.WriteString("HIST");
+      return;
+    }
+
     builder_.Key("value");
     value.Visit([this](auto x) { WriteToStream(x, builder_); });
 
@@ -99,6 +109,42 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
     }
   }
 
+  // Adjacent buckets are merged if there are more of them than Solomon allows
+  void DumpHistogram(HistogramView histogram) {
+    const auto bucket_count = histogram.GetBucketCount();
+    const auto merge_count =
+        (bucket_count + impl::solomon::kMaxHistogramBuckets - 1) /
+        impl::solomon::kMaxHistogramBuckets;
+
+    formats::json::StringBuilder::ObjectGuard guard{builder_};
+    builder_.Key("bounds");
+    {
+      formats::json::StringBuilder::ArrayGuard bounds_guard{builder_};
+      for (std::size_t i = merge_count - 1; i < bucket_count; i += merge_count) {
+        WriteToStream(histogram.GetUpperBoundAt(i), builder_);
+      }
+      if (bucket_count % merge_count != 0) {
+        WriteToStream(histogram.GetUpperBoundAt(bucket_count - 1), builder_);
+      }
+    }
+
+    builder_.Key("buckets");
+    {
+      formats::json::StringBuilder::ArrayGuard buckets_guard{builder_};
+      std::uint64_t merged = 0;
+      for (std::size_t i = 0; i < bucket_count; ++i) {
+        merged += histogram.GetValueAt(i);
+        if ((i + 1) % merge_count == 0 || i + 1 == bucket_count) {
+          WriteToStream(merged, builder_);
+          merged = 0;
+        }
+      }
+    }
+
+    builder_.Key("inf");
+    WriteToStream(histogram.GetValueAtInf(), builder_);
+  }
+
   formats::json::StringBuilder& builder_;
 };
 
@@ -15,6 +15,7 @@ inline constexpr std::array<std::string_view, 6> kReservedLabelNames = {
 inline constexpr std::size_t kMaxLabels = 16 - kReservedLabelNames.size() - 1;
 inline constexpr std::size_t kMaxLabelNameLen = 31;
 inline constexpr std::size_t kMaxLabelValueLen = 200;
+inline constexpr std::size_t kMaxHistogramBuckets = 100;
 
 }  // namespace utils::statistics::impl::solomon
 
@@ -3,6 +3,7 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/solomon.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -397,6 +398,52 @@ UTEST(MetricsSolomon, RateMetric) {
   TestToMetricsSolomon(statistics_storage, expected);
 }
 
+UTEST(MetricsSolomon, Histogram) {
+  utils::statistics::Histogram<1, 3> histogram;
+  histogram.Account(1);
+  histogram.Account(4);
+  histogram.Account(5);
+  histogram.Account(100);
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "test", [&](Writer& writer) { writer["hist"] = histogram; });
+
+  const auto* const expected = R"([
+    {
+      "labels": {"sensor": "test.hist"},
+      "hist": {"bounds": [0, 1, 2, 3, 5, 7], "buckets": [0, 1, 0, 0, 2, 0], "inf": 1},
+      "type": "HIST"
+    }
+  ])";
+  TestToMetricsSolomon(statistics_storage, expected);
+}
+
+UTEST(MetricsSolomon, HistogramBucketsLimit) {
+  utils::statistics::Histogram<2, 30> histogram;
+  histogram.Account(0);
+  histogram.Account(1);
+  histogram.Account(1 << 29);
+
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "test", [&](Writer& writer) { writer["hist"] = histogram; });
+
+  const auto result = formats::json::FromString(
+      ToSolomonFormat(statistics_storage, {}))["metrics"][0]["hist"];
+  ASSERT_EQ(result["bounds"].GetSize(), 58);
+  ASSERT_EQ(result["buckets"].GetSize(), 58);
+  EXPECT_EQ(result["bounds"][0].As<int>(), 1);
+  EXPECT_EQ(result["buckets"][0].As<int>(), 2);
+  EXPECT_EQ(result["bounds"][57].As<std::uint64_t>(), (1ULL << 30) - 1);
+
+  std::uint64_t total = 0;
+  for (const auto& bucket : result["buckets"]) {
+    total += bucket.As<std::uint64_t>();
+  }
+  EXPECT_EQ(total, 3);
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
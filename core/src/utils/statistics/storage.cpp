@@ -117,6 +117,7 @@ formats::json::Value Storage::GetAsJson() const {
 
 void Storage::VisitMetrics(BaseFormatBuilder& out,
                            const Request& request) const {
+  bool has_extenders = false;
   {
     impl::WriterState state{out, request, {}, {}};
     for (const auto& [name, value] : request.add_labels) {
@@ -128,6 +129,7 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
     std::shared_lock lock(mutex_);
     for (const auto& entry : metrics_sources_) {
       if (!entry.writer) {
+        has_extenders = true;
         continue;
       }
 
@@ -156,7 +158,10 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
     }
   }
 
-  statistics::VisitMetrics(out, GetAsJson(), request);
+  // Building the JSON of the legacy extenders is costly even if it is empty
+  if (has_extenders) {
+    statistics::VisitMetrics(out, GetAsJson(), request);
+  }
 }
 
 void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
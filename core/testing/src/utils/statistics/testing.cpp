@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
@@ -38,6 +39,8 @@ namespace impl {
 
 struct SnapshotData final {
   std::unordered_multimap<std::string, SnapshotDataEntry> metrics;
+  // Storage for the histogram metrics, HistogramView does not own the data
+  std::vector<std::unique_ptr<std::atomic<std::uint64_t>[]>> histograms;
 };
 
 }  // namespace impl
@@ -54,11 +57,27 @@ class SnapshotVisitor final : public BaseFormatBuilder {
     for (const auto& l : labels) {
       labels_owned.emplace(std::string{l.Name()}, std::string{l.Value()});
     }
-    SnapshotDataEntry entry{std::move(labels_owned), value};
+    SnapshotDataEntry entry{std::move(labels_owned),
+                            value.IsHistogram()
+                                ? MetricValue{CopyHistogram(value.AsHistogram())}
+                                : value};
     data_.metrics.emplace(std::string{path}, std::move(entry));
   }
 
  private:
+  HistogramView CopyHistogram(HistogramView histogram) {
+    const auto bucket_count = histogram.GetBucketCount();
+    auto& values = data_.histograms.emplace_back(
+        std::make_unique<std::atomic<std::uint64_t>[]>(bucket_count + 2));
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      values[i] = histogram.GetValueAt(i);
+    }
+    values[bucket_count] = histogram.GetValueAtInf();
+    values[bucket_count + 1] = histogram.GetSum();
+    return HistogramView{values.get(), bucket_count,
+                         histogram.GetPrecisionBits()};
+  }
+
   impl::SnapshotData& data_;
 };
 
@@ -0,0 +1,572 @@
+#pragma once
+
+/// @file userver/cache/mongo_change_stream_cache.hpp
+/// @brief @copybrief components::MongoChangeStreamCache
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/cache/caching_component_base.hpp>
+#include <userver/cache/mongo_cache_type_traits.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/storages/mongo/options.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+
+enum class ChangeEventType {
+  /// insert, replace or update, the `fullDocument` is looked up
+  kUpsert,
+  kDelete,
+  /// the collection was dropped or renamed, the stream is closed
+  kInvalidate,
+  /// events that do not change the documents, e.g. index creation
+  kOther,
+};
+
+struct ChangeEvent final {
+  ChangeEventType type{ChangeEventType::kOther};
+  /// missing if the document was deleted before the update lookup
+  std::optional<formats::bson::Document> full_document;
+  /// `documentKey._id`
+  formats::bson::Value id;
+  std::optional<formats::bson::Timestamp> cluster_time;
+};
+
+ChangeEvent ParseChangeEvent(const formats::bson::Document& event);
+
+struct ChangeStreamCacheConfig final {
+  std::size_t max_changes_per_update{0};
+  std::chrono::milliseconds max_await_time{0};
+};
+
+ChangeStreamCacheConfig ParseChangeStreamCacheConfig(const ComponentConfig&);
+
+struct ChangeStreamStatistics final {
+  using Counter =
+      USERVER_NAMESPACE::utils::statistics::RelaxedCounter<uint64_t>;
+
+  Counter upserts{};
+  Counter deletes{};
+  Counter invalidations{};
+  Counter resume_failures{};
+  // milliseconds between the last applied event and its application
+  std::atomic<int64_t> lag_ms{0};
+};
+
+void AccountChangeEventLag(ChangeStreamStatistics& stats,
+                           const ChangeEvent& event);
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ChangeStreamStatistics& stats);
+
+USERVER_NAMESPACE::utils::statistics::Entry RegisterChangeStreamStatistics(
+    const ComponentContext& context, const std::string& cache_name,
+    const ChangeStreamStatistics& stats);
+
+void WriteResumeToken(dump::Writer& writer,
+                      const std::optional<formats::bson::Document>& token);
+
+std::optional<formats::bson::Document> ReadResumeToken(dump::Reader& reader);
+
+std::string GetMongoChangeStreamCacheSchema();
+
+template <typename DataType>
+struct ChangeStreamUpdate final {
+  /// nullptr if nothing has changed
+  std::unique_ptr<DataType> data;
+  /// resume token of the stream matching the data
+  std::optional<formats::bson::Document> resume_token;
+};
+
+/// Follows the change stream of a collection for MongoChangeStreamCache,
+/// does not depend on the component system
+template <class MongoCacheTraits>
+class ChangeStreamUpdater final {
+ public:
+  using DataType = typename MongoCacheTraits::DataType;
+
+  ChangeStreamUpdater(storages::mongo::Collection& collection,
+                      ChangeStreamCacheConfig config,
+                      ChangeStreamStatistics& stats);
+
+  /// Opens a new stream and reads the whole collection
+  ChangeStreamUpdate<DataType> UpdateFull(
+      cache::UpdateStatisticsScope& stats_scope);
+
+  /// Applies the events that happened since the previous update to a copy
+  /// of `data`. If the stream is not open, e.g. after the restart, it is
+  /// resumed after `resume_token`.
+  /// @returns std::nullopt if a full update is required
+  std::optional<ChangeStreamUpdate<DataType>> UpdateIncremental(
+      const DataType& data,
+      std::optional<formats::bson::Document> resume_token,
+      cache::UpdateStatisticsScope& stats_scope);
+
+ private:
+  storages::mongo::ChangeStream OpenStream(
+      std::optional<formats::bson::Document> resume_token) const;
+
+  // Returns false if the stream was invalidated
+  bool ApplyEvent(const formats::bson::Document& event_doc, DataType& data,
+                  cache::UpdateStatisticsScope& stats_scope);
+
+  typename MongoCacheTraits::ObjectType DeserializeObject(
+      const formats::bson::Document& doc) const;
+
+  storages::mongo::Collection& collection_;
+  const ChangeStreamCacheConfig config_;
+  ChangeStreamStatistics& stats_;
+  std::optional<storages::mongo::ChangeStream> stream_;
+};
+
+template <class MongoCacheTraits>
+ChangeStreamUpdater<MongoCacheTraits>::ChangeStreamUpdater(
+    storages::mongo::Collection& collection, ChangeStreamCacheConfig config,
+    ChangeStreamStatistics& stats)
+    : collection_(collection), config_(config), stats_(stats) {}
+
+template <class MongoCacheTraits>
+ChangeStreamUpdate<typename MongoCacheTraits::DataType>
+ChangeStreamUpdater<MongoCacheTraits>::UpdateFull(
+    cache::UpdateStatisticsScope& stats_scope) {
+  stream_.reset();
+
+  // The stream is opened before reading the collection, so the changes made
+  // during the read are not lost. Applying them twice is harmless, as the
+  // events carry the current versions of the documents.
+  auto stream = OpenStream(std::nullopt);
+  ChangeStreamUpdate<DataType> result{std::make_unique<DataType>(),
+                                      stream.GetResumeToken()};
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("fetch_and_parse");
+  for (const auto& doc : collection_.Find({})) {
+    stats_scope.IncreaseDocumentsReadCount(1);
+    try {
+      auto object = DeserializeObject(doc);
+      auto key = (object.*MongoCacheTraits::kKeyField);
+      (*result.data)[key] = std::move(object);
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName << ", _id="
+                          << doc["_id"].template ConvertTo<std::string>()
+                          << ", what(): " << e;
+      stats_scope.IncreaseDocumentsParseFailures(1);
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+
+  scope.Reset("apply_changes");
+  for (std::size_t i = 0; i < config_.max_changes_per_update; ++i) {
+    auto event = stream.Next();
+    if (!event) break;
+    if (!ApplyEvent(*event, *result.data, stats_scope)) {
+      throw std::runtime_error(
+          "Change stream was invalidated during the full update of cache " +
+          std::string{MongoCacheTraits::kName});
+    }
+    result.resume_token = stream.GetResumeToken();
+  }
+
+  stream_.emplace(std::move(stream));
+  return result;
+}
+
+template <class MongoCacheTraits>
+std::optional<ChangeStreamUpdate<typename MongoCacheTraits::DataType>>
+ChangeStreamUpdater<MongoCacheTraits>::UpdateIncremental(
+    const DataType& data, std::optional<formats::bson::Document> resume_token,
+    cache::UpdateStatisticsScope& stats_scope) {
+  if (!stream_) {
+    if (!resume_token) return std::nullopt;
+    try {
+      stream_.emplace(OpenStream(std::move(resume_token)));
+    } catch (const storages::mongo::ServerException& e) {
+      LOG_WARNING() << "Failed to resume the change stream of cache "
+                    << MongoCacheTraits::kName << ", doing a full update: "
+                    << e;
+      ++stats_.resume_failures;
+      return std::nullopt;
+    }
+  }
+
+  ChangeStreamUpdate<DataType> result;
+  try {
+    for (std::size_t i = 0; i < config_.max_changes_per_update; ++i) {
+      auto event = stream_->Next();
+      if (!event) break;
+      if (!result.data) {
+        // The data is copied only if there are changes
+        auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+        result.data = std::make_unique<DataType>(data);
+      }
+      if (!ApplyEvent(*event, *result.data, stats_scope)) {
+        stream_.reset();
+        return std::nullopt;
+      }
+      result.resume_token = stream_->GetResumeToken();
+    }
+  } catch (const std::exception&) {
+    // The next update resumes the stream after the last applied event
+    stream_.reset();
+    throw;
+  }
+
+  if (!result.data) stats_.lag_ms = 0;
+  return result;
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream
+ChangeStreamUpdater<MongoCacheTraits>::OpenStream(
+    std::optional<formats::bson::Document> resume_token) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch;
+  watch.SetOption(sm::options::FullDocument::kUpdateLookup);
+  watch.SetOption(sm::options::MaxAwaitTime{config_.max_await_time});
+  if (resume_token) {
+    watch.SetOption(sm::options::ResumeAfter{std::move(*resume_token)});
+  }
+  return collection_.Execute(watch);
+}
+
+template <class MongoCacheTraits>
+bool ChangeStreamUpdater<MongoCacheTraits>::ApplyEvent(
+    const formats::bson::Document& event_doc, DataType& data,
+    cache::UpdateStatisticsScope& stats_scope) {
+  using KeyType = typename MongoCacheTraits::KeyType;
+
+  const auto event = ParseChangeEvent(event_doc);
+  AccountChangeEventLag(stats_, event);
+
+  switch (event.type) {
+    case ChangeEventType::kUpsert:
+      stats_scope.IncreaseDocumentsReadCount(1);
+      ++stats_.upserts;
+      if (!event.full_document) {
+        // deleted after the change, the delete event follows
+        return true;
+      }
+      try {
+        auto object = DeserializeObject(*event.full_document);
+        auto key = (object.*MongoCacheTraits::kKeyField);
+        data[key] = std::move(object);
+      } catch (const std::exception& e) {
+        LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                            << MongoCacheTraits::kName << ", _id="
+                            << event.id.template ConvertTo<std::string>()
+                            << ", what(): " << e;
+        stats_scope.IncreaseDocumentsParseFailures(1);
+
+        if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+      }
+      return true;
+    case ChangeEventType::kDelete:
+      ++stats_.deletes;
+      data.erase(event.id.template As<KeyType>());
+      return true;
+    case ChangeEventType::kInvalidate:
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " was invalidated, doing a full update";
+      ++stats_.invalidations;
+      return false;
+    case ChangeEventType::kOther:
+      return true;
+  }
+
+  UINVARIANT(false, "Unexpected change event type");
+}
+
+template <class MongoCacheTraits>
+typename MongoCacheTraits::ObjectType
+ChangeStreamUpdater<MongoCacheTraits>::DeserializeObject(
+    const formats::bson::Document& doc) const {
+  if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObject(doc);
+  } else {
+    return doc.As<typename MongoCacheTraits::ObjectType>();
+  }
+}
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief %Base class for caches that follow a mongo collection through its
+/// change stream
+///
+/// Unlike components::MongoCache that polls the collection for the documents
+/// with a greater update field, the cache subscribes to the
+/// [change stream](https://www.mongodb.com/docs/manual/changeStreams/) of the
+/// collection. Incremental updates apply the inserts, updates and deletes
+/// that happened since the previous update, so no update field is required
+/// and the deleted documents are removed from the cache.
+///
+/// Full update opens a new change stream and reads the whole collection.
+/// A full update is also done if the stream is invalidated (the collection is
+/// dropped or renamed) or the stream cannot be resumed, e.g. the oplog no
+/// longer contains the resume token.
+///
+/// The resume token is stored in the cache dump along with the data, so an
+/// incremental update resumes the stream after the service restart.
+///
+/// Change streams are available only on replica sets and sharded clusters.
+/// The incremental update type must be allowed.
+///
+/// ## Static options:
+/// All options of CachingComponentBase and
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-changes-per-update | max change events applied in one incremental update, the rest are applied by the next one | 10000
+/// max-await-time | how long an incremental update waits for new events from the server | 100ms
+///
+/// ## Traits example:
+/// All fields below (except for function overrides) are mandatory.
+///
+/// ```
+/// struct MongoChangeStreamCacheTraitsExample {
+///   // Component name for component
+///   static constexpr auto kName = "mongo-dynamic-config";
+///
+///   // Collection to watch
+///   static constexpr auto kMongoCollectionsField =
+///       &storages::mongo::Collections::config;
+///
+///   // Cache element type
+///   using ObjectType = CachedObject;
+///   // Cache element field name that is used as an index in the cache map,
+///   // must hold the `_id` of the document
+///   static constexpr auto kKeyField = &CachedObject::id;
+///   // Type of kKeyField, must be parseable from `_id`
+///   using KeyType = std::string;
+///   // Type of cache map, e.g. unordered_map, map, bimap
+///   using DataType = std::unordered_map<KeyType, ObjectType>;
+///
+///   // Optional function that overrides BSON to ObjectType conversion
+///   static constexpr auto DeserializeObject = &CachedObject::FromBson;
+///   // (default implementation calls doc.As<ObjectType>())
+///   // For using default implementation
+///   static constexpr bool kUseDefaultDeserializeObject = true;
+///
+///   // Whether update part of the cache even if failed to parse some documents
+///   static constexpr bool kAreInvalidDocumentsSkipped = false;
+///
+///   // Component to get the collections
+///   using MongoCollectionsComponent = components::MongoCollections;
+/// };
+/// ```
+///
+/// ## Metrics
+/// Besides the usual cache metrics, `cache.change_stream` metrics are
+/// reported with the `cache_name` label: the counts of applied `upserts` and
+/// `deletes`, stream `invalidations` and `resume_failures`, and the `lag_ms`
+/// between a change in the collection and its application in the cache.
+
+// clang-format on
+
+template <class MongoCacheTraits>
+class MongoChangeStreamCache
+    : public CachingComponentBase<typename MongoCacheTraits::DataType> {
+  using DataType = typename MongoCacheTraits::DataType;
+  using CollectionsType = mongo_cache::impl::CollectionsType<
+      decltype(MongoCacheTraits::kMongoCollectionsField)>;
+
+ public:
+  static constexpr std::string_view kName = MongoCacheTraits::kName;
+
+  MongoChangeStreamCache(const ComponentConfig&, const ComponentContext&);
+
+  ~MongoChangeStreamCache();
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  void WriteContents(dump::Writer& writer,
+                     const DataType& contents) const override;
+
+  std::unique_ptr<const DataType> ReadContents(
+      dump::Reader& reader) const override;
+
+ private:
+  // Resume token of the stream matching the cache data
+  struct ResumeState final {
+    const DataType* data{nullptr};
+    std::optional<formats::bson::Document> token;
+  };
+
+  void Update(cache::UpdateType type,
+              const std::chrono::system_clock::time_point& last_update,
+              const std::chrono::system_clock::time_point& now,
+              cache::UpdateStatisticsScope& stats_scope) override;
+
+  void SetWithToken(impl::ChangeStreamUpdate<DataType>&& update,
+                    cache::UpdateStatisticsScope& stats_scope);
+
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+  const std::shared_ptr<CollectionsType> mongo_collections_;
+  impl::ChangeStreamStatistics change_stream_stats_;
+  impl::ChangeStreamUpdater<MongoCacheTraits> updater_;
+
+  mutable engine::Mutex resume_state_mutex_;
+  mutable ResumeState resume_state_;
+
+  USERVER_NAMESPACE::utils::statistics::Entry statistics_holder_;
+};
+
+template <class MongoCacheTraits>
+inline constexpr bool kHasValidate<MongoChangeStreamCache<MongoCacheTraits>> =
+    true;
+
+template <class MongoCacheTraits>
+MongoChangeStreamCache<MongoCacheTraits>::MongoChangeStreamCache(
+    const ComponentConfig& config, const ComponentContext& context)
+    : CachingComponentBase<DataType>(config, context),
+      mongo_collections_(
+          context
+              .FindComponent<
+                  typename MongoCacheTraits::MongoCollectionsComponent>()
+              .template GetCollectionForLibrary<CollectionsType>()),
+      updater_(
+          mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField,
+          impl::ParseChangeStreamCacheConfig(config), change_stream_stats_) {
+  static_assert(mongo_cache::impl::kHasCollectionsField<MongoCacheTraits>,
+                "Mongo cache traits must specify collections field");
+  static_assert(mongo_cache::impl::kHasKeyField<MongoCacheTraits>,
+                "Mongo cache traits must specify key field");
+  static_assert(mongo_cache::impl::kHasValidDataType<MongoCacheTraits>,
+                "Mongo cache traits must specify mapping data type");
+  static_assert(
+      mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits> ||
+          mongo_cache::impl::kHasDefaultDeserializeObject<MongoCacheTraits>,
+      "Mongo cache traits must specify deserialize object");
+  static_assert(
+      mongo_cache::impl::kHasInvalidDocumentsSkipped<MongoCacheTraits>,
+      "Mongo cache traits must specify validation policy");
+
+  if (this->GetAllowedUpdateTypes() !=
+      cache::AllowedUpdateTypes::kFullAndIncremental) {
+    throw std::logic_error(
+        "Change stream cache '" + components::GetCurrentComponentName(config) +
+        "' requires incremental updates, set 'update-types' to "
+        "'full-and-incremental'");
+  }
+
+  statistics_holder_ = impl::RegisterChangeStreamStatistics(
+      context, this->Name(), change_stream_stats_);
+
+  this->StartPeriodicUpdates();
+}
+
+template <class MongoCacheTraits>
+MongoChangeStreamCache<MongoCacheTraits>::~MongoChangeStreamCache() {
+  statistics_holder_.Unregister();
+  this->StopPeriodicUpdates();
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::Update(
+    cache::UpdateType type, const std::chrono::system_clock::time_point&,
+    const std::chrono::system_clock::time_point&,
+    cache::UpdateStatisticsScope& stats_scope) {
+  if (type == cache::UpdateType::kIncremental) {
+    const auto data = this->Get();
+    auto update =
+        updater_.UpdateIncremental(*data, GetResumeToken(), stats_scope);
+    if (update) {
+      if (!update->data) {
+        stats_scope.FinishNoChanges();
+      } else {
+        SetWithToken(*std::move(update), stats_scope);
+      }
+      return;
+    }
+  }
+  SetWithToken(updater_.UpdateFull(stats_scope), stats_scope);
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::SetWithToken(
+    impl::ChangeStreamUpdate<DataType>&& update,
+    cache::UpdateStatisticsScope& stats_scope) {
+  const auto size = update.data->size();
+  {
+    // Stored before Set: a concurrent dump of the previous data does not
+    // match the pointer and is written without the token
+    std::lock_guard lock(resume_state_mutex_);
+    resume_state_.data = update.data.get();
+    if (update.resume_token) {
+      resume_state_.token = std::move(update.resume_token);
+    }
+  }
+  this->Set(std::move(update.data));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document>
+MongoChangeStreamCache<MongoCacheTraits>::GetResumeToken() const {
+  std::lock_guard lock(resume_state_mutex_);
+  return resume_state_.token;
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer, const DataType& contents) const {
+  std::optional<formats::bson::Document> token;
+  {
+    std::lock_guard lock(resume_state_mutex_);
+    if (resume_state_.data == &contents) token = resume_state_.token;
+  }
+  impl::WriteResumeToken(writer, token);
+  CachingComponentBase<DataType>::WriteContents(writer, contents);
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType>
+MongoChangeStreamCache<MongoCacheTraits>::ReadContents(
+    dump::Reader& reader) const {
+  auto token = impl::ReadResumeToken(reader);
+  auto contents = CachingComponentBase<DataType>::ReadContents(reader);
+
+  std::lock_guard lock(resume_state_mutex_);
+  resume_state_.data = contents.get();
+  resume_state_.token = std::move(token);
+  return contents;
+}
+
+template <class MongoCacheTraits>
+yaml_config::Schema
+MongoChangeStreamCache<MongoCacheTraits>::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<CachingComponentBase<DataType>>(
+      impl::GetMongoChangeStreamCacheSchema());
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Stream of change events of a collection, see
+/// storages::mongo::Collection::Watch
+///
+/// The stream occupies a connection of the pool until destroyed.
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Waits for the next change event for up to options::MaxAwaitTime
+  /// @returns std::nullopt if there were no new events
+  /// @throws MongoException if the stream cannot be continued, e.g. the
+  /// resume token is no longer in the oplog
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event, see options::ResumeAfter
+  /// @returns std::nullopt if the server has not reported it yet
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
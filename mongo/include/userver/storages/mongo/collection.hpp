@@ -11,6 +11,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -124,6 +125,11 @@ class Collection {
   template <typename... Options>
   Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+  /// @brief Opens a change stream of the collection
+  /// @see operations::Watch
+  template <typename... Options>
+  ChangeStream Watch(Options&&... options);
+
   /// @name Prepared operation executors
   /// @{
   size_t Execute(const operations::Count&) const;
@@ -139,6 +145,7 @@ class Collection {
   WriteResult Execute(operations::Bulk&&);
   Cursor Execute(const operations::Aggregate&);
   void Execute(const operations::Drop&);
+  ChangeStream Execute(const operations::Watch&);
   /// @}
  private:
   std::shared_ptr<impl::CollectionImpl> impl_;
@@ -300,6 +307,13 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline,
   return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(Options&&... options) {
+  operations::Watch watch;
+  (watch.SetOption(std::forward<Options>(options)), ...);
+  return Execute(watch);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -334,6 +334,41 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream to watch the changes of the collection
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+/// @note Change streams are only available for replica sets and sharded
+/// clusters.
+class Watch {
+ public:
+  Watch();
+  /// @param pipeline an array of aggregation stages to filter or modify
+  /// the change events
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocument);
+  void SetOption(const options::MaxAwaitTime&);
+  void SetOption(const options::Comment&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
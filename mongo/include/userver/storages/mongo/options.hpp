@@ -283,6 +283,42 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream after the event with the specified token
+/// @see
+/// https://www.mongodb.com/docs/manual/changeStreams/#resume-a-change-stream
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document resume_token)
+      : value_(std::move(resume_token)) {}
+
+  const formats::bson::Document& Value() const { return value_; }
+
+ private:
+  formats::bson::Document value_;
+};
+
+/// @brief Selects the content of `fullDocument` field of change stream update
+/// events
+enum class FullDocument {
+  /// only the changes are reported
+  kDefault,
+  /// the current version of the document is looked up and reported
+  kUpdateLookup,
+};
+
+/// @brief Specifies how long the server waits for new change stream events
+/// before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#include <userver/cache/mongo_change_stream_cache.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/formats/bson/binary.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+constexpr std::size_t kDefaultMaxChangesPerUpdate = 10000;
+constexpr std::chrono::milliseconds kDefaultMaxAwaitTime{100};
+
+ChangeEventType ParseChangeEventType(std::string_view operation_type) {
+  if (operation_type == "insert" || operation_type == "replace" ||
+      operation_type == "update") {
+    return ChangeEventType::kUpsert;
+  }
+  if (operation_type == "delete") return ChangeEventType::kDelete;
+  if (operation_type == "invalidate" || operation_type == "drop" ||
+      operation_type == "rename" || operation_type == "dropDatabase") {
+    // drop and rename are followed by invalidate, do not wait for it
+    return ChangeEventType::kInvalidate;
+  }
+  return ChangeEventType::kOther;
+}
+
+}  // namespace
+
+ChangeEvent ParseChangeEvent(const formats::bson::Document& event) {
+  ChangeEvent result;
+  result.type =
+      ParseChangeEventType(event["operationType"].As<std::string>(""));
+  result.id = event["documentKey"]["_id"];
+
+  const auto full_document = event["fullDocument"];
+  if (!full_document.IsMissing() && !full_document.IsNull()) {
+    result.full_document = full_document;
+  }
+
+  const auto cluster_time = event["clusterTime"];
+  if (!cluster_time.IsMissing()) {
+    result.cluster_time = cluster_time.As<formats::bson::Timestamp>();
+  }
+  return result;
+}
+
+ChangeStreamCacheConfig ParseChangeStreamCacheConfig(
+    const ComponentConfig& config) {
+  ChangeStreamCacheConfig result;
+  result.max_changes_per_update =
+      config["max-changes-per-update"].As<std::size_t>(
+          kDefaultMaxChangesPerUpdate);
+  result.max_await_time =
+      config["max-await-time"].As<std::chrono::milliseconds>(
+          kDefaultMaxAwaitTime);
+
+  if (result.max_changes_per_update == 0) {
+    throw std::logic_error("'max-changes-per-update' of '" +
+                           GetCurrentComponentName(config) +
+                           "' cache must be positive");
+  }
+  return result;
+}
+
+void AccountChangeEventLag(ChangeStreamStatistics& stats,
+                           const ChangeEvent& event) {
+  if (!event.cluster_time) return;
+
+  // clusterTime has a seconds precision
+  const auto event_time = std::chrono::system_clock::from_time_t(
+      event.cluster_time->GetTimestamp());
+  const auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now() - event_time);
+  stats.lag_ms = std::max<int64_t>(lag.count(), 0);
+}
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const ChangeStreamStatistics& stats) {
+  writer["upserts"] = stats.upserts;
+  writer["deletes"] = stats.deletes;
+  writer["invalidations"] = stats.invalidations;
+  writer["resume_failures"] = stats.resume_failures;
+  writer["lag_ms"] = stats.lag_ms.load();
+}
+
+USERVER_NAMESPACE::utils::statistics::Entry RegisterChangeStreamStatistics(
+    const ComponentContext& context, const std::string& cache_name,
+    const ChangeStreamStatistics& stats) {
+  return context.FindComponent<components::StatisticsStorage>()
+      .GetStorage()
+      .RegisterWriter(
+          "cache.change_stream",
+          [&stats](USERVER_NAMESPACE::utils::statistics::Writer& writer) {
+            writer = stats;
+          },
+          {{"cache_name", cache_name}});
+}
+
+void WriteResumeToken(dump::Writer& writer,
+                      const std::optional<formats::bson::Document>& token) {
+  // An empty string stands for no token, the dump is then loaded with a full
+  // update following it
+  writer.Write(token ? formats::bson::ToBinaryString(*token).ToString()
+                     : std::string{});
+}
+
+std::optional<formats::bson::Document> ReadResumeToken(dump::Reader& reader) {
+  const auto binary = reader.Read<std::string>();
+  if (binary.empty()) return std::nullopt;
+  return formats::bson::FromBinaryString(binary);
+}
+
+std::string GetMongoChangeStreamCacheSchema() {
+  return R"(
+type: object
+description: Base class for caches following mongo collection change stream
+additionalProperties: false
+properties:
+    max-changes-per-update:
+        type: integer
+        description: max change events applied in one incremental update
+        defaultDescription: 10000
+        minimum: 1
+    max-await-time:
+        type: string
+        description: how long an incremental update waits for new events
+        defaultDescription: 100ms
+)";
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
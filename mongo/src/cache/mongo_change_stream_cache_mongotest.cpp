@@ -0,0 +1,243 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <optional>
+#include <unordered_map>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/cache/mongo_change_stream_cache.hpp>
+#include <userver/cache/statistics_mock.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+struct Item {
+  int id{0};
+  int x{0};
+
+  bool operator==(const Item& other) const {
+    return id == other.id && x == other.x;
+  }
+};
+
+Item ParseItem(const bson::Document& doc) {
+  return {doc["_id"].As<int>(), doc["x"].As<int>()};
+}
+
+struct ChangeStreamTraits {
+  static constexpr std::string_view kName = "change-stream-test-cache";
+
+  using ObjectType = Item;
+  static constexpr auto kKeyField = &Item::id;
+  using KeyType = int;
+  using DataType = std::unordered_map<KeyType, ObjectType>;
+
+  static constexpr auto DeserializeObject = &ParseItem;
+  static constexpr bool kAreInvalidDocumentsSkipped = false;
+};
+
+using Updater = components::impl::ChangeStreamUpdater<ChangeStreamTraits>;
+using Data = ChangeStreamTraits::DataType;
+
+constexpr std::chrono::milliseconds kMaxAwaitTime{100};
+constexpr std::size_t kMaxAttempts = 50;
+
+components::impl::ChangeStreamCacheConfig MakeConfig(
+    std::size_t max_changes_per_update = 100) {
+  return {max_changes_per_update, kMaxAwaitTime};
+}
+
+class MongoChangeStreamCache : public MongoPoolFixture {
+ protected:
+  // Change streams are supported on replica sets only
+  static std::optional<components::impl::ChangeStreamUpdate<Data>>
+  TryUpdateFull(Updater& updater) {
+    cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kFull);
+    try {
+      return updater.UpdateFull(scope.GetScope());
+    } catch (const mongo::ServerException&) {
+      return std::nullopt;
+    }
+  }
+
+  // Applies the incremental updates until `expected` is reached, the events
+  // may arrive with a delay
+  static Data UpdateUntil(Updater& updater, Data data, const Data& expected) {
+    for (std::size_t i = 0; i < kMaxAttempts && data != expected; ++i) {
+      cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+      auto update = updater.UpdateIncremental(data, std::nullopt,
+                                              scope.GetScope());
+      if (!update) ADD_FAILURE() << "Unexpected full update";
+      if (!update || !update->data) continue;
+      EXPECT_TRUE(update->resume_token);
+      data = std::move(*update->data);
+    }
+    return data;
+  }
+};
+
+}  // namespace
+
+UTEST_F(MongoChangeStreamCache, FullAndIncremental) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_cache");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+  coll.InsertOne(bson::MakeDoc("_id", 2, "x", 2));
+
+  components::impl::ChangeStreamStatistics stats;
+  Updater updater{coll, MakeConfig(), stats};
+  auto full = TryUpdateFull(updater);
+  if (!full) GTEST_SKIP() << "Change streams are not supported";
+
+  ASSERT_TRUE(full->data);
+  EXPECT_EQ(*full->data, (Data{{1, {1, 1}}, {2, {2, 2}}}));
+
+  coll.InsertOne(bson::MakeDoc("_id", 3, "x", 3));
+  coll.UpdateOne(bson::MakeDoc("_id", 1),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 10)));
+  coll.DeleteOne(bson::MakeDoc("_id", 2));
+
+  const Data expected{{1, {1, 10}}, {3, {3, 3}}};
+  const auto data = UpdateUntil(updater, *full->data, expected);
+  EXPECT_EQ(data, expected);
+  EXPECT_EQ(stats.upserts.Load(), 2);
+  EXPECT_EQ(stats.deletes.Load(), 1);
+  EXPECT_EQ(stats.invalidations.Load(), 0);
+  EXPECT_GE(stats.lag_ms.load(), 0);
+
+  // No changes, the data is not copied
+  cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+  const auto update =
+      updater.UpdateIncremental(data, std::nullopt, scope.GetScope());
+  ASSERT_TRUE(update);
+  EXPECT_FALSE(update->data);
+  EXPECT_EQ(stats.lag_ms.load(), 0);
+}
+
+UTEST_F(MongoChangeStreamCache, ChangesPerUpdateLimit) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_cache_limit");
+
+  components::impl::ChangeStreamStatistics stats;
+  Updater updater{coll, MakeConfig(2), stats};
+  auto full = TryUpdateFull(updater);
+  if (!full) GTEST_SKIP() << "Change streams are not supported";
+  EXPECT_TRUE(full->data->empty());
+
+  for (int i = 1; i <= 5; ++i) coll.InsertOne(bson::MakeDoc("_id", i, "x", i));
+
+  Data data;
+  std::size_t updates = 0;
+  for (std::size_t i = 0; i < kMaxAttempts && data.size() < 5; ++i) {
+    cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+    auto update =
+        updater.UpdateIncremental(data, std::nullopt, scope.GetScope());
+    ASSERT_TRUE(update);
+    if (!update->data) continue;
+    // at most 2 events are applied at once
+    EXPECT_LE(update->data->size(), data.size() + 2);
+    data = std::move(*update->data);
+    ++updates;
+  }
+  EXPECT_EQ(data.size(), 5);
+  EXPECT_GE(updates, 3);
+}
+
+UTEST_F(MongoChangeStreamCache, Invalidation) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_cache_drop");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+
+  components::impl::ChangeStreamStatistics stats;
+  Updater updater{coll, MakeConfig(), stats};
+  auto full = TryUpdateFull(updater);
+  if (!full) GTEST_SKIP() << "Change streams are not supported";
+
+  coll.Drop();
+
+  bool full_update_required = false;
+  for (std::size_t i = 0; i < kMaxAttempts && !full_update_required; ++i) {
+    cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+    full_update_required =
+        !updater.UpdateIncremental(*full->data, std::nullopt, scope.GetScope());
+  }
+  EXPECT_TRUE(full_update_required);
+  EXPECT_EQ(stats.invalidations.Load(), 1);
+
+  // The full update starts a new stream
+  coll.InsertOne(bson::MakeDoc("_id", 2, "x", 2));
+  full = TryUpdateFull(updater);
+  ASSERT_TRUE(full);
+  EXPECT_EQ(*full->data, (Data{{2, {2, 2}}}));
+
+  coll.InsertOne(bson::MakeDoc("_id", 3, "x", 3));
+  const Data expected{{2, {2, 2}}, {3, {3, 3}}};
+  EXPECT_EQ(UpdateUntil(updater, *full->data, expected), expected);
+}
+
+UTEST_F(MongoChangeStreamCache, ResumeFromDump) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_cache_resume");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+
+  components::impl::ChangeStreamStatistics stats;
+  Data data;
+  std::string dump;
+  {
+    Updater updater{coll, MakeConfig(), stats};
+    auto full = TryUpdateFull(updater);
+    if (!full) GTEST_SKIP() << "Change streams are not supported";
+    ASSERT_TRUE(full->resume_token);
+
+    data = std::move(*full->data);
+    dump::MockWriter writer;
+    components::impl::WriteResumeToken(writer, full->resume_token);
+    dump = std::move(writer).Extract();
+  }
+
+  // Changes made while the service is down
+  coll.InsertOne(bson::MakeDoc("_id", 2, "x", 2));
+
+  dump::MockReader reader(std::move(dump));
+  auto token = components::impl::ReadResumeToken(reader);
+  reader.Finish();
+  ASSERT_TRUE(token);
+
+  Updater restarted{coll, MakeConfig(), stats};
+  const Data expected{{1, {1, 1}}, {2, {2, 2}}};
+  for (std::size_t i = 0; i < kMaxAttempts && data != expected; ++i) {
+    cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+    auto update = restarted.UpdateIncremental(data, token, scope.GetScope());
+    ASSERT_TRUE(update);
+    if (update->data) data = std::move(*update->data);
+  }
+  EXPECT_EQ(data, expected);
+  EXPECT_EQ(stats.resume_failures.Load(), 0);
+
+  // Without a token the restarted cache needs a full update
+  Updater without_token{coll, MakeConfig(), stats};
+  cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+  EXPECT_FALSE(
+      without_token.UpdateIncremental(data, std::nullopt, scope.GetScope()));
+}
+
+UTEST_F(MongoChangeStreamCache, ResumeFailure) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_cache_failure");
+
+  components::impl::ChangeStreamStatistics stats;
+  Updater updater{coll, MakeConfig(), stats};
+  if (!TryUpdateFull(updater)) {
+    GTEST_SKIP() << "Change streams are not supported";
+  }
+
+  Updater restarted{coll, MakeConfig(), stats};
+  cache::UpdateStatisticsScopeMock scope(cache::UpdateType::kIncremental);
+  EXPECT_FALSE(restarted.UpdateIncremental(
+      {}, bson::MakeDoc("_data", "not a resume token"), scope.GetScope()));
+  EXPECT_EQ(stats.resume_failures.Load(), 1);
+}
+
+USERVER_NAMESPACE_END
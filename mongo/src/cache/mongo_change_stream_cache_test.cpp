@@ -0,0 +1,142 @@
+#include <userver/cache/mongo_change_stream_cache.hpp>
+
+#include <chrono>
+#include <ctime>
+
+#include <userver/dump/operations_mock.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+using components::impl::ChangeEventType;
+
+namespace {
+
+bson::Timestamp SecondsAgo(std::time_t seconds) {
+  return {static_cast<std::uint32_t>(std::time(nullptr) - seconds), 1};
+}
+
+}  // namespace
+
+TEST(MongoChangeStreamCache, ParseInsert) {
+  const auto event = components::impl::ParseChangeEvent(bson::MakeDoc(
+      "operationType", "insert", "documentKey", bson::MakeDoc("_id", 1),
+      "fullDocument", bson::MakeDoc("_id", 1, "x", 2), "clusterTime",
+      bson::Timestamp{100, 1}));
+
+  EXPECT_EQ(event.type, ChangeEventType::kUpsert);
+  EXPECT_EQ(event.id.As<int>(), 1);
+  ASSERT_TRUE(event.full_document);
+  EXPECT_EQ((*event.full_document)["x"].As<int>(), 2);
+  ASSERT_TRUE(event.cluster_time);
+  EXPECT_EQ(event.cluster_time->GetTimestamp(), 100);
+}
+
+TEST(MongoChangeStreamCache, ParseUpserts) {
+  for (const auto* operation : {"insert", "replace", "update"}) {
+    const auto event = components::impl::ParseChangeEvent(bson::MakeDoc(
+        "operationType", operation, "documentKey", bson::MakeDoc("_id", 1)));
+    EXPECT_EQ(event.type, ChangeEventType::kUpsert) << operation;
+    EXPECT_FALSE(event.cluster_time);
+  }
+}
+
+TEST(MongoChangeStreamCache, ParseUpdateOfDeletedDocument) {
+  // The update lookup finds nothing if the document is already deleted
+  const auto event = components::impl::ParseChangeEvent(
+      bson::MakeDoc("operationType", "update", "documentKey",
+                    bson::MakeDoc("_id", "a"), "fullDocument", nullptr));
+
+  EXPECT_EQ(event.type, ChangeEventType::kUpsert);
+  EXPECT_EQ(event.id.As<std::string>(), "a");
+  EXPECT_FALSE(event.full_document);
+}
+
+TEST(MongoChangeStreamCache, ParseDelete) {
+  const auto event = components::impl::ParseChangeEvent(bson::MakeDoc(
+      "operationType", "delete", "documentKey", bson::MakeDoc("_id", 3)));
+
+  EXPECT_EQ(event.type, ChangeEventType::kDelete);
+  EXPECT_EQ(event.id.As<int>(), 3);
+  EXPECT_FALSE(event.full_document);
+}
+
+TEST(MongoChangeStreamCache, ParseInvalidation) {
+  for (const auto* operation :
+       {"invalidate", "drop", "rename", "dropDatabase"}) {
+    const auto event = components::impl::ParseChangeEvent(
+        bson::MakeDoc("operationType", operation));
+    EXPECT_EQ(event.type, ChangeEventType::kInvalidate) << operation;
+    EXPECT_TRUE(event.id.IsMissing());
+  }
+}
+
+TEST(MongoChangeStreamCache, ParseOther) {
+  EXPECT_EQ(components::impl::ParseChangeEvent(
+                bson::MakeDoc("operationType", "createIndexes"))
+                .type,
+            ChangeEventType::kOther);
+  EXPECT_EQ(components::impl::ParseChangeEvent(bson::MakeDoc()).type,
+            ChangeEventType::kOther);
+}
+
+TEST(MongoChangeStreamCache, Lag) {
+  components::impl::ChangeStreamStatistics stats;
+
+  components::impl::ChangeEvent event;
+  event.cluster_time = SecondsAgo(10);
+  components::impl::AccountChangeEventLag(stats, event);
+  EXPECT_GE(stats.lag_ms.load(), 9000);
+  EXPECT_LT(stats.lag_ms.load(), 60000);
+
+  // the events without clusterTime do not change the lag
+  components::impl::AccountChangeEventLag(stats,
+                                          components::impl::ChangeEvent{});
+  EXPECT_GE(stats.lag_ms.load(), 9000);
+
+  // clocks of the servers may be ahead
+  event.cluster_time = SecondsAgo(-10);
+  components::impl::AccountChangeEventLag(stats, event);
+  EXPECT_EQ(stats.lag_ms.load(), 0);
+}
+
+UTEST(MongoChangeStreamCache, Metrics) {
+  components::impl::ChangeStreamStatistics stats;
+  ++stats.upserts;
+  ++stats.upserts;
+  ++stats.deletes;
+  stats.lag_ms = 42;
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "cache.change_stream",
+      [&stats](utils::statistics::Writer& writer) { writer = stats; });
+
+  const utils::statistics::Snapshot snapshot{storage, "cache.change_stream"};
+  EXPECT_EQ(snapshot.SingleMetric("upserts").AsInt(), 2);
+  EXPECT_EQ(snapshot.SingleMetric("deletes").AsInt(), 1);
+  EXPECT_EQ(snapshot.SingleMetric("invalidations").AsInt(), 0);
+  EXPECT_EQ(snapshot.SingleMetric("resume_failures").AsInt(), 0);
+  EXPECT_EQ(snapshot.SingleMetric("lag_ms").AsInt(), 42);
+}
+
+TEST(MongoChangeStreamCache, ResumeTokenDump) {
+  const auto token = bson::MakeDoc("_data", "8263a0c1f2000000012b");
+
+  dump::MockWriter writer;
+  components::impl::WriteResumeToken(writer, token);
+  components::impl::WriteResumeToken(writer, std::nullopt);
+
+  dump::MockReader reader(std::move(writer).Extract());
+  const auto read_token = components::impl::ReadResumeToken(reader);
+  ASSERT_TRUE(read_token);
+  EXPECT_EQ(*read_token, token);
+  EXPECT_FALSE(components::impl::ReadResumeToken(reader));
+  reader.Finish();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+namespace {
+
+formats::bson::Document CopyDocument(const bson_t* native) {
+  return formats::bson::Document(
+      formats::bson::impl::MutableBson::CopyNative(native).Extract());
+}
+
+}  // namespace
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream,
+    std::shared_ptr<stats::OperationStatisticsItem> watch_stats)
+    : client_(std::move(client)),
+      stream_(std::move(stream)),
+      watch_stats_(std::move(watch_stats)) {
+  UASSERT(client_ && stream_);
+
+  // The initial aggregate is sent on creation
+  stats::OperationStopwatch stopwatch(watch_stats_, "watch");
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+  // Only errors are accounted, the timings would mostly show the waiting
+  // for new events
+  stats::OperationStopwatch stopwatch(watch_stats_, "watch");
+
+  const bson_t* event_bson = nullptr;
+  if (mongoc_change_stream_next(stream_.get(), &event_bson)) {
+    stopwatch.Discard();
+    return CopyDocument(event_bson);
+  }
+
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error iterating over change stream");
+  }
+  stopwatch.Discard();
+  return std::nullopt;
+}
+
+std::optional<formats::bson::Document>
+CDriverChangeStreamImpl::GetResumeToken() const {
+  const bson_t* token = mongoc_change_stream_get_resume_token(stream_.get());
+  if (!token) return std::nullopt;
+  return CopyDocument(token);
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
@@ -41,6 +41,7 @@ class CDriverCollectionImpl : public CollectionImpl {
   WriteResult Execute(operations::Bulk&&) override;
   Cursor Execute(const operations::Aggregate&) override;
   void Execute(const operations::Drop&) override;
+  ChangeStream Execute(const operations::Watch&) override;
 
  private:
   cdriver::CDriverPoolImpl::BoundClientPtr GetClient(
@@ -0,0 +1,116 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <optional>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+class ChangeStream : public MongoPoolFixture {};
+
+constexpr std::chrono::milliseconds kMaxAwaitTime{100};
+
+// Change streams are supported on replica sets only
+std::optional<mongo::ChangeStream> TryWatch(
+    mongo::Collection& coll, const mongo::operations::Watch& op) {
+  try {
+    return coll.Execute(op);
+  } catch (const mongo::ServerException&) {
+    return std::nullopt;
+  }
+}
+
+bson::Document NextEvent(mongo::ChangeStream& stream) {
+  while (true) {
+    auto event = stream.Next();
+    if (event) return *std::move(event);
+  }
+}
+
+}  // namespace
+
+UTEST_F(ChangeStream, Events) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_events");
+
+  mongo::operations::Watch watch;
+  watch.SetOption(mongo::options::FullDocument::kUpdateLookup);
+  watch.SetOption(mongo::options::MaxAwaitTime{kMaxAwaitTime});
+  auto stream = TryWatch(coll, watch);
+  if (!stream) GTEST_SKIP() << "Change streams are not supported";
+
+  EXPECT_FALSE(stream->Next());
+
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+  coll.UpdateOne(bson::MakeDoc("_id", 1),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 2)));
+  coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+  auto event = NextEvent(*stream);
+  EXPECT_EQ("insert", event["operationType"].As<std::string>());
+  EXPECT_EQ(1, event["fullDocument"]["x"].As<int>());
+
+  event = NextEvent(*stream);
+  EXPECT_EQ("update", event["operationType"].As<std::string>());
+  // looked up after the delete
+  EXPECT_TRUE(event["fullDocument"].IsMissing() ||
+              event["fullDocument"].IsNull());
+
+  event = NextEvent(*stream);
+  EXPECT_EQ("delete", event["operationType"].As<std::string>());
+  EXPECT_EQ(1, event["documentKey"]["_id"].As<int>());
+
+  EXPECT_FALSE(stream->Next());
+}
+
+UTEST_F(ChangeStream, Resume) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_resume");
+
+  mongo::operations::Watch watch;
+  watch.SetOption(mongo::options::MaxAwaitTime{kMaxAwaitTime});
+  auto stream = TryWatch(coll, watch);
+  if (!stream) GTEST_SKIP() << "Change streams are not supported";
+
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.InsertOne(bson::MakeDoc("_id", 2));
+
+  auto event = NextEvent(*stream);
+  EXPECT_EQ(1, event["documentKey"]["_id"].As<int>());
+  auto token = stream->GetResumeToken();
+  ASSERT_TRUE(token);
+  stream.reset();
+
+  mongo::operations::Watch resume_watch;
+  resume_watch.SetOption(mongo::options::ResumeAfter{*token});
+  resume_watch.SetOption(mongo::options::MaxAwaitTime{kMaxAwaitTime});
+  auto resumed = coll.Execute(resume_watch);
+
+  event = NextEvent(resumed);
+  EXPECT_EQ(2, event["documentKey"]["_id"].As<int>());
+  EXPECT_FALSE(resumed.Next());
+}
+
+UTEST_F(ChangeStream, Pipeline) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_pipeline");
+
+  mongo::operations::Watch watch{bson::MakeArray(bson::MakeDoc(
+      "$match", bson::MakeDoc("operationType", "delete")))};
+  watch.SetOption(mongo::options::MaxAwaitTime{kMaxAwaitTime});
+  auto stream = TryWatch(coll, watch);
+  if (!stream) GTEST_SKIP() << "Change streams are not supported";
+
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+  const auto event = NextEvent(*stream);
+  EXPECT_EQ("delete", event["operationType"].As<std::string>());
+}
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 
 #include <storages/mongo/stats.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -33,6 +34,7 @@ class CollectionImpl {
   virtual WriteResult Execute(operations::Bulk&&) = 0;
   virtual Cursor Execute(const operations::Aggregate&) = 0;
   virtual void Execute(const operations::Drop&) = 0;
+  virtual ChangeStream Execute(const operations::Watch&) = 0;
 
  protected:
   CollectionImpl(std::string&& database_name, std::string&& collection_name);
@@ -11,7 +11,9 @@ enum class ClusterHostType {
   /// Execute a query on primary host.
   kPrimary,
   /// Execute a query on a secondary (replica) host.
-  /// Fallbacks to primary in standalone topology.
+  /// Fallbacks to primary in standalone topology and if all the secondaries
+  /// lag more than `max_replication_lag` static option of the component.
+  /// Secondaries with an unknown replication status are considered lagging.
   kSecondary
 };
 
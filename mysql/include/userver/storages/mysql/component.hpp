@@ -49,6 +49,7 @@ namespace storages::mysql {
 /// -------------------------|---------------------------------------------|---------------
 /// initial_pool_size        | initial connection pool size (per host)     | 5
 /// max_pool_size            | maximum connection pool size (per host)     | 10
+/// max_replication_lag      | replication lag limit for usable secondaries | -
 ///
 // clang-format on
 class Component final : public components::LoggableComponentBase {
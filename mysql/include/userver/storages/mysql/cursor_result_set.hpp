@@ -2,6 +2,15 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <algorithm>
+#include <optional>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/storages/mysql/exceptions.hpp>
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +39,26 @@ class CursorResultSet final {
   template <typename RowCallback>
   void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+  /// @brief The default memory limit of ForEachPrefetched
+  static constexpr std::size_t kDefaultMaxPrefetchedBytes = 16 * 1024 * 1024;
+
+  /// @brief Same as ForEach, but the next batches are fetched in background
+  /// while row_callback processes the current one.
+  ///
+  /// Usable when row_callback does some I/O itself, so fetching and
+  /// processing overlap instead of alternating.
+  /// The fetched batches kept in memory in addition to the one being
+  /// processed and the one being fetched take at most about
+  /// `max_prefetched_bytes`, estimated from the size of the rows and of the
+  /// column values received. At least one batch is always prefetched.
+  ///
+  /// @throws MySQLIOException if the whole result set is not fetched by
+  /// `deadline`.
+  template <typename RowCallback>
+  void ForEachPrefetched(
+      RowCallback&& row_callback, engine::Deadline deadline,
+      std::size_t max_prefetched_bytes = kDefaultMaxPrefetchedBytes) &&;
+
  private:
   StatementResultSet result_set_;
 };
@@ -68,6 +97,86 @@ void CursorResultSet<T>::ForEach(
   }
 }
 
+template <typename T>
+template <typename RowCallback>
+void CursorResultSet<T>::ForEachPrefetched(
+    RowCallback&& row_callback, engine::Deadline deadline,
+    std::size_t max_prefetched_bytes) && {
+  using IntermediateStorage = std::vector<T>;
+  using Queue = concurrent::SpscQueue<IntermediateStorage>;
+  UINVARIANT(max_prefetched_bytes > 0, "Nothing to prefetch into");
+
+  auto queue = Queue::Create(1);
+  // The connection is used by the fetching task only, rows are bound directly
+  // into the batch storage and are moved into row_callback from there.
+  auto fetch_task = utils::Async(
+      "mysql_cursor_prefetch",
+      [this, deadline, max_prefetched_bytes, queue,
+       producer = queue->GetProducer()]() mutable {
+        bool keep_going = true;
+        std::size_t max_batch_bytes = 0;
+        // The extractor must outlive all the batches: statement binds are
+        // reused between fetches
+        auto extractor =
+            impl::io::TypedExtractor<IntermediateStorage, T, RowTag>{};
+
+        while (keep_going && !deadline.IsReached()) {
+          tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+          keep_going = result_set_.FetchResult(extractor);
+          fetch.Reset();
+
+          IntermediateStorage data{extractor.ExtractData()};
+          if (data.empty()) continue;
+
+          // The queue is bounded by the count of the largest batches so far
+          // that fit into the memory limit
+          const auto batch_bytes =
+              data.size() * sizeof(T) + result_set_.LastFetchedBytes();
+          if (batch_bytes > max_batch_bytes) {
+            max_batch_bytes = batch_bytes;
+            queue->SetSoftMaxSize(
+                std::max<std::size_t>(max_prefetched_bytes / batch_bytes, 1));
+          }
+
+          // fails if the consumer has stopped or the deadline is reached
+          if (!producer.Push(std::move(data), deadline)) return false;
+        }
+        return !keep_going;
+      });
+
+  std::optional<typename Queue::Consumer> consumer{queue->GetConsumer()};
+  const auto process_batch = [&row_callback](IntermediateStorage& data) {
+    tracing::ScopeTime for_each{impl::tracing::kForEachScope};
+    for (auto&& row : data) {
+      row_callback(std::move(row));
+    }
+  };
+  try {
+    IntermediateStorage data;
+    while (consumer->Pop(data, deadline)) {
+      process_batch(data);
+    }
+    // rethrows the fetch error, if any
+    if (!fetch_task.Get()) {
+      throw MySQLIOException{0, "Cursor prefetch deadline is reached"};
+    }
+    // The deadline might have interrupted Pop while the last batches were
+    // fetched, but the whole result set is fetched by now
+    while (consumer->PopNoblock(data)) {
+      process_batch(data);
+    }
+  } catch (...) {
+    // Cancelling the fetching task in the middle of FetchResult would leave
+    // the connection in the middle of the protocol. Instead the task is let
+    // to finish the current batch, after which it fails to push it and
+    // stops, and the statement is reset as usual.
+    consumer.reset();
+    engine::TaskCancellationBlocker block_cancel;
+    if (fetch_task.IsValid()) fetch_task.Wait();
+    throw;
+  }
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
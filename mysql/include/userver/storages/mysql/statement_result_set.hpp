@@ -187,8 +187,10 @@ class StatementResultSet final {
 
   bool FetchResult(impl::io::ExtractorBase& extractor);
 
+  std::size_t LastFetchedBytes() const;
+
   struct Impl;
-  utils::FastPimpl<Impl, 72, 8> impl_;
+  utils::FastPimpl<Impl, 80, 8> impl_;
 };
 
 /// @brief An interface for on-the-flight mapping statement result set from
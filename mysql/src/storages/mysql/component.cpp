@@ -63,6 +63,9 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    max_replication_lag:
+        type: string
+        description: replication lag limit for usable secondaries
 )");
 }
 
@@ -1,6 +1,8 @@
 #include <storages/mysql/impl/plain_query.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <storages/mysql/impl/mariadb_include.hpp>
 
@@ -66,6 +68,16 @@ QueryResult PlainQuery::FetchResult(engine::Deadline deadline) {
   }
 
   QueryResult result{};
+
+  const auto fields_count = mysql_num_fields(native_result.get());
+  const MYSQL_FIELD* fields = mysql_fetch_fields(native_result.get());
+  std::vector<std::string> field_names;
+  field_names.reserve(fields_count);
+  for (std::size_t i = 0; i < fields_count; ++i) {
+    field_names.emplace_back(fields[i].name, fields[i].name_length);
+  }
+  result.SetFieldNames(std::move(field_names));
+
   while (true) {
     MYSQL_ROW row =
         NativeInterface{connection_->GetSocket(), deadline}.QueryResultFetchRow(
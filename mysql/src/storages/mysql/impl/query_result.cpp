@@ -1,5 +1,7 @@
 #include <storages/mysql/impl/query_result.hpp>
 
+#include <algorithm>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +32,17 @@ QueryResultRow& QueryResult::GetRow(std::size_t ind) {
   return rows_[ind];
 }
 
+void QueryResult::SetFieldNames(std::vector<std::string>&& field_names) {
+  field_names_ = std::move(field_names);
+}
+
+std::optional<std::size_t> QueryResult::FindField(std::string_view name) const {
+  const auto it = std::find(field_names_.begin(), field_names_.end(), name);
+  if (it == field_names_.end()) return std::nullopt;
+
+  return it - field_names_.begin();
+}
+
 }  // namespace storages::mysql::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <storages/mysql/impl/query_result_row.hpp>
@@ -23,6 +26,10 @@ class QueryResult final {
   const QueryResultRow& GetRow(std::size_t ind) const;
   QueryResultRow& GetRow(std::size_t ind);
 
+  void SetFieldNames(std::vector<std::string>&& field_names);
+  // Index of the first field with the given name, if any
+  std::optional<std::size_t> FindField(std::string_view name) const;
+
   auto begin() { return rows_.begin(); }
   auto begin() const { return rows_.begin(); }
 
@@ -30,6 +37,7 @@ class QueryResult final {
   auto end() const { return rows_.end(); }
 
  private:
+  std::vector<std::string> field_names_;
   std::vector<QueryResultRow> rows_;
 };
 
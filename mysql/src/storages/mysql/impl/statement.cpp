@@ -20,6 +20,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::impl {
 
+namespace {
+
+// libmariadb points the length of every bind to the fetched value length
+std::size_t GetFetchedBytes(bindings::OutputBindings& binds) {
+  std::size_t result = 0;
+  const auto* binds_array = binds.GetBindsArray();
+  for (std::size_t i = 0; i < binds.Size(); ++i) {
+    if (binds_array[i].length) result += *binds_array[i].length;
+  }
+  return result;
+}
+
+}  // namespace
+
 Statement::NativeStatementDeleter::NativeStatementDeleter(
     Connection* connection)
     : connection_{connection} {
@@ -306,12 +320,14 @@ StatementFetcher::~StatementFetcher() {
 StatementFetcher::StatementFetcher(StatementFetcher&& other) noexcept
     : parent_statement_deadline_{other.parent_statement_deadline_},
       binds_applied_{other.binds_applied_},
-      statement_{std::exchange(other.statement_, nullptr)} {}
+      statement_{std::exchange(other.statement_, nullptr)},
+      last_fetched_bytes_{other.last_fetched_bytes_} {}
 
 bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
   auto guard = statement_->connection_->GetBrokenGuard();
 
   return guard.Execute([&] {
+    last_fetched_bytes_ = 0;
     const auto batch_size = statement_->GetBatchSize();
 
     if (!batch_size.has_value()) {
@@ -346,6 +362,7 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
         extractor.RollbackLastRow();
         return false;
       }
+      last_fetched_bytes_ += GetFetchedBytes(binds);
       extractor.CommitLastRow();
       // With this we make OutputBinder operate on MYSQL_BIND array stored in
       // statement.
@@ -365,6 +382,10 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
   });
 }
 
+std::size_t StatementFetcher::LastFetchedBytes() const {
+  return last_fetched_bytes_;
+}
+
 std::uint64_t StatementFetcher::RowsAffected() const {
   const auto rows_affected =
       mysql_stmt_affected_rows(statement_->native_statement_.get());
@@ -35,6 +35,9 @@ class StatementFetcher final {
 
   bool FetchResult(io::ExtractorBase& extractor);
 
+  // Size of the column values received by the last FetchResult
+  std::size_t LastFetchedBytes() const;
+
   std::uint64_t RowsAffected() const;
 
   std::uint64_t LastInsertId() const;
@@ -47,6 +50,7 @@ class StatementFetcher final {
   bool binds_applied_{false};
   bool binds_validated_{false};
   Statement* statement_;
+  std::size_t last_fetched_bytes_{0};
 };
 
 class Statement final {
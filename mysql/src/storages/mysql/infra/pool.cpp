@@ -1,11 +1,21 @@
 #include <storages/mysql/infra/pool.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include <storages/mysql/impl/mariadb_include.hpp>
 
 #include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
+#include <userver/storages/mysql/exceptions.hpp>
+
 #include <storages/mysql/impl/connection.hpp>
+#include <storages/mysql/impl/query_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,8 +32,53 @@ constexpr std::chrono::milliseconds kPoolSizeMonitorInterval{2000};
 constexpr std::chrono::milliseconds kPingerInterval{1000};
 constexpr std::chrono::milliseconds kPingTimeout{200};
 
+// MySQL 8.0.22+ and MariaDB 10.5.1+, the only one in MySQL 8.4+
+const std::string kShowReplicaStatus{"SHOW REPLICA STATUS"};
+const std::string kShowSlaveStatus{"SHOW SLAVE STATUS"};
+constexpr std::chrono::milliseconds kReplicaStatusTimeout{500};
+
+// MySQL renamed the field along with the statement, MariaDB didn't
+constexpr std::string_view kSecondsBehindSourceFields[] = {
+    "Seconds_Behind_Source", "Seconds_Behind_Master"};
+
 }  // namespace
 
+std::int64_t ParseReplicationLag(const impl::QueryResult& result) {
+  // The result is empty for a host that is not a replica
+  if (result.RowsCount() == 0) return kNotReplica;
+
+  std::optional<std::size_t> field;
+  for (const auto name : kSecondsBehindSourceFields) {
+    field = result.FindField(name);
+    if (field) break;
+  }
+  if (!field) {
+    throw std::runtime_error{
+        "No Seconds_Behind_Source field in the replication status"};
+  }
+
+  // A row per replication channel, the most lagging one counts
+  std::int64_t lag = 0;
+  for (const auto& row : result) {
+    const auto& seconds_behind_source = row.GetField(*field);
+    // NULL if the replication is stopped
+    if (seconds_behind_source.empty()) return kReplicationStopped;
+    lag = std::max(lag,
+                   utils::FromString<std::int64_t>(seconds_behind_source));
+  }
+  return lag;
+}
+
+bool IsReplicationLagging(
+    std::int64_t lag_seconds,
+    std::optional<std::chrono::seconds> max_replication_lag) noexcept {
+  if (!max_replication_lag) return false;
+
+  return lag_seconds == kReplicationStopped ||
+         lag_seconds == kUnknownReplicationLag ||
+         lag_seconds > max_replication_lag->count();
+}
+
 std::shared_ptr<Pool> Pool::Create(
     clients::dns::Resolver& resolver,
     const settings::PoolSettings& pool_settings) {
@@ -82,6 +137,11 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
   }
 }
 
+bool Pool::IsReplicationLagging() const noexcept {
+  return infra::IsReplicationLagging(stats_.replication_lag_seconds.load(),
+                                     settings_.max_replication_lag);
+}
+
 void Pool::AccountConnectionAcquired() { ++stats_.acquired; }
 void Pool::AccountConnectionReleased() { ++stats_.released; }
 void Pool::AccountConnectionCreated() { ++stats_.created; }
@@ -116,7 +176,41 @@ void Pool::RunPinger() {
     monitor_.AccountSuccess();
   } catch (const std::exception& ex) {
     LOG_WARNING() << "Failed to ping the server: " << ex.what();
+    // The lag measured before the host went down is not actual anymore
+    stats_.replication_lag_seconds = kUnknownReplicationLag;
+    return;
+  }
+
+  if (settings_.max_replication_lag) UpdateReplicationLag(*pinger_connection);
+}
+
+void Pool::UpdateReplicationLag(impl::Connection& connection) {
+  auto lag = kUnknownReplicationLag;
+  try {
+    lag = ParseReplicationLag(ShowReplicaStatus(connection));
+  } catch (const std::exception& ex) {
+    ++stats_.replication_status_errors;
+    LOG_LIMITED_WARNING()
+        << "Failed to get the replication status, the host is considered "
+           "lagging: "
+        << ex;
+  }
+  stats_.replication_lag_seconds = lag;
+}
+
+impl::QueryResult Pool::ShowReplicaStatus(impl::Connection& connection) {
+  const auto deadline = engine::Deadline::FromDuration(kReplicaStatusTimeout);
+  if (!use_show_slave_status_) {
+    try {
+      return connection.ExecuteQuery(kShowReplicaStatus, deadline);
+    } catch (const MySQLException& ex) {
+      if (ex.GetErrno() != ER_PARSE_ERROR) throw;
+      LOG_INFO() << "SHOW REPLICA STATUS is not supported by the server, "
+                    "falling back to SHOW SLAVE STATUS";
+      use_show_slave_status_ = true;
+    }
   }
+  return connection.ExecuteQuery(kShowSlaveStatus, deadline);
 }
 
 Pool::PoolMonitor::PoolMonitor(Pool& pool) : pool_{pool} {}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/deadline.hpp>
@@ -20,10 +23,21 @@ namespace storages::mysql {
 
 namespace impl {
 class Connection;
-}
+class QueryResult;
+}  // namespace impl
 
 namespace infra {
 
+// Seconds_Behind_Source of the SHOW REPLICA STATUS result or one of the
+// constants from statistics.hpp, throws if the field is missing
+std::int64_t ParseReplicationLag(const impl::QueryResult& result);
+
+// Whether the replica lags more than `max_replication_lag`, the stopped
+// replication and the unknown lag count as lagging
+bool IsReplicationLagging(
+    std::int64_t lag_seconds,
+    std::optional<std::chrono::seconds> max_replication_lag) noexcept;
+
 class Pool final
     : public drivers::impl::ConnectionPoolBase<impl::Connection, Pool> {
  public:
@@ -37,6 +51,9 @@ class Pool final
 
   void WriteStatistics(utils::statistics::Writer& writer) const;
 
+  // Whether the host is a replica lagging more than `max_replication_lag`
+  bool IsReplicationLagging() const noexcept;
+
   Pool(clients::dns::Resolver& resolver,
        const settings::PoolSettings& pool_settings);
 
@@ -53,6 +70,8 @@ class Pool final
 
   void RunSizeMonitor();
   void RunPinger();
+  void UpdateReplicationLag(impl::Connection& connection);
+  impl::QueryResult ShowReplicaStatus(impl::Connection& connection);
 
   class PoolMonitor final {
    public:
@@ -84,6 +103,8 @@ class Pool final
   const settings::PoolSettings settings_;
 
   PoolConnectionStatistics stats_{};
+  // Used by the pinger only, set if the server predates SHOW REPLICA STATUS
+  bool use_show_slave_status_{false};
 
   PoolMonitor monitor_;
 };
@@ -14,6 +14,10 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   writer["active"] = stats.created - stats.closed;
   writer["busy"] = stats.acquired - stats.released;
+
+  writer["replication_status_errors"] = stats.replication_status_errors;
+  const auto replication_lag = stats.replication_lag_seconds.load();
+  if (replication_lag >= 0) writer["replication_lag"] = replication_lag;
 }
 
 }  // namespace storages::mysql::infra
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 #include <userver/utils/statistics/relaxed_counter.hpp>
@@ -10,12 +11,23 @@ namespace storages::mysql::infra {
 
 using Counter = utils::statistics::RelaxedCounter<std::uint64_t>;
 
+// The host is not a replica
+inline constexpr std::int64_t kNotReplica{-1};
+// Replication SQL thread is not running, the replica doesn't catch up
+inline constexpr std::int64_t kReplicationStopped{-2};
+// Not measured yet or failed to get the replication status
+inline constexpr std::int64_t kUnknownReplicationLag{-3};
+
 struct PoolConnectionStatistics final {
   Counter overload{};
   Counter closed{};
   Counter created{};
   Counter acquired{};
   Counter released{};
+  Counter replication_status_errors{};
+
+  // Seconds_Behind_Source of the host or one of the constants above
+  std::atomic<std::int64_t> replication_lag_seconds{kUnknownReplicationLag};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
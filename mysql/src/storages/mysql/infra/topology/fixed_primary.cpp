@@ -2,19 +2,12 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/mysql/infra/pool.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::infra::topology {
 
-namespace {
-
-std::size_t WrappingIncrement(std::atomic<size_t>& value, std::size_t mod) {
-  // we don't actually care about order being broken once in 2^64 iterations
-  return value.fetch_add(1) % mod;
-}
-
-}  // namespace
-
 FixedPrimary::FixedPrimary(clients::dns::Resolver& resolver,
                            const std::vector<settings::PoolSettings>& settings)
     : TopologyBase(resolver, settings),
@@ -26,9 +19,11 @@ FixedPrimary::~FixedPrimary() = default;
 Pool& FixedPrimary::GetPrimary() const { return primary_; }
 
 Pool& FixedPrimary::GetSecondary() const {
-  const auto pool_index =
-      WrappingIncrement(secondary_index_, secondaries_.size());
-  return *secondaries_[pool_index];
+  auto* pool = FindNotLaggingSecondary(secondaries_, secondary_index_);
+  if (pool) return *pool;
+
+  // All the secondaries lag too much, the primary is always up to date
+  return GetPrimary();
 }
 
 Pool& FixedPrimary::InitializePrimaryPoolReference() {
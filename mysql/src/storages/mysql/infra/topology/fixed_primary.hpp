@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <vector>
 
 #include <storages/mysql/infra/topology/topology_base.hpp>
 
@@ -8,6 +10,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::infra::topology {
 
+// Round-robins over the secondaries skipping the lagging ones, nullptr if all
+// of them lag
+template <typename PoolType>
+PoolType* FindNotLaggingSecondary(const std::vector<PoolType*>& secondaries,
+                                  std::atomic<std::size_t>& index) {
+  for (std::size_t i = 0; i < secondaries.size(); ++i) {
+    // we don't actually care about order being broken once in 2^64 iterations
+    auto* pool = secondaries[index.fetch_add(1) % secondaries.size()];
+    if (!pool->IsReplicationLagging()) return pool;
+  }
+  return nullptr;
+}
+
 class FixedPrimary final : public TopologyBase {
  public:
   FixedPrimary(clients::dns::Resolver& resolver,
@@ -71,6 +71,8 @@ PoolSettings PoolSettings::Create(const components::ComponentConfig& config,
       config["initial_pool_size"].As<std::size_t>(settings.initial_pool_size);
   settings.max_pool_size =
       config["max_pool_size"].As<std::size_t>(settings.max_pool_size);
+  settings.max_replication_lag =
+      config["max_replication_lag"].As<std::optional<std::chrono::seconds>>();
   settings.endpoint_info = endpoint_info;
   settings.auth_settings = auth_settings;
   settings.connection_settings = config.As<ConnectionSettings>();
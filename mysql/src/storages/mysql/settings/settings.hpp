@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -46,6 +48,7 @@ struct EndpointInfo final {
 struct PoolSettings final {
   std::size_t initial_pool_size{5};
   std::size_t max_pool_size{10};
+  std::optional<std::chrono::seconds> max_replication_lag{};
 
   EndpointInfo endpoint_info;
   AuthSettings auth_settings;
@@ -54,6 +54,10 @@ bool StatementResultSet::FetchResult(impl::io::ExtractorBase& extractor) {
   return impl_->fetcher.FetchResult(extractor);
 }
 
+std::size_t StatementResultSet::LastFetchedBytes() const {
+  return impl_->fetcher.LastFetchedBytes();
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
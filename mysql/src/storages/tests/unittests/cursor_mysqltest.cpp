@@ -1,4 +1,7 @@
 #include <userver/utest/utest.hpp>
+
+#include <userver/engine/sleep.hpp>
+
 #include "../utils_mysqltest.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -47,6 +50,142 @@ UTEST(Cursor, Works) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, ForEachPrefetched) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 20;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        rows_to_insert.back());
+  }
+
+  std::vector<Row> db_rows;
+  db_rows.reserve(rows_count);
+
+  cluster
+      ->GetCursor<Row>(ClusterHostType::kPrimary, 3,
+                       table.FormatWithTableName("SELECT Id, Value FROM {}"))
+      .ForEachPrefetched(
+          [&db_rows](Row&& row) {
+            // let the next batches be prefetched meanwhile
+            engine::Yield();
+            db_rows.push_back(std::move(row));
+          },
+          cluster.GetDeadline(), 2 * 3 * sizeof(Row));
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
+UTEST(Cursor, ForEachPrefetchedDeadlineDuringLastFetch) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  // The last batch is not full, so its fetch reports the end of the data
+  constexpr std::size_t rows_count = 5;
+  std::vector<Row> rows_to_insert;
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back({static_cast<std::int32_t>(i), "value"});
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        rows_to_insert.back());
+  }
+
+  // The deadlines are swept over the time of the fetches, so that some of
+  // them expire while the consumer waits for the last batch. Either all the
+  // rows reach the callback, or the deadline error is reported.
+  std::size_t completed = 0;
+  for (std::chrono::microseconds timeout{0};
+       timeout < std::chrono::milliseconds{100};
+       timeout += std::chrono::microseconds{500}) {
+    std::vector<Row> db_rows;
+    try {
+      cluster
+          ->GetCursor<Row>(
+              ClusterHostType::kPrimary, 2,
+              table.FormatWithTableName("SELECT Id, Value FROM {}"))
+          .ForEachPrefetched(
+              [&db_rows](Row&& row) { db_rows.push_back(std::move(row)); },
+              engine::Deadline::FromDuration(timeout));
+    } catch (const MySQLIOException&) {
+      continue;
+    }
+    EXPECT_EQ(db_rows, rows_to_insert) << "timeout " << timeout.count();
+    ++completed;
+  }
+  EXPECT_GT(completed, 0);
+}
+
+UTEST(Cursor, ForEachPrefetchedThrowingCallback) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 10;
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        Row{static_cast<std::int32_t>(i), "value"});
+  }
+
+  UEXPECT_THROW(
+      cluster
+          ->GetCursor<Row>(
+              ClusterHostType::kPrimary, 2,
+              table.FormatWithTableName("SELECT Id, Value FROM {}"))
+          .ForEachPrefetched(
+              [](Row&& row) {
+                if (row.id == 3) throw std::runtime_error{"stop"};
+              },
+              cluster.GetDeadline()),
+      std::runtime_error);
+
+  // the table is still readable after the prefetch is stopped
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+  EXPECT_EQ(db_rows.size(), rows_count);
+}
+
+UTEST(Cursor, ForEachPrefetchedDeadline) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 10;
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        Row{static_cast<std::int32_t>(i), "value"});
+  }
+
+  const auto deadline =
+      engine::Deadline::FromDuration(std::chrono::milliseconds{100});
+  UEXPECT_THROW(
+      cluster
+          ->GetCursor<Row>(
+              ClusterHostType::kPrimary, 2,
+              table.FormatWithTableName("SELECT Id, Value FROM {}"))
+          .ForEachPrefetched(
+              [](Row&&) {
+                engine::SleepFor(std::chrono::milliseconds{50});
+              },
+              deadline),
+      MySQLIOException);
+
+  // the table is still readable after the prefetch is stopped
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+  EXPECT_EQ(db_rows.size(), rows_count);
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
   ClusterWrapper cluster{};
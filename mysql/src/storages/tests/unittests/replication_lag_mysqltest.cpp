@@ -0,0 +1,148 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <storages/mysql/impl/query_result.hpp>
+#include <storages/mysql/infra/pool.hpp>
+#include <storages/mysql/infra/topology/fixed_primary.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::tests {
+
+namespace {
+
+constexpr std::chrono::seconds kMaxReplicationLag{10};
+
+// NULL fields are nullopt
+using Field = std::optional<std::string>;
+
+impl::QueryResult MakeReplicaStatus(std::vector<std::string> field_names,
+                                    std::vector<std::vector<Field>> rows) {
+  impl::QueryResult result;
+  result.SetFieldNames(std::move(field_names));
+  for (auto& row : rows) {
+    std::vector<char*> data;
+    std::vector<std::size_t> lengths;
+    for (auto& field : row) {
+      data.push_back(field ? field->data() : nullptr);
+      lengths.push_back(field ? field->size() : 0);
+    }
+    result.AppendRow({data.data(), data.size(), lengths.data()});
+  }
+  return result;
+}
+
+struct PoolMock final {
+  std::int64_t lag_seconds{infra::kUnknownReplicationLag};
+
+  bool IsReplicationLagging() const noexcept {
+    return infra::IsReplicationLagging(lag_seconds, kMaxReplicationLag);
+  }
+};
+
+PoolMock* FindSecondary(std::vector<PoolMock>& pools, std::size_t index = 0) {
+  std::vector<PoolMock*> secondaries;
+  for (auto& pool : pools) secondaries.push_back(&pool);
+
+  std::atomic<std::size_t> secondary_index{index};
+  return infra::topology::FindNotLaggingSecondary(secondaries,
+                                                  secondary_index);
+}
+
+}  // namespace
+
+TEST(ReplicationLag, ParseByFieldName) {
+  const auto result = MakeReplicaStatus(
+      {"Replica_IO_State", "Source_Host", "Seconds_Behind_Source"},
+      {{"Waiting for source", "primary", "42"}});
+  EXPECT_EQ(infra::ParseReplicationLag(result), 42);
+}
+
+TEST(ReplicationLag, ParseLegacyFieldName) {
+  const auto result = MakeReplicaStatus(
+      {"Seconds_Behind_Master", "Master_Host"}, {{"7", "primary"}});
+  EXPECT_EQ(infra::ParseReplicationLag(result), 7);
+}
+
+TEST(ReplicationLag, ParseMostLaggingChannel) {
+  const auto result =
+      MakeReplicaStatus({"Channel_Name", "Seconds_Behind_Source"},
+                        {{"a", "3"}, {"b", "15"}, {"c", "0"}});
+  EXPECT_EQ(infra::ParseReplicationLag(result), 15);
+}
+
+TEST(ReplicationLag, ParseNull) {
+  const auto result =
+      MakeReplicaStatus({"Channel_Name", "Seconds_Behind_Source"},
+                        {{"a", "3"}, {"b", std::nullopt}});
+  EXPECT_EQ(infra::ParseReplicationLag(result), infra::kReplicationStopped);
+}
+
+TEST(ReplicationLag, ParseNotReplica) {
+  const auto result = MakeReplicaStatus({"Seconds_Behind_Source"}, {});
+  EXPECT_EQ(infra::ParseReplicationLag(result), infra::kNotReplica);
+}
+
+TEST(ReplicationLag, ParseMissingColumn) {
+  const auto result =
+      MakeReplicaStatus({"Replica_IO_State", "Source_Host"},
+                        {{"Waiting for source", "primary"}});
+  EXPECT_THROW(infra::ParseReplicationLag(result), std::runtime_error);
+}
+
+TEST(ReplicationLag, IsLagging) {
+  EXPECT_FALSE(infra::IsReplicationLagging(10, kMaxReplicationLag));
+  EXPECT_TRUE(infra::IsReplicationLagging(11, kMaxReplicationLag));
+  EXPECT_FALSE(infra::IsReplicationLagging(infra::kNotReplica,
+                                           kMaxReplicationLag));
+  EXPECT_TRUE(infra::IsReplicationLagging(infra::kReplicationStopped,
+                                          kMaxReplicationLag));
+  EXPECT_TRUE(infra::IsReplicationLagging(infra::kUnknownReplicationLag,
+                                          kMaxReplicationLag));
+
+  // Nothing lags without the limit
+  EXPECT_FALSE(
+      infra::IsReplicationLagging(infra::kUnknownReplicationLag, std::nullopt));
+  EXPECT_FALSE(infra::IsReplicationLagging(1000, std::nullopt));
+}
+
+TEST(ReplicationLag, SecondaryRoundRobin) {
+  std::vector<PoolMock> pools{{0}, {1}, {2}};
+  std::vector<PoolMock*> secondaries{&pools[0], &pools[1], &pools[2]};
+
+  std::atomic<std::size_t> index{0};
+  for (std::size_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(infra::topology::FindNotLaggingSecondary(secondaries, index),
+              &pools[i % pools.size()]);
+  }
+}
+
+TEST(ReplicationLag, SecondarySkipsLagging) {
+  std::vector<PoolMock> pools{{100}, {infra::kReplicationStopped}, {5}};
+  for (std::size_t index = 0; index < pools.size(); ++index) {
+    EXPECT_EQ(FindSecondary(pools, index), &pools[2]);
+  }
+}
+
+TEST(ReplicationLag, SecondarySkipsUnknownLag) {
+  std::vector<PoolMock> pools{{infra::kUnknownReplicationLag},
+                              {infra::kNotReplica}};
+  EXPECT_EQ(FindSecondary(pools), &pools[1]);
+}
+
+TEST(ReplicationLag, AllSecondariesLagging) {
+  std::vector<PoolMock> pools{
+      {infra::kUnknownReplicationLag}, {11}, {infra::kReplicationStopped}};
+  // The primary is used instead
+  EXPECT_EQ(FindSecondary(pools), nullptr);
+}
+
+}  // namespace storages::mysql::tests
+
+USERVER_NAMESPACE_END
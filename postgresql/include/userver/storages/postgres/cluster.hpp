@@ -155,6 +155,14 @@ class Cluster {
   /// @throws ClusterUnavailable if no hosts are available
   Transaction Begin(const std::string& name, ClusterHostTypeFlags,
                     const TransactionOptions&);
+
+  /// Start a transaction in a connection with specified host selection rules
+  /// on a slave satisfying the freshness requirements.
+  ///
+  /// If none of the slaves satisfies the requirements, falls back to master.
+  /// @throws ClusterUnavailable if no hosts are available
+  Transaction Begin(ClusterHostTypeFlags, const ReplicaFreshness&,
+                    const TransactionOptions&, OptionalCommandControl = {});
   /// @}
 
   /// @name Single-statement query in an auto-commit transaction
@@ -193,8 +201,27 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags flags,
                     OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
+
+  /// @brief Execute a statement with specified host selection rules at a
+  /// slave satisfying the freshness requirements.
+  ///
+  /// If none of the slaves satisfies the requirements, falls back to master.
+  /// @note You must specify at least one role from ClusterHostType here
+  ///
+  /// @snippet storages/postgres/tests/cluster_pgtest.cpp Read your writes
+  template <typename... Args>
+  ResultSet Execute(ClusterHostTypeFlags, const ReplicaFreshness&,
+                    OptionalCommandControl, const Query& query,
+                    const Args&... args);
   /// @}
 
+  /// @brief Returns the current write position of master, a token for
+  /// read-your-writes consistency, see ReplicaFreshness::read_after.
+  ///
+  /// Requires PostgreSQL 10 or newer.
+  /// @throws ClusterUnavailable if master is not available
+  WritePosition GetWritePosition(OptionalCommandControl = {});
+
   /// Replaces globally updated command control with a static user-provided one
   void SetDefaultCommandControl(CommandControl);
 
@@ -222,7 +249,8 @@ class Cluster {
   void SetStatementMetricsSettings(const StatementMetricsSettings& settings);
 
  private:
-  detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  detail::NonTransaction Start(ClusterHostTypeFlags, const ReplicaFreshness&,
+                               OptionalCommandControl);
 
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
@@ -241,11 +269,19 @@ template <typename... Args>
 ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
                            OptionalCommandControl statement_cmd_ctl,
                            const Query& query, const Args&... args) {
+  return Execute(flags, ReplicaFreshness{}, statement_cmd_ctl, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
+                           const ReplicaFreshness& freshness,
+                           OptionalCommandControl statement_cmd_ctl,
+                           const Query& query, const Args&... args) {
   if (!statement_cmd_ctl && query.GetName()) {
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  auto ntrx = Start(flags, freshness, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
@@ -3,6 +3,9 @@
 /// @file userver/storages/postgres/cluster_types.hpp
 /// @brief Cluster properties
 
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <string>
 
 #include <userver/utils/flags.hpp>
@@ -61,6 +64,28 @@ std::string ToString(ClusterHostTypeFlags);
 logging::LogHelper& operator<<(logging::LogHelper&, ClusterHostType);
 logging::LogHelper& operator<<(logging::LogHelper&, ClusterHostTypeFlags);
 
+/// @brief Position of a write in the master write-ahead log (LSN)
+///
+/// A session token for read-your-writes consistency: get it with
+/// Cluster::GetWritePosition() after a write and pass it as
+/// ReplicaFreshness::read_after for the subsequent reads. The position is a
+/// plain number and may be passed to other services.
+struct WritePosition {
+  std::uint64_t lsn{0};
+};
+
+/// @brief Requirements for a slave to be chosen for a request.
+///
+/// Replication state of the slaves is measured by the topology discovery
+/// about once a second. Master always satisfies the requirements, so if none
+/// of the slaves of the requested role do, the request falls back to master.
+struct ReplicaFreshness {
+  /// Max replication lag of a slave
+  std::optional<std::chrono::milliseconds> max_staleness;
+  /// The slave must have replayed the write-ahead log up to this position
+  std::optional<WritePosition> read_after;
+};
+
 struct ClusterHostTypeHash {
   size_t operator()(ClusterHostType ht) const noexcept {
     return static_cast<size_t>(ht);
@@ -9,6 +9,7 @@
 #include <userver/storages/postgres/detail/time_types.hpp>
 
 #include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
@@ -19,6 +20,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+using TimingsHistogram = USERVER_NAMESPACE::utils::statistics::Histogram<>;
+
+namespace detail {
+
+/// Histograms are collected in a RecentPeriod for the atomic statistics
+template <typename Counter>
+using HistogramAccumulator = std::conditional_t<
+    std::is_same_v<Counter, uint32_t>, TimingsHistogram,
+    USERVER_NAMESPACE::utils::statistics::RecentPeriod<
+        TimingsHistogram, TimingsHistogram, detail::SteadyClock>>;
+
+}  // namespace detail
+
 /// @brief Template transaction statistics storage
 template <typename Counter, typename PercentileAccumulator>
 struct TransactionStatistics {
@@ -63,6 +77,10 @@ struct TransactionStatistics {
   /// Return to pool percentile (difference between trx_end_time and time the
   /// connection has been returned to the pool)
   PercentileAccumulator return_to_pool_percentile;
+  /// Transaction overall execution time histogram
+  detail::HistogramAccumulator<Counter> total_histogram;
+  /// Transaction aggregated query execution time histogram
+  detail::HistogramAccumulator<Counter> busy_histogram;
 };
 
 /// @brief Template connection statistics storage
@@ -184,6 +202,10 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         stats.transaction.wait_end_percentile.GetStatsForPeriod();
     transaction.return_to_pool_percentile =
         stats.transaction.return_to_pool_percentile.GetStatsForPeriod();
+    transaction.total_histogram =
+        stats.transaction.total_histogram.GetStatsForPeriod();
+    transaction.busy_histogram =
+        stats.transaction.busy_histogram.GetStatsForPeriod();
 
     topology.roundtrip_time = topology_stats.roundtrip_time.GetStatsForPeriod();
     topology.replication_lag =
@@ -2,6 +2,8 @@
 
 #include <storages/postgres/detail/cluster_impl.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/internal_pg_types.hpp>
+#include <storages/postgres/io/pg_type_parsers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,7 +37,7 @@ Transaction Cluster::Begin(const TransactionOptions& options,
 Transaction Cluster::Begin(ClusterHostTypeFlags flags,
                            const TransactionOptions& options,
                            OptionalCommandControl cmd_ctl) {
-  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(cmd_ctl));
+  return pimpl_->Begin(flags, {}, options, GetHandlersCmdCtl(cmd_ctl));
 }
 
 Transaction Cluster::Begin(const std::string& name,
@@ -45,7 +47,23 @@ Transaction Cluster::Begin(const std::string& name,
 
 Transaction Cluster::Begin(const std::string& name, ClusterHostTypeFlags flags,
                            const TransactionOptions& options) {
-  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(GetQueryCmdCtl(name)));
+  return pimpl_->Begin(flags, {}, options,
+                       GetHandlersCmdCtl(GetQueryCmdCtl(name)));
+}
+
+Transaction Cluster::Begin(ClusterHostTypeFlags flags,
+                           const ReplicaFreshness& freshness,
+                           const TransactionOptions& options,
+                           OptionalCommandControl cmd_ctl) {
+  return pimpl_->Begin(flags, freshness, options, GetHandlersCmdCtl(cmd_ctl));
+}
+
+WritePosition Cluster::GetWritePosition(OptionalCommandControl cmd_ctl) {
+  static const Query kCurrentWalLsnQuery{"SELECT pg_current_wal_lsn()"};
+  const auto lsn =
+      Execute(ClusterHostType::kMaster, cmd_ctl, kCurrentWalLsnQuery)
+          .AsSingleRow<Lsn>();
+  return WritePosition{lsn.GetUnderlying()};
 }
 
 void Cluster::SetDefaultCommandControl(CommandControl cmd_ctl) {
@@ -86,8 +104,9 @@ void Cluster::SetStatementMetricsSettings(
 }
 
 detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
+                                      const ReplicaFreshness& freshness,
                                       OptionalCommandControl cmd_ctl) {
-  return pimpl_->Start(flags, cmd_ctl);
+  return pimpl_->Start(flags, freshness, cmd_ctl);
 }
 
 OptionalCommandControl Cluster::GetQueryCmdCtl(
@@ -112,7 +131,7 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  auto ntrx = Start(flags, {}, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
@@ -65,6 +67,35 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
   return indices[idx_pos];
 }
 
+using DsnIndices = topology::TopologyBase::DsnIndices;
+using ReplicaStates = topology::TopologyBase::ReplicaStates;
+
+bool IsFresh(const topology::TopologyBase::ReplicaState& state,
+             const ReplicaFreshness& freshness) {
+  if (state.is_master) return true;
+  if (freshness.max_staleness &&
+      state.replication_lag > *freshness.max_staleness) {
+    return false;
+  }
+  if (freshness.read_after &&
+      state.wal_lsn.GetUnderlying() < freshness.read_after->lsn) {
+    return false;
+  }
+  return true;
+}
+
+DsnIndices FilterFresh(const DsnIndices& indices,
+                       const ReplicaStates& replica_states,
+                       const ReplicaFreshness& freshness) {
+  DsnIndices result;
+  result.reserve(indices.size());
+  for (const auto idx : indices) {
+    UASSERT(idx < replica_states.size());
+    if (IsFresh(replica_states[idx], freshness)) result.push_back(idx);
+  }
+  return result;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -209,7 +240,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
 }
 
 ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
-    ClusterHostTypeFlags flags) {
+    ClusterHostTypeFlags flags, const ReplicaFreshness& freshness) {
   LOG_TRACE() << "Looking for pool: " << flags;
 
   size_t dsn_index = -1;
@@ -220,6 +251,19 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                   role_flags == ClusterHostType::kSyncSlave,
               "kSyncSlave cannot be combined with other roles");
 
+  // Replica states are only read when there are freshness requirements
+  std::optional<rcu::ReadablePtr<ReplicaStates>> replica_states;
+  if (freshness.max_staleness || freshness.read_after) {
+    replica_states.emplace(topology_->GetReplicaStates());
+  }
+  DsnIndices fresh_dsn_indices;
+  const auto select_fresh =
+      [&](const DsnIndices& indices) -> const DsnIndices& {
+    if (!replica_states) return indices;
+    fresh_dsn_indices = FilterFresh(indices, **replica_states, freshness);
+    return fresh_dsn_indices;
+  };
+
   if ((role_flags & ClusterHostType::kMaster) &&
       (role_flags & ClusterHostType::kSlave)) {
     LOG_TRACE() << "Starting transaction on " << role_flags;
@@ -227,29 +271,43 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    const auto& candidates = select_fresh(*alive_dsn_indices);
+    if (candidates.empty()) {
+      throw ClusterUnavailable(
+          "None of available cluster hosts satisfy freshness requirements");
+    }
+    dsn_index = SelectDsnIndex(candidates, flags, rr_host_idx_);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
-    auto dsn_indices_it = dsn_indices_by_type->find(host_role);
-    while (host_role != ClusterHostType::kMaster &&
-           (dsn_indices_it == dsn_indices_by_type->end() ||
-            dsn_indices_it->second.empty())) {
+    const auto find_candidates =
+        [&](ClusterHostType role) -> const DsnIndices* {
+      const auto it = dsn_indices_by_type->find(role);
+      if (it == dsn_indices_by_type->end() || it->second.empty()) {
+        return nullptr;
+      }
+      const auto& candidates = select_fresh(it->second);
+      return candidates.empty() ? nullptr : &candidates;
+    };
+
+    auto* candidates = find_candidates(host_role);
+    while (host_role != ClusterHostType::kMaster && !candidates) {
       auto fb = Fallback(host_role);
       LOG_WARNING() << "There is no pool for " << host_role
+                    << (replica_states ? " satisfying freshness requirements"
+                                       : "")
                     << ", falling back to " << fb;
       host_role = fb;
-      dsn_indices_it = dsn_indices_by_type->find(host_role);
+      candidates = find_candidates(host_role);
     }
 
-    if (dsn_indices_it == dsn_indices_by_type->end() ||
-        dsn_indices_it->second.empty()) {
+    if (!candidates) {
       throw ClusterUnavailable(
           fmt::format("Pool for {} (requested: {}) is not available",
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(*candidates, flags, rr_host_idx_);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -257,6 +315,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
 }
 
 Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
+                               const ReplicaFreshness& freshness,
                                const TransactionOptions& options,
                                OptionalCommandControl cmd_ctl) {
   LOG_TRACE() << "Requested transaction on " << flags;
@@ -271,17 +330,18 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
     }
     flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
   }
-  return FindPool(flags)->Begin(options, cmd_ctl);
+  return FindPool(flags, freshness)->Begin(options, cmd_ctl);
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
+                                  const ReplicaFreshness& freshness,
                                   OptionalCommandControl cmd_ctl) {
   if (!(flags & kClusterHostRolesMask)) {
     throw LogicError(
         "Host role must be specified for execution of a single statement");
   }
   LOG_TRACE() << "Requested single statement on " << flags;
-  return FindPool(flags)->Start(cmd_ctl);
+  return FindPool(flags, freshness)->Start(cmd_ctl);
 }
 
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
@@ -41,10 +41,11 @@ class ClusterImpl {
 
   ClusterStatisticsPtr GetStatistics() const;
 
-  Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
-                    OptionalCommandControl);
+  Transaction Begin(ClusterHostTypeFlags, const ReplicaFreshness&,
+                    const TransactionOptions&, OptionalCommandControl);
 
-  NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  NonTransaction Start(ClusterHostTypeFlags, const ReplicaFreshness&,
+                       OptionalCommandControl);
 
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
@@ -74,7 +75,7 @@ class ClusterImpl {
 
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
-  ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  ConnectionPoolPtr FindPool(ClusterHostTypeFlags, const ReplicaFreshness&);
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
@@ -230,14 +230,16 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.duplicate_prepared_statements +=
       conn_stats.duplicate_prepared_statements;
 
-  stats_.transaction.total_percentile.GetCurrentCounter().Account(
-      std::chrono::duration_cast<std::chrono::milliseconds>(
-          conn_stats.trx_end_time - conn_stats.trx_start_time)
-          .count());
-  stats_.transaction.busy_percentile.GetCurrentCounter().Account(
-      std::chrono::duration_cast<std::chrono::milliseconds>(
-          conn_stats.sum_query_duration)
-          .count());
+  const auto total_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            conn_stats.trx_end_time - conn_stats.trx_start_time)
+                            .count();
+  const auto busy_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           conn_stats.sum_query_duration)
+                           .count();
+  stats_.transaction.total_percentile.GetCurrentCounter().Account(total_ms);
+  stats_.transaction.busy_percentile.GetCurrentCounter().Account(busy_ms);
+  stats_.transaction.total_histogram.GetCurrentCounter().Account(total_ms);
+  stats_.transaction.busy_histogram.GetCurrentCounter().Account(busy_ms);
   stats_.transaction.wait_start_percentile.GetCurrentCounter().Account(
       std::chrono::duration_cast<std::chrono::milliseconds>(
           conn_stats.work_start_time - conn_stats.trx_start_time)
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/internal_pg_types.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -27,6 +29,14 @@ class TopologyBase {
   using DsnIndicesByType =
       std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
 
+  struct ReplicaState {
+    bool is_master{false};
+    /// Last known replayed WAL position, write position for master
+    Lsn wal_lsn{kUnknownLsn};
+    std::chrono::milliseconds replication_lag{0};
+  };
+  using ReplicaStates = std::vector<ReplicaState>;
+
   TopologyBase(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                clients::dns::Resolver* resolver,
                const TopologySettings& topology_settings,
@@ -47,6 +57,9 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// Last known replication state for each DSN in DsnList
+  virtual rcu::ReadablePtr<ReplicaStates> GetReplicaStates() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
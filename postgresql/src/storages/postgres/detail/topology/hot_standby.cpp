@@ -162,6 +162,11 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::ReplicaStates> HotStandby::GetReplicaStates()
+    const {
+  return replica_states_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -177,6 +182,7 @@ void HotStandby::RunDiscovery() {
 
   // Report states and find the master
   HostState* master = nullptr;
+  ReplicaStates replica_states(host_states_.size());
   std::chrono::system_clock::time_point max_slave_xact_timestamp;
   for (DsnIndex i = 0; i < host_states_.size(); ++i) {
     auto& state = host_states_[i];
@@ -189,8 +195,11 @@ void HotStandby::RunDiscovery() {
               state.roundtrip_time)
               .count());
     }
+    replica_states[i].wal_lsn = state.wal_lsn;
     if (state.role == ClusterHostType::kMaster) {
       master = &state;
+      // Stays the freshest host even if demoted to slave as readonly
+      replica_states[i].is_master = true;
     } else if (state.role == ClusterHostType::kSlave) {
       max_slave_xact_timestamp =
           std::max(max_slave_xact_timestamp, state.current_xact_timestamp);
@@ -225,6 +234,7 @@ void HotStandby::RunDiscovery() {
     dsn_stats_[i].replication_lag.GetCurrentCounter().Account(
         std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag)
             .count());
+    replica_states[i].replication_lag = slave_lag;
 
     if (slave_lag > GetTopologySettings().max_replication_lag) {
       // Demote lagged slave
@@ -280,6 +290,7 @@ void HotStandby::RunDiscovery() {
   }
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  replica_states_.Assign(std::move(replica_states));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
@@ -28,6 +28,7 @@ class HotStandby final : public TopologyBase {
 
   rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
   rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
+  rcu::ReadablePtr<ReplicaStates> GetReplicaStates() const override;
   const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics()
       const override;
 
@@ -40,6 +41,7 @@ class HotStandby final : public TopologyBase {
   std::vector<HostState> host_states_;
   rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
   rcu::Variable<DsnIndices> alive_dsn_indices_;
+  rcu::Variable<ReplicaStates> replica_states_;
   std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
   USERVER_NAMESPACE::utils::PeriodicTask discovery_task_;
 };
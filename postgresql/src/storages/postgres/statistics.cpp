@@ -29,6 +29,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     timing["return-to-pool"] = stats.transaction.return_to_pool_percentile;
     timing["connect"] = stats.connection_percentile;
     timing["acquire-connection"] = stats.acquire_percentile;
+
+    auto histogram = trx["timings-histogram"];
+    histogram["full"] = stats.transaction.total_histogram;
+    histogram["busy"] = stats.transaction.busy_histogram;
   }
   if (auto query = writer["queries"]) {
     query["parsed"] = stats.transaction.parse_total;
@@ -309,6 +309,34 @@ UTEST_F(PostgreCluster, HostSelectionSingleQuery) {
       pg::LogicError);
 }
 
+UTEST_F(PostgreCluster, ReplicaFreshness) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+
+  /// [Read your writes]
+  const auto write_position = cluster.GetWritePosition();
+  // Goes to a slave that has replayed the write, or to master otherwise
+  const auto res = cluster.Execute(pg::ClusterHostType::kSlave,
+                                   pg::ReplicaFreshness{{}, write_position},
+                                   {}, "select 1");
+  /// [Read your writes]
+  EXPECT_EQ(1, res.AsSingleRow<int>());
+
+  pg::ReplicaFreshness freshness;
+  freshness.max_staleness = std::chrono::milliseconds{0};
+  UEXPECT_NO_THROW(cluster.Execute({pg::ClusterHostType::kSlave,
+                                    pg::ClusterHostType::kMaster},
+                                   freshness, {}, "select 1"));
+  UEXPECT_NO_THROW(CheckRoTransaction(
+      cluster.Begin(pg::ClusterHostType::kSyncSlave, freshness,
+                    pg::Transaction::RO)));
+  UEXPECT_THROW(
+      cluster.Begin(pg::ClusterHostType::kSlave, freshness,
+                    pg::Transaction::RW),
+      pg::ClusterUnavailable);
+}
+
 UTEST_F(PostgreCluster, TransactionTimeouts) {
   testsuite::TestsuiteTasks testsuite_tasks{true};
   auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
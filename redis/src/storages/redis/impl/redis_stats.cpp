@@ -139,6 +139,7 @@ void Statistics::AccountReplyReceived(const ReplyPtr& reply,
   auto ms =
       std::chrono::duration_cast<std::chrono::milliseconds>(delta).count();
   timings_percentile.GetCurrentCounter().Account(ms);
+  timings_histogram.GetCurrentCounter().Account(ms);
   auto command_timings = command_timings_percentile.find(cmd->GetName());
   if (command_timings != command_timings_percentile.end()) {
     command_timings->second.GetCurrentCounter().Account(ms);
@@ -175,6 +176,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
   if (stats.settings.timings_enabled) {
     writer["timings"] = stats.timings_percentile;
+    writer["timings_histogram"] = stats.timings_histogram;
   }
 
   if (stats.settings.command_timings_enabled &&
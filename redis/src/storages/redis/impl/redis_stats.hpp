@@ -11,6 +11,7 @@
 #include <userver/storages/redis/impl/redis_state.hpp>
 #include <userver/storages/redis/impl/types.hpp>
 #include <userver/utils/statistics/aggregated_values.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
@@ -40,6 +41,10 @@ class Statistics {
   using RecentPeriod =
       utils::statistics::RecentPeriod<Percentile, Percentile,
                                       utils::datetime::SteadyClock>;
+  using Histogram = utils::statistics::Histogram<>;
+  using HistogramRecentPeriod =
+      utils::statistics::RecentPeriod<Histogram, Histogram,
+                                      utils::datetime::SteadyClock>;
 
   std::atomic<RedisState> state{RedisState::kInit};
   std::atomic_llong reconnects{0};
@@ -47,6 +52,7 @@ class Statistics {
   RecentPeriod request_size_percentile;
   RecentPeriod reply_size_percentile;
   RecentPeriod timings_percentile;
+  HistogramRecentPeriod timings_histogram;
   std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
   std::atomic_llong last_ping_ms{};
   std::atomic_bool is_syncing = false;
@@ -66,6 +72,7 @@ struct InstanceStatistics {
             other.request_size_percentile.GetStatsForPeriod()),
         reply_size_percentile(other.reply_size_percentile.GetStatsForPeriod()),
         timings_percentile(other.timings_percentile.GetStatsForPeriod()),
+        timings_histogram(other.timings_histogram.GetStatsForPeriod()),
         last_ping_ms(other.last_ping_ms.load(std::memory_order_relaxed)),
         is_syncing(other.is_syncing.load(std::memory_order_relaxed)),
         offset_from_master(
@@ -87,6 +94,7 @@ struct InstanceStatistics {
     request_size_percentile.Add(other.request_size_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
     timings_percentile.Add(other.timings_percentile);
+    timings_histogram.Add(other.timings_histogram);
 
     for (size_t i = 0; i < error_count.size(); i++)
       error_count[i] += other.error_count[i];
@@ -102,6 +110,7 @@ struct InstanceStatistics {
   Statistics::Percentile request_size_percentile;
   Statistics::Percentile reply_size_percentile;
   Statistics::Percentile timings_percentile;
+  Statistics::Histogram timings_histogram;
   std::unordered_map<std::string, Statistics::Percentile>
       command_timings_percentile;
   long long last_ping_ms;
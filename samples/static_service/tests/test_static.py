@@ -27,3 +27,57 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_range(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    data = file.read_bytes()
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-5'},
+    )
+    assert response.status == 206
+    assert response.headers['Content-Range'] == f'bytes 1-5/{len(data)}'
+    assert response.content == data[1:6]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=-10'},
+    )
+    assert response.status == 206
+    assert response.content == data[-10:]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={len(data)}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{len(data)}'
+
+    # multiple ranges are not supported
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-2,4-5'},
+    )
+    assert response.status == 200
+    assert response.content == data
+
+
+async def test_etag(service_client):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': f'"other", W/{etag}'},
+    )
+    assert response.status == 304
+    assert response.content == b''
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=0-0', 'If-Range': etag},
+    )
+    assert response.status == 206
+    assert response.content == b'<'
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=0-0', 'If-Range': '"other"'},
+    )
+    assert response.status == 200
@@ -120,6 +120,8 @@ inline constexpr PredefinedHeader kSetCookie{"Set-Cookie"};
 inline constexpr PredefinedHeader kWebsocketKey{"Sec-WebSocket-Key"};
 inline constexpr PredefinedHeader kWebsocketAccept{"Sec-WebSocket-Accept"};
 inline constexpr PredefinedHeader kWebsocketVersion{"Sec-WebSocket-Version"};
+inline constexpr PredefinedHeader kWebsocketExtensions{
+    "Sec-WebSocket-Extensions"};
 /// @}
 
 /// @name Extra headers
@@ -134,6 +136,7 @@ inline constexpr PredefinedHeader kCookie{"Cookie"};
 inline constexpr PredefinedHeader kXYaRequestId{"X-YaRequestId"};
 inline constexpr PredefinedHeader kXYaTraceId{"X-YaTraceId"};
 inline constexpr PredefinedHeader kXYaSpanId{"X-YaSpanId"};
+inline constexpr PredefinedHeader kXYaTraceSampled{"X-YaTraceSampled"};
 inline constexpr PredefinedHeader kXRequestId{"X-RequestId"};
 inline constexpr PredefinedHeader kXBackendServer{"X-Backend-Server"};
 inline constexpr PredefinedHeader kXTaxiEnvoyProxyDstVhost{
@@ -169,6 +172,8 @@ inline constexpr PredefinedHeader kXYaTaxiRatelimitedBy{
     "X-YaTaxi-Ratelimited-By"};
 inline constexpr PredefinedHeader kXYaTaxiRatelimitReason{
     "X-YaTaxi-Ratelimit-Reason"};
+inline constexpr PredefinedHeader kXRequestCriticality{
+    "X-Request-Criticality"};
 
 namespace ratelimit_reason {
 inline constexpr std::string_view kCC{"congestion-control"};
@@ -178,6 +183,8 @@ inline constexpr std::string_view kMaxPendingResponses{
     "too-many-pending-responses"};
 inline constexpr std::string_view kGlobal{"global-ratelimit"};
 inline constexpr std::string_view kInFlight{"max-requests-in-flight"};
+inline constexpr std::string_view kAdaptiveConcurrency{"adaptive-concurrency"};
+inline constexpr std::string_view kQueueDelay{"queue-delay"};
 }  // namespace ratelimit_reason
 /// @}
 
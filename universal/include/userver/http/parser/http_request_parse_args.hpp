@@ -27,6 +27,10 @@ using ArgsConsumer =
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler);
 
+/// Checks that ParseArgs would accept the args without decoding them,
+/// throws std::runtime_error on bad input
+void ValidateArgs(std::string_view args);
+
 }  // namespace http::parser
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -9,6 +10,73 @@ USERVER_NAMESPACE_BEGIN
 
 namespace http::parser {
 
+namespace {
+
+[[noreturn]] void ThrowInvalidPercentEncoding(std::string_view url,
+                                              const char* ptr) {
+  const auto* data_end = url.data() + url.size();
+
+  static constexpr std::size_t kMaxOutputLength = 100;
+  std::string data_short(url);
+  if (data_short.size() > kMaxOutputLength) {
+    data_short = data_short.substr(0, kMaxOutputLength);
+    data_short += "<...>";
+  }
+  const auto percent_encoded_len =
+      std::min(static_cast<std::size_t>(data_end - ptr), std::size_t{3});
+
+  throw std::runtime_error("invalid percent-encoding sequence '" +
+                           std::string(ptr, percent_encoded_len) +
+                           "\' in input '" + std::move(data_short) + '\'');
+}
+
+bool IsValidPercentEncoded(const char* ptr, const char* data_end) {
+  return ptr + 2 < data_end &&
+         utils::encoding::IsHexData(std::string_view{ptr + 1, 2});
+}
+
+void ValidateUrlEncoded(std::string_view url) {
+  const auto* data_end = url.data() + url.size();
+  for (const auto* ptr = url.data(); ptr < data_end; ++ptr) {
+    ptr = static_cast<const char*>(memchr(ptr, '%', data_end - ptr));
+    if (!ptr) return;
+    if (!IsValidPercentEncoded(ptr, data_end)) {
+      ThrowInvalidPercentEncoding(url, ptr);
+    }
+    ptr += 2;
+  }
+}
+
+template <typename Func>
+void ForEachArg(std::string_view args, Func&& func) {
+  const char* end = args.data() + args.size();
+  const char* key_begin = args.data();
+  const char* key_end = args.data();
+  bool parse_key = true;
+  for (const char* ptr = args.data(); ptr <= end; ++ptr) {
+    if (ptr == end || *ptr == '&') {
+      if (!parse_key) {
+        const char* value_begin = key_end + 1;
+        const char* value_end = ptr;
+        if (key_begin < key_end && value_begin <= value_end) {
+          func(std::string_view(key_begin, key_end - key_begin),
+               std::string_view(value_begin, value_end - value_begin));
+        }
+      }
+      parse_key = true;
+      key_begin = ptr + 1;
+      continue;
+    }
+    if (*ptr == '=' && parse_key) {
+      parse_key = false;
+      key_end = ptr;
+      continue;
+    }
+  }
+}
+
+}  // namespace
+
 void ParseArgs(std::string_view args,
                std::unordered_map<std::string, std::vector<std::string>,
                                   utils::StrCaseHash>& result) {
@@ -33,19 +101,7 @@ std::string UrlDecode(std::string_view url) {
           utils::encoding::FromHex({ptr + 1, 2}, res) == 2) {
         ptr += 2;
       } else {
-        static constexpr std::size_t kMaxOutputLength = 100;
-        std::string data_short(data, data_end - data);
-        if (data_short.size() > kMaxOutputLength) {
-          data_short = data_short.substr(0, kMaxOutputLength);
-          data_short += "<...>";
-        }
-        const auto percent_encoded_len =
-            std::min(static_cast<std::size_t>(data_end - ptr), std::size_t{3});
-
-        throw std::runtime_error("invalid percent-encoding sequence '" +
-                                 std::string(ptr, percent_encoded_len) +
-                                 "\' in input '" + std::move(data_short) +
-                                 '\'');
+        ThrowInvalidPercentEncoding(url, ptr);
       }
     } else if (*ptr == '+') {
       res += ' ';
@@ -57,32 +113,17 @@ std::string UrlDecode(std::string_view url) {
 }
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler) {
-  const char* end = args.data() + args.size();
-  const char* key_begin = args.data();
-  const char* key_end = args.data();
-  bool parse_key = true;
-  for (const char* ptr = args.data(); ptr <= end; ++ptr) {
-    if (ptr == end || *ptr == '&') {
-      if (!parse_key) {
-        const char* value_begin = key_end + 1;
-        const char* value_end = ptr;
-        if (key_begin < key_end && value_begin <= value_end) {
-          std::string_view key(key_begin, key_end - key_begin);
-          std::string_view value(value_begin, value_end - value_begin);
-          handler(USERVER_NAMESPACE::http::parser::UrlDecode(key),
-                  USERVER_NAMESPACE::http::parser::UrlDecode(value));
-        }
-      }
-      parse_key = true;
-      key_begin = ptr + 1;
-      continue;
-    }
-    if (*ptr == '=' && parse_key) {
-      parse_key = false;
-      key_end = ptr;
-      continue;
-    }
-  }
+  ForEachArg(args, [&handler](std::string_view key, std::string_view value) {
+    handler(USERVER_NAMESPACE::http::parser::UrlDecode(key),
+            USERVER_NAMESPACE::http::parser::UrlDecode(value));
+  });
+}
+
+void ValidateArgs(std::string_view args) {
+  ForEachArg(args, [](std::string_view key, std::string_view value) {
+    ValidateUrlEncoded(key);
+    ValidateUrlEncoded(value);
+  });
 }
 
 }  // namespace http::parser